@@ -9,6 +9,7 @@
 #include "PathUtils.h"
 #include "AnimSequence.h"
 #include "AnimDataModel.h"
+#include "AnimCompression.h"
 #include "ResourceManager.h"
 #include <filesystem>
 #include <functional>
@@ -1443,10 +1444,35 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 			Reader << *DataModel;
 			Reader.Close();
 
+#ifdef USE_COMPRESSED_ANIMATION
+			const bool bWantCompressed = true;
+#else
+			const bool bWantCompressed = false;
+#endif
+			// 압축 설정과 캐시 형식이 다르면 캐시를 다시 만든다
+			// - 압축을 끈 빌드에서 압축 캐시: 원본 키와 커브가 없으므로 항상 재생성
+			// - 압축을 켠 빌드에서 원본 캐시: 압축해도 남는 트랙이 없으면(모든 본이 바인드 포즈) 생성 시에도 원본으로 저장되므로 그대로 쓴다
+			if (bWantCompressed != DataModel->IsCompressed())
+			{
+				bool bRawByDesign = false;
+				if (bWantCompressed)
+				{
+					FCompressedAnimSequence Probe;
+					bRawByDesign = !AnimCompression::CompressTracks(DataModel->BoneAnimationTracks, TargetSkeleton, FAnimCompressionSettings(), Probe) || Probe.IsEmpty();
+				}
+
+				if (!bRawByDesign)
+				{
+					throw std::runtime_error("Animation cache compression setting mismatch.");
+				}
+			}
+
 			// 캐시 로드 성공
 			bLoadedFromCache = true;
-			UE_LOG("UFbxLoader::LoadFbxAnimation: Successfully loaded animation from cache (%.3f sec, %d bones, %d keys)",
-				DataModel->SequenceLength, DataModel->BoneAnimationTracks.Num(), DataModel->NumberOfKeys);
+			UE_LOG("UFbxLoader::LoadFbxAnimation: Successfully loaded animation from cache (%.3f sec, %d tracks, %d keys, %s)",
+				DataModel->SequenceLength,
+				DataModel->IsCompressed() ? DataModel->CompressedData.Tracks.Num() : DataModel->BoneAnimationTracks.Num(),
+				DataModel->NumberOfKeys, DataModel->IsCompressed() ? "compressed" : "raw");
 
 			// UAnimSequence 생성 및 설정
 			UAnimSequence* AnimSequence = NewObject<UAnimSequence>();
@@ -1797,6 +1823,36 @@ UAnimSequence* UFbxLoader::LoadFbxAnimation(const FString& FilePath, const struc
 
 	DataModel->NumberOfKeys = TotalKeys;
 
+#ifdef USE_COMPRESSED_ANIMATION
+	// 15-1. 트랙 압축 (성공하면 원본 키와 커브는 버린다)
+	{
+		SIZE_T RawSize = 0;
+		for (const FBoneAnimationTrack& Track : DataModel->BoneAnimationTracks)
+		{
+			const FRawAnimSequenceTrack& Raw = Track.InternalTrack;
+			RawSize += Raw.PositionKeys.Num() * sizeof(FVector) + Raw.RotationKeys.Num() * sizeof(FQuat) + Raw.ScaleKeys.Num() * sizeof(FVector);
+		}
+
+		if (AnimCompression::CompressTracks(DataModel->BoneAnimationTracks, TargetSkeleton, FAnimCompressionSettings(), DataModel->CompressedData) &&
+			DataModel->IsCompressed())
+		{
+			const SIZE_T CompressedSize = AnimCompression::GetCompressedSize(DataModel->CompressedData);
+			UE_LOG("UFbxLoader::LoadFbxAnimation: Compressed %d tracks -> %d (%.1f KB -> %.1f KB)",
+				DataModel->BoneAnimationTracks.Num(), DataModel->CompressedData.Tracks.Num(),
+				RawSize / 1024.0f, CompressedSize / 1024.0f);
+
+			DataModel->BoneAnimationTracks.Empty();
+			DataModel->BoneAnimationTracks.Shrink();
+			DataModel->CurveData.Reset();
+		}
+		else
+		{
+			DataModel->CompressedData.Reset();
+			UE_LOG("UFbxLoader::LoadFbxAnimation: Keeping raw tracks (compression skipped)");
+		}
+	}
+#endif // USE_COMPRESSED_ANIMATION
+
 	// 16. UAnimSequence 생성 및 설정
 	UAnimSequence* AnimSequence = NewObject<UAnimSequence>();
 	AnimSequence->SetFilePath(NormalizedPath);
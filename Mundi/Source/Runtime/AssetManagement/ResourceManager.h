@@ -136,7 +136,7 @@ protected:
 	ID3D11DeviceContext* Context = nullptr;
 
 	//Resource Type의 개수만큼 Array 생성 및 저장
-	TArray<TMap<FString, UResourceBase*>> Resources;
+	TArray<TFlatMap<FString, UResourceBase*>> Resources;
 
 	TMap<FString, TArray<D3D11_INPUT_ELEMENT_DESC>> ShaderToInputLayoutMap;
 	TMap<FString, FString> TextureToShaderMap;
@@ -43,6 +43,17 @@ void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice)
     VertexCount = static_cast<uint32>(Data->Vertices.size());
     IndexCount = static_cast<uint32>(Data->Indices.size());
     VertexStride = sizeof(FVertexDynamic);
+
+    // 바인드 포즈 바운드 구
+    FVector BoundsMin = Data->Vertices[0].Position;
+    FVector BoundsMax = Data->Vertices[0].Position;
+    for (const FSkinnedVertex& Vertex : Data->Vertices)
+    {
+        BoundsMin = BoundsMin.ComponentMin(Vertex.Position);
+        BoundsMax = BoundsMax.ComponentMax(Vertex.Position);
+    }
+    LocalBoundsCenter = (BoundsMin + BoundsMax) * 0.5f;
+    LocalBoundsRadius = ((BoundsMax - BoundsMin) * 0.5f).Size();
 }
 
 void USkeletalMesh::ReleaseResources()
@@ -58,6 +69,8 @@ void USkeletalMesh::ReleaseResources()
         delete Data;
         Data = nullptr;
     }
+
+    CPUSkinningStreams.Reset();
 }
 
 void USkeletalMesh::CreateVertexBuffer(ID3D11Buffer** InVertexBuffer)
@@ -75,6 +88,15 @@ void USkeletalMesh::UpdateVertexBuffer(const TArray<FNormalVertex>& SkinnedVerti
     GEngine.GetRHIDevice()->VertexBufferUpdate(InVertexBuffer, SkinnedVertices);
 }
 
+const FCPUSkinningStreams& USkeletalMesh::GetCPUSkinningStreams()
+{
+    if (Data && CPUSkinningStreams.NumVertices != Data->Vertices.Num())
+    {
+        CPUSkinningStreams.Build(Data->Vertices);
+    }
+    return CPUSkinningStreams;
+}
+
 void USkeletalMesh::CreateGPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer)
 {
     if (!Data) { return; }
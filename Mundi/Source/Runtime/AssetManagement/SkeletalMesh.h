@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "ResourceBase.h"
+#include "CPUSkinning.h"
 
 class UPhysicsAsset;
 
@@ -31,9 +32,16 @@ public:
 
     uint64 GetMeshGroupCount() const { return Data ? Data->GroupInfos.size() : 0; }
 
+    // 바인드 포즈 정점 기준 바운드 구 (로컬 공간, 화면 크기 추정용)
+    const FVector& GetLocalBoundsCenter() const { return LocalBoundsCenter; }
+    float GetLocalBoundsRadius() const { return LocalBoundsRadius; }
+
     void CreateVertexBuffer(ID3D11Buffer** InVertexBuffer);
     void UpdateVertexBuffer(const TArray<FNormalVertex>& SkinnedVertices, ID3D11Buffer* InVertexBuffer);
 
+    // CPU 스키닝용 SoA 입력 스트림 (처음 요청될 때 게임 스레드에서 만들고 메시가 해제될 때까지 재사용)
+    const FCPUSkinningStreams& GetCPUSkinningStreams();
+
     // GPU 스키닝용 버텍스 버퍼 생성 (FSkinnedVertex 그대로 사용)
     void CreateGPUSkinnedVertexBuffer(ID3D11Buffer** InVertexBuffer);
     
@@ -48,9 +56,12 @@ private:
     uint32 VertexCount = 0;     // 정점 개수
     uint32 IndexCount = 0;     // 버텍스 점의 개수 
     uint32 VertexStride = 0;
+    FVector LocalBoundsCenter = FVector(0.0f, 0.0f, 0.0f);
+    float LocalBoundsRadius = 0.0f;
     
     // CPU 리소스
     FSkeletalMeshData* Data = nullptr;
+    FCPUSkinningStreams CPUSkinningStreams;
 
     // Physics Asset (Ragdoll, 충돌체 설정)
     UPhysicsAsset* PhysicsAsset = nullptr;
@@ -0,0 +1,220 @@
+﻿#include "pch.h"
+#include "Benchmark.h"
+#include <random>
+
+// 컨테이너 마이크로 벤치마크 (콘솔: BENCH INLINEARRAY, BENCH FLATMAP)
+
+namespace
+{
+    // 짧은 임시 목록(자식 컴포넌트 복사본, 본 영향 목록 등)을 만들고 버리는 패턴
+    template<typename ArrayType>
+    uint64 BuildShortLists(int32 Iterations, int32 ListSize)
+    {
+        uint64 Checksum = 0;
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            ArrayType List;
+            for (int32 i = 0; i < ListSize; ++i)
+            {
+                List.Add(reinterpret_cast<void*>(static_cast<uintptr_t>(Iteration + i + 1)));
+            }
+            for (void* Element : List)
+            {
+                Checksum += reinterpret_cast<uintptr_t>(Element);
+            }
+        }
+        return Checksum;
+    }
+
+    void RunInlineArrayBenchmark()
+    {
+        constexpr int32 Iterations = 2000000;
+        constexpr int32 Repeats = 3;
+
+        // 8 이하는 인라인 버퍼 안, 16은 힙으로 넘어가는 경우
+        for (int32 ListSize : { 2, 6, 8, 16 })
+        {
+            uint64 ChecksumA = 0;
+            uint64 ChecksumB = 0;
+            const double HeapMS = Benchmark::MeasureBestMS(Repeats, [&]()
+            {
+                ChecksumA = BuildShortLists<TArray<void*>>(Iterations, ListSize);
+            });
+            const double InlineMS = Benchmark::MeasureBestMS(Repeats, [&]()
+            {
+                ChecksumB = BuildShortLists<TInlineArray<void*, 8>>(Iterations, ListSize);
+            });
+            Benchmark::DoNotOptimize(ChecksumA);
+            Benchmark::DoNotOptimize(ChecksumB);
+
+            UE_LOG("[Benchmark] %d lists x %2d elements: TArray %8.2f ms, TInlineArray<8> %8.2f ms (%.1fx)%s",
+                Iterations, ListSize, HeapMS, InlineMS, HeapMS / InlineMS,
+                ChecksumA == ChecksumB ? "" : " CHECKSUM MISMATCH");
+        }
+    }
+
+    struct FHashTimings
+    {
+        double InsertMS = 0.0;
+        double FindMS = 0.0;      // 전체 키 적중 + 같은 수의 실패 조회
+        double IterateMS = 0.0;
+        double EraseMS = 0.0;     // 절반 제거
+        uint64 Checksum = 0;
+    };
+
+    double ElapsedMS(uint64 StartCycles)
+    {
+        return FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - StartCycles);
+    }
+
+    template<typename MapType, typename KeyType>
+    FHashTimings RunMapOps(const TArray<KeyType>& Keys, const TArray<KeyType>& MissingKeys, int32 Rounds)
+    {
+        FHashTimings Timings;
+        for (int32 Round = 0; Round < Rounds; ++Round)
+        {
+            MapType Map;
+
+            uint64 Start = FWindowsPlatformTime::Cycles64();
+            for (int32 i = 0; i < Keys.Num(); ++i)
+            {
+                Map.Add(Keys[i], i);
+            }
+            Timings.InsertMS += ElapsedMS(Start);
+
+            Start = FWindowsPlatformTime::Cycles64();
+            for (const KeyType& Key : Keys)
+            {
+                if (const int32* Value = Map.Find(Key))
+                {
+                    Timings.Checksum += *Value;
+                }
+            }
+            for (const KeyType& Key : MissingKeys)
+            {
+                Timings.Checksum += Map.Find(Key) ? 1 : 0;
+            }
+            Timings.FindMS += ElapsedMS(Start);
+
+            Start = FWindowsPlatformTime::Cycles64();
+            for (const auto& Pair : Map)
+            {
+                Timings.Checksum += Pair.second;
+            }
+            Timings.IterateMS += ElapsedMS(Start);
+
+            Start = FWindowsPlatformTime::Cycles64();
+            for (int32 i = 0; i < Keys.Num(); i += 2)
+            {
+                Map.Remove(Keys[i]);
+            }
+            Timings.EraseMS += ElapsedMS(Start);
+            Timings.Checksum += Map.Num();
+        }
+        return Timings;
+    }
+
+    template<typename SetType, typename KeyType>
+    FHashTimings RunSetOps(const TArray<KeyType>& Keys, const TArray<KeyType>& MissingKeys, int32 Rounds)
+    {
+        FHashTimings Timings;
+        for (int32 Round = 0; Round < Rounds; ++Round)
+        {
+            SetType Set;
+
+            uint64 Start = FWindowsPlatformTime::Cycles64();
+            for (const KeyType& Key : Keys)
+            {
+                Set.Add(Key);
+            }
+            Timings.InsertMS += ElapsedMS(Start);
+
+            Start = FWindowsPlatformTime::Cycles64();
+            for (const KeyType& Key : Keys)
+            {
+                Timings.Checksum += Set.Contains(Key) ? 1 : 0;
+            }
+            for (const KeyType& Key : MissingKeys)
+            {
+                Timings.Checksum += Set.Contains(Key) ? 1 : 0;
+            }
+            Timings.FindMS += ElapsedMS(Start);
+
+            Start = FWindowsPlatformTime::Cycles64();
+            for (const KeyType& Key : Set)
+            {
+                Timings.Checksum += std::hash<KeyType>()(Key) & 1;
+            }
+            Timings.IterateMS += ElapsedMS(Start);
+
+            Start = FWindowsPlatformTime::Cycles64();
+            for (int32 i = 0; i < Keys.Num(); i += 2)
+            {
+                Set.Remove(Keys[i]);
+            }
+            Timings.EraseMS += ElapsedMS(Start);
+            Timings.Checksum += Set.Num();
+        }
+        return Timings;
+    }
+
+    void LogHashTimings(const char* Label, int32 NumKeys, int32 Rounds, const FHashTimings& Node, const FHashTimings& Flat)
+    {
+        // 라운드 평균 (ms), 노드 기반 / 플랫
+        UE_LOG("[Benchmark] %-12s %8d: insert %8.3f / %8.3f, find %8.3f / %8.3f, iterate %8.3f / %8.3f, erase half %8.3f / %8.3f%s",
+            Label, NumKeys,
+            Node.InsertMS / Rounds, Flat.InsertMS / Rounds,
+            Node.FindMS / Rounds, Flat.FindMS / Rounds,
+            Node.IterateMS / Rounds, Flat.IterateMS / Rounds,
+            Node.EraseMS / Rounds, Flat.EraseMS / Rounds,
+            Node.Checksum == Flat.Checksum ? "" : " CHECKSUM MISMATCH");
+    }
+
+    void RunFlatMapBenchmark()
+    {
+        UE_LOG("[Benchmark] ms per round, TMap|TSet / TFlatMap|TFlatSet (find = every key + the same number of misses)");
+
+        for (int32 NumKeys : { 1000, 10000, 100000, 1000000 })
+        {
+            // 크기가 작을수록 여러 라운드 돌려 평균 (라운드당 작업량을 비슷하게)
+            const int32 Rounds = FMath::Clamp(1000000 / NumKeys, 1, 200);
+
+            // uint64 키 (포인터/ID 키), 섞인 순서
+            std::mt19937_64 Random(1234);
+            TArray<uint64> IntKeys;
+            TArray<uint64> MissingIntKeys;
+            IntKeys.Reserve(NumKeys);
+            MissingIntKeys.Reserve(NumKeys);
+            for (int32 i = 0; i < NumKeys; ++i)
+            {
+                // 최하위 비트로 적중/실패 키를 나눠 겹치지 않게 한다
+                IntKeys.Add(Random() | 1ull);
+                MissingIntKeys.Add(Random() & ~1ull);
+            }
+
+            // FString 키 (리소스 경로, 프로파일 키)
+            TArray<FString> StringKeys;
+            TArray<FString> MissingStringKeys;
+            StringKeys.Reserve(NumKeys);
+            MissingStringKeys.Reserve(NumKeys);
+            for (int32 i = 0; i < NumKeys; ++i)
+            {
+                StringKeys.Add("Data/Model/Asset_" + std::to_string(IntKeys[i] % 100000000ull) + "_" + std::to_string(i) + ".obj");
+                MissingStringKeys.Add("Data/Textures/Missing_" + std::to_string(i) + ".dds");
+            }
+
+            LogHashTimings("map<uint64>", NumKeys, Rounds,
+                RunMapOps<TMap<uint64, int32>>(IntKeys, MissingIntKeys, Rounds),
+                RunMapOps<TFlatMap<uint64, int32>>(IntKeys, MissingIntKeys, Rounds));
+            LogHashTimings("map<FString>", NumKeys, Rounds,
+                RunMapOps<TMap<FString, int32>>(StringKeys, MissingStringKeys, Rounds),
+                RunMapOps<TFlatMap<FString, int32>>(StringKeys, MissingStringKeys, Rounds));
+            LogHashTimings("set<uint64>", NumKeys, Rounds,
+                RunSetOps<TSet<uint64>>(IntKeys, MissingIntKeys, Rounds),
+                RunSetOps<TFlatSet<uint64>>(IntKeys, MissingIntKeys, Rounds));
+        }
+    }
+}
+
+REGISTER_BENCHMARK("INLINEARRAY", "TArray vs TInlineArray<T, 8> short temporary lists", RunInlineArrayBenchmark)
+REGISTER_BENCHMARK("FLATMAP", "TMap/TSet vs TFlatMap/TFlatSet insert, find, iterate, erase at 1K-1M entries", RunFlatMapBenchmark)
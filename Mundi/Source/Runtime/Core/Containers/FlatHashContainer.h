@@ -0,0 +1,577 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// ========================================================================================================
+// TFlatMap / TFlatSet - 오픈 어드레싱 해시 컨테이너
+// ========================================================================================================
+//
+// === 구조 ===
+// - 요소는 TArray에 빽빽하게 저장 (노드 할당 없음, 순회는 배열 순회)
+// - 버킷 배열은 (거리|핑거프린트, 요소 인덱스)만 담고 Robin Hood 방식으로 탐사
+// - 요소마다 해시를 저장해 두어 재해시/삭제 시 키 해시를 다시 계산하지 않음 (FString 키에 유리)
+//
+// === TMap/TSet과의 차이 ===
+// - 선언만 TMap -> TFlatMap, TSet -> TFlatSet으로 바꾸면 나머지 코드는 그대로 동작 (컨테이너별 선택)
+// - 순회 순서: 삽입 순서 (단, 삭제 시 마지막 요소가 빈 자리로 옮겨짐)
+// - 삽입/삭제 시 요소 포인터/반복자가 무효화될 수 있음 (std::vector와 동일)
+//   -> Find()로 얻은 포인터를 들고 있는 동안 Add/Remove 금지
+// - erase(iterator)는 같은 위치를 반환 (마지막 요소가 그 자리로 옮겨지므로 순회 중 삭제 가능)
+// ========================================================================================================
+
+namespace FlatHash
+{
+    struct FBucket
+    {
+        uint32 DistAndFingerprint = 0;  // 상위 24비트: 탐사 거리+1, 하위 8비트: 해시 핑거프린트 (0이면 빈 버킷)
+        uint32 ElementIndex = 0;
+    };
+
+    constexpr uint32 DistInc = 1u << 8;
+    constexpr uint32 FingerprintMask = DistInc - 1;
+    constexpr float MaxLoadFactor = 0.8f;
+
+    /** std::hash는 포인터/정수에 항등 함수라 그대로 쓰면 상위 비트가 치우침 -> 섞어서 사용 */
+    inline uint64 MixHash(uint64 Hash)
+    {
+        Hash ^= Hash >> 33;
+        Hash *= 0xff51afd7ed558ccdULL;
+        Hash ^= Hash >> 33;
+        Hash *= 0xc4ceb9fe1a85ec53ULL;
+        Hash ^= Hash >> 33;
+        return Hash;
+    }
+
+    template<typename T>
+    struct TSetKeyFuncs
+    {
+        using KeyType = T;
+        static const KeyType& GetKey(const T& Element) { return Element; }
+    };
+
+    template<typename K, typename V>
+    struct TMapKeyFuncs
+    {
+        using KeyType = K;
+        static const KeyType& GetKey(const std::pair<K, V>& Element) { return Element.first; }
+    };
+
+    /**
+     * TFlatMap/TFlatSet 공용 해시 테이블
+     * 요소 저장/탐사/삭제만 담당하고 API는 파생 클래스가 제공
+     */
+    template<typename ElementType, typename KeyFuncs, typename Hasher>
+    class TFlatHashTable
+    {
+    public:
+        using KeyType = typename KeyFuncs::KeyType;
+        using iterator = typename TArray<ElementType>::iterator;
+        using const_iterator = typename TArray<ElementType>::const_iterator;
+
+        TFlatHashTable() = default;
+
+        /** 키 해시 계산 (FindByHash/AddByHash에 넘길 값을 미리 구할 때 사용) */
+        static uint64 HashKey(const KeyType& Key)
+        {
+            return MixHash(static_cast<uint64>(Hasher()(Key)));
+        }
+
+        /** 크기 관련 */
+        int32 Num() const { return Elements.Num(); }
+        bool IsEmpty() const { return Elements.IsEmpty(); }
+        SIZE_T size() const { return Elements.size(); }
+        bool empty() const { return Elements.empty(); }
+
+        void Empty()
+        {
+            Elements.clear();
+            ElementHashes.clear();
+            std::fill(Buckets.begin(), Buckets.end(), FBucket{});
+        }
+
+        void clear() { Empty(); }
+
+        void Reserve(int32 Capacity)
+        {
+            Elements.Reserve(Capacity);
+            ElementHashes.Reserve(Capacity);
+            if (Capacity > MaxElementsForBuckets())
+            {
+                Rehash(BucketCountFor(Capacity));
+            }
+        }
+
+        void reserve(SIZE_T Capacity) { Reserve(static_cast<int32>(Capacity)); }
+
+        /** 순회 */
+        iterator begin() { return Elements.begin(); }
+        iterator end() { return Elements.end(); }
+        const_iterator begin() const { return Elements.begin(); }
+        const_iterator end() const { return Elements.end(); }
+
+        /** 검색 */
+        bool Contains(const KeyType& Key) const
+        {
+            return FindElementIndex(Key, HashKey(Key)) != NoIndex;
+        }
+
+        SIZE_T count(const KeyType& Key) const { return Contains(Key) ? 1 : 0; }
+
+        iterator find(const KeyType& Key)
+        {
+            const int32 Index = FindElementIndex(Key, HashKey(Key));
+            return Index != NoIndex ? Elements.begin() + Index : Elements.end();
+        }
+
+        const_iterator find(const KeyType& Key) const
+        {
+            const int32 Index = FindElementIndex(Key, HashKey(Key));
+            return Index != NoIndex ? Elements.begin() + Index : Elements.end();
+        }
+
+        /** 제거 */
+        bool Remove(const KeyType& Key)
+        {
+            return RemoveByHash(HashKey(Key), Key);
+        }
+
+        bool RemoveByHash(uint64 KeyHash, const KeyType& Key)
+        {
+            const int32 BucketIndex = FindBucketIndex(Key, KeyHash);
+            if (BucketIndex == NoIndex)
+            {
+                return false;
+            }
+            RemoveBucket(BucketIndex);
+            return true;
+        }
+
+        SIZE_T erase(const KeyType& Key) { return Remove(Key) ? 1 : 0; }
+
+        /** 삭제 후 같은 위치 반환 (마지막 요소가 이 자리로 옮겨짐) */
+        iterator erase(const_iterator Where)
+        {
+            const int32 ElementIndex = static_cast<int32>(Where - Elements.cbegin());
+            RemoveBucket(FindBucketOfElement(ElementIndex));
+            return Elements.begin() + ElementIndex;
+        }
+
+        iterator erase(iterator Where)
+        {
+            return erase(const_iterator(Where));
+        }
+
+    protected:
+        static constexpr int32 NoIndex = -1;
+
+        /** 키가 있으면 요소 인덱스, 없으면 NoIndex */
+        int32 FindElementIndex(const KeyType& Key, uint64 KeyHash) const
+        {
+            const int32 BucketIndex = FindBucketIndex(Key, KeyHash);
+            return BucketIndex != NoIndex ? static_cast<int32>(Buckets[BucketIndex].ElementIndex) : NoIndex;
+        }
+
+        /**
+         * 키를 찾고 없으면 Construct()로 요소를 만들어 추가
+         * @return (요소 인덱스, 새로 추가됐는지)
+         */
+        template<typename ConstructFunc>
+        std::pair<int32, bool> FindOrAdd(const KeyType& Key, uint64 KeyHash, ConstructFunc&& Construct)
+        {
+            const int32 Existing = FindElementIndex(Key, KeyHash);
+            if (Existing != NoIndex)
+            {
+                return { Existing, false };
+            }
+
+            if (Elements.Num() + 1 > MaxElementsForBuckets())
+            {
+                Rehash(BucketCountFor(Elements.Num() + 1));
+            }
+
+            const int32 ElementIndex = Elements.Num();
+            Construct();
+            ElementHashes.Add(KeyHash);
+            PlaceBucket(KeyHash, static_cast<uint32>(ElementIndex));
+            return { ElementIndex, true };
+        }
+
+        TArray<ElementType> Elements;
+
+    private:
+        uint32 BucketMask() const { return static_cast<uint32>(Buckets.size()) - 1; }
+        uint32 HomeBucket(uint64 KeyHash) const { return static_cast<uint32>(KeyHash >> 8) & BucketMask(); }
+        static uint32 Fingerprint(uint64 KeyHash) { return DistInc | static_cast<uint32>(KeyHash & FingerprintMask); }
+
+        int32 MaxElementsForBuckets() const
+        {
+            return static_cast<int32>(static_cast<float>(Buckets.size()) * MaxLoadFactor);
+        }
+
+        static SIZE_T BucketCountFor(int32 NumElements)
+        {
+            SIZE_T Count = 16;
+            while (static_cast<float>(Count) * MaxLoadFactor < static_cast<float>(NumElements))
+            {
+                Count <<= 1;
+            }
+            return Count;
+        }
+
+        int32 FindBucketIndex(const KeyType& Key, uint64 KeyHash) const
+        {
+            if (Buckets.empty())
+            {
+                return NoIndex;
+            }
+
+            uint32 DistAndFingerprint = Fingerprint(KeyHash);
+            uint32 BucketIndex = HomeBucket(KeyHash);
+            while (true)
+            {
+                const FBucket& Bucket = Buckets[BucketIndex];
+                if (Bucket.DistAndFingerprint == DistAndFingerprint &&
+                    KeyFuncs::GetKey(Elements[Bucket.ElementIndex]) == Key)
+                {
+                    return static_cast<int32>(BucketIndex);
+                }
+                // Robin Hood 불변식: 우리보다 가까운 버킷을 만나면 키가 없는 것
+                if (DistAndFingerprint > Bucket.DistAndFingerprint)
+                {
+                    return NoIndex;
+                }
+                DistAndFingerprint += DistInc;
+                BucketIndex = (BucketIndex + 1) & BucketMask();
+            }
+        }
+
+        int32 FindBucketOfElement(int32 ElementIndex) const
+        {
+            uint32 BucketIndex = HomeBucket(ElementHashes[ElementIndex]);
+            while (Buckets[BucketIndex].ElementIndex != static_cast<uint32>(ElementIndex) ||
+                   Buckets[BucketIndex].DistAndFingerprint == 0)
+            {
+                BucketIndex = (BucketIndex + 1) & BucketMask();
+            }
+            return static_cast<int32>(BucketIndex);
+        }
+
+        /** 새 버킷 배치 (가까운 버킷을 밀어내며 뒤로 이동) */
+        void PlaceBucket(uint64 KeyHash, uint32 ElementIndex)
+        {
+            FBucket Incoming{ Fingerprint(KeyHash), ElementIndex };
+            uint32 BucketIndex = HomeBucket(KeyHash);
+
+            while (Incoming.DistAndFingerprint <= Buckets[BucketIndex].DistAndFingerprint)
+            {
+                Incoming.DistAndFingerprint += DistInc;
+                BucketIndex = (BucketIndex + 1) & BucketMask();
+            }
+
+            while (Buckets[BucketIndex].DistAndFingerprint != 0)
+            {
+                std::swap(Incoming, Buckets[BucketIndex]);
+                Incoming.DistAndFingerprint += DistInc;
+                BucketIndex = (BucketIndex + 1) & BucketMask();
+            }
+            Buckets[BucketIndex] = Incoming;
+        }
+
+        /** 버킷 제거 (뒤쪽 버킷을 당겨옴) + 요소 배열에서 swap-remove */
+        void RemoveBucket(int32 InBucketIndex)
+        {
+            uint32 BucketIndex = static_cast<uint32>(InBucketIndex);
+            const uint32 RemovedElement = Buckets[BucketIndex].ElementIndex;
+
+            uint32 NextIndex = (BucketIndex + 1) & BucketMask();
+            while (Buckets[NextIndex].DistAndFingerprint >= DistInc * 2)
+            {
+                Buckets[BucketIndex] = { Buckets[NextIndex].DistAndFingerprint - DistInc, Buckets[NextIndex].ElementIndex };
+                BucketIndex = NextIndex;
+                NextIndex = (NextIndex + 1) & BucketMask();
+            }
+            Buckets[BucketIndex] = {};
+
+            // 마지막 요소를 빈 자리로 옮기고 그 버킷의 인덱스 갱신
+            const uint32 LastElement = static_cast<uint32>(Elements.Num() - 1);
+            if (RemovedElement != LastElement)
+            {
+                Buckets[FindBucketOfElement(static_cast<int32>(LastElement))].ElementIndex = RemovedElement;
+                Elements[RemovedElement] = std::move(Elements[LastElement]);
+                ElementHashes[RemovedElement] = ElementHashes[LastElement];
+            }
+            Elements.pop_back();
+            ElementHashes.pop_back();
+        }
+
+        void Rehash(SIZE_T NewBucketCount)
+        {
+            Buckets.assign(NewBucketCount, FBucket{});
+            for (int32 i = 0; i < ElementHashes.Num(); ++i)
+            {
+                PlaceBucket(ElementHashes[i], static_cast<uint32>(i));
+            }
+        }
+
+        TArray<uint64> ElementHashes;
+        TArray<FBucket> Buckets;
+    };
+}
+
+/** TFlatMap - 오픈 어드레싱 연관 컨테이너 (TMap과 같은 API) */
+template<typename KeyType, typename ValueType, typename Hasher = std::hash<KeyType>>
+class TFlatMap : public FlatHash::TFlatHashTable<std::pair<KeyType, ValueType>, FlatHash::TMapKeyFuncs<KeyType, ValueType>, Hasher>
+{
+    using Super = FlatHash::TFlatHashTable<std::pair<KeyType, ValueType>, FlatHash::TMapKeyFuncs<KeyType, ValueType>, Hasher>;
+
+public:
+    using key_type = KeyType;
+    using mapped_type = ValueType;
+    using value_type = std::pair<KeyType, ValueType>;
+    using typename Super::iterator;
+    using typename Super::const_iterator;
+
+    TFlatMap() = default;
+
+    TFlatMap(std::initializer_list<value_type> InitList)
+    {
+        this->Reserve(static_cast<int32>(InitList.size()));
+        for (const value_type& Pair : InitList)
+        {
+            Add(Pair.first, Pair.second);
+        }
+    }
+
+    /** 요소 추가/수정 */
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        AddByHash(Super::HashKey(Key), Key, Value);
+    }
+
+    void AddByHash(uint64 KeyHash, const KeyType& Key, const ValueType& Value)
+    {
+        FindOrAddByHash(KeyHash, Key) = Value;
+    }
+
+    template<typename... Args>
+    void Emplace(const KeyType& Key, Args&&... args)
+    {
+        TryEmplace(Key, std::forward<Args>(args)...);
+    }
+
+    /** 키가 없으면 기본값으로 추가하고 값 참조 반환 */
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        return FindOrAddByHash(Super::HashKey(Key), Key);
+    }
+
+    ValueType& FindOrAddByHash(uint64 KeyHash, const KeyType& Key)
+    {
+        const std::pair<int32, bool> Result = Super::FindOrAdd(Key, KeyHash, [&]()
+        {
+            this->Elements.emplace_back(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple());
+        });
+        return this->Elements[Result.first].second;
+    }
+
+    ValueType& operator[](const KeyType& Key)
+    {
+        return FindOrAdd(Key);
+    }
+
+    /** 검색 */
+    ValueType* Find(const KeyType& Key)
+    {
+        return FindByHash(Super::HashKey(Key), Key);
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        return FindByHash(Super::HashKey(Key), Key);
+    }
+
+    /** 미리 계산한 해시(HashKey)로 검색 */
+    ValueType* FindByHash(uint64 KeyHash, const KeyType& Key)
+    {
+        const int32 Index = this->FindElementIndex(Key, KeyHash);
+        return Index != Super::NoIndex ? &this->Elements[Index].second : nullptr;
+    }
+
+    const ValueType* FindByHash(uint64 KeyHash, const KeyType& Key) const
+    {
+        const int32 Index = this->FindElementIndex(Key, KeyHash);
+        return Index != Super::NoIndex ? &this->Elements[Index].second : nullptr;
+    }
+
+    /** 찾거나 기본값 반환 */
+    ValueType FindRef(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        return Value ? *Value : ValueType{};
+    }
+
+    ValueType& at(const KeyType& Key)
+    {
+        ValueType* Value = Find(Key);
+        if (!Value)
+        {
+            throw std::out_of_range("TFlatMap::at");
+        }
+        return *Value;
+    }
+
+    const ValueType& at(const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        if (!Value)
+        {
+            throw std::out_of_range("TFlatMap::at");
+        }
+        return *Value;
+    }
+
+    /** STL 호환 삽입 (이미 있으면 기존 값 유지) */
+    std::pair<iterator, bool> insert(const value_type& Pair)
+    {
+        return TryEmplace(Pair.first, Pair.second);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(const KeyType& Key, Args&&... args)
+    {
+        return TryEmplace(Key, std::forward<Args>(args)...);
+    }
+
+    /** 키/값 배열 반환 */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Keys;
+        Keys.Reserve(this->Num());
+        for (const value_type& Pair : this->Elements)
+        {
+            Keys.Add(Pair.first);
+        }
+        return Keys;
+    }
+
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Values;
+        Values.Reserve(this->Num());
+        for (const value_type& Pair : this->Elements)
+        {
+            Values.Add(Pair.second);
+        }
+        return Values;
+    }
+
+private:
+    template<typename... Args>
+    std::pair<iterator, bool> TryEmplace(const KeyType& Key, Args&&... args)
+    {
+        const std::pair<int32, bool> Result = Super::FindOrAdd(Key, Super::HashKey(Key), [&]()
+        {
+            this->Elements.emplace_back(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<Args>(args)...));
+        });
+        return { this->Elements.begin() + Result.first, Result.second };
+    }
+};
+
+/** TFlatSet - 오픈 어드레싱 집합 (TSet과 같은 API, 순회는 읽기 전용) */
+template<typename T, typename Hasher = std::hash<T>>
+class TFlatSet : public FlatHash::TFlatHashTable<T, FlatHash::TSetKeyFuncs<T>, Hasher>
+{
+    using Super = FlatHash::TFlatHashTable<T, FlatHash::TSetKeyFuncs<T>, Hasher>;
+
+public:
+    using key_type = T;
+    using value_type = T;
+    using iterator = typename Super::const_iterator;
+    using const_iterator = typename Super::const_iterator;
+
+    TFlatSet() = default;
+
+    TFlatSet(std::initializer_list<T> InitList)
+    {
+        this->Reserve(static_cast<int32>(InitList.size()));
+        for (const T& Item : InitList)
+        {
+            Add(Item);
+        }
+    }
+
+    /** 키를 수정하면 해시가 깨지므로 const 순회만 허용 */
+    const_iterator begin() const { return Super::begin(); }
+    const_iterator end() const { return Super::end(); }
+
+    /** 요소 추가 */
+    void Add(const T& Item)
+    {
+        insert(Item);
+    }
+
+    void AddByHash(uint64 KeyHash, const T& Item)
+    {
+        Super::FindOrAdd(Item, KeyHash, [&]() { this->Elements.push_back(Item); });
+    }
+
+    /** STL 호환 삽입 */
+    std::pair<const_iterator, bool> insert(const T& Item)
+    {
+        const std::pair<int32, bool> Result = Super::FindOrAdd(Item, Super::HashKey(Item), [&]() { this->Elements.push_back(Item); });
+        return { this->Elements.cbegin() + Result.first, Result.second };
+    }
+
+    const_iterator find(const T& Item) const
+    {
+        return Super::find(Item);
+    }
+
+    /** 미리 계산한 해시(HashKey)로 검색 */
+    bool ContainsByHash(uint64 KeyHash, const T& Item) const
+    {
+        return this->FindElementIndex(Item, KeyHash) != Super::NoIndex;
+    }
+
+    /** 집합 연산 */
+    TFlatSet Union(const TFlatSet& Other) const
+    {
+        TFlatSet Result = *this;
+        for (const T& Item : Other)
+        {
+            Result.Add(Item);
+        }
+        return Result;
+    }
+
+    TFlatSet Intersect(const TFlatSet& Other) const
+    {
+        TFlatSet Result;
+        for (const T& Item : *this)
+        {
+            if (Other.Contains(Item))
+            {
+                Result.Add(Item);
+            }
+        }
+        return Result;
+    }
+
+    TFlatSet Difference(const TFlatSet& Other) const
+    {
+        TFlatSet Result;
+        for (const T& Item : *this)
+        {
+            if (!Other.Contains(Item))
+            {
+                Result.Add(Item);
+            }
+        }
+        return Result;
+    }
+
+    /** 배열로 변환 (요소가 이미 배열에 있으므로 복사만) */
+    TArray<T> Array() const
+    {
+        return TArray<T>(this->Elements.begin(), this->Elements.end());
+    }
+};
@@ -71,12 +71,12 @@ using TPair = std::pair<T1, T2>;
 template<typename T, SIZE_T N>
 using TStaticArray = std::array<T, N>;
 
-/** TArray 구현 */
-template<typename T>
-class TArray : public std::vector<T>
+/** TArray 구현 (AllocatorType: 프레임 아레나 등 커스텀 STL 할당기 지정용) */
+template<typename T, typename AllocatorType = std::allocator<T>>
+class TArray : public std::vector<T, AllocatorType>
 {
 public:
-    using std::vector<T>::vector; /** 생성자 상속 */
+    using std::vector<T, AllocatorType>::vector; /** 생성자 상속 */
 
     /** 요소 추가 */
     int32 Add(const T& Item)
@@ -104,7 +104,8 @@ public:
     }
 
     /** 배열 병합 */
-    void Append(const TArray<T>& Other)
+    template<typename OtherAllocatorType>
+    void Append(const TArray<T, OtherAllocatorType>& Other)
     {
         this->insert(this->end(), Other.begin(), Other.end());
     }
@@ -266,6 +267,13 @@ public:
         std::sort(this->begin(), this->end(), Pred);
     }
 
+    /** 안정 정렬 (같은 순위의 요소는 기존 순서 유지) */
+    template<typename Predicate>
+    void StableSort(Predicate Pred)
+    {
+        std::stable_sort(this->begin(), this->end(), Pred);
+    }
+
     /** 두 요소 위치 교환 */
     void Swap(int32 IndexA, int32 IndexB)
     {
@@ -276,6 +284,320 @@ public:
     }
 };
 
+/**
+ * TInlineArray - 소형 버퍼 배열
+ * InlineCapacity개까지는 객체 내부 버퍼에 저장하고, 넘어설 때만 힙으로 옮김
+ * 보통 몇 개 안 되는 짧은 임시 목록(자식 컴포넌트 복사본 등)에서 힙 할당을 없애는 용도
+ * TArray와 같은 Add/Emplace/RemoveAt API 제공 (std::vector 기반이 아니므로 STL 멤버 함수는 없음)
+ */
+template<typename T, int32 InlineCapacity>
+class TInlineArray
+{
+    static_assert(InlineCapacity > 0, "TInlineArray requires InlineCapacity > 0");
+
+public:
+    TInlineArray()
+        : Data(GetInlineData()), ArrayNum(0), ArrayMax(InlineCapacity)
+    {
+    }
+
+    TInlineArray(std::initializer_list<T> InitList)
+        : TInlineArray()
+    {
+        AppendRange(InitList.begin(), InitList.end(), static_cast<int32>(InitList.size()));
+    }
+
+    template<typename OtherAllocatorType>
+    TInlineArray(const TArray<T, OtherAllocatorType>& Other)
+        : TInlineArray()
+    {
+        AppendRange(Other.begin(), Other.end(), Other.Num());
+    }
+
+    TInlineArray(const TInlineArray& Other)
+        : TInlineArray()
+    {
+        AppendRange(Other.begin(), Other.end(), Other.Num());
+    }
+
+    TInlineArray(TInlineArray&& Other) noexcept
+        : TInlineArray()
+    {
+        MoveFrom(Other);
+    }
+
+    ~TInlineArray()
+    {
+        Empty();
+        ReleaseHeap();
+    }
+
+    TInlineArray& operator=(const TInlineArray& Other)
+    {
+        if (this != &Other)
+        {
+            Empty();
+            AppendRange(Other.begin(), Other.end(), Other.Num());
+        }
+        return *this;
+    }
+
+    TInlineArray& operator=(TInlineArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Empty();
+            ReleaseHeap();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    /** 요소 추가 */
+    int32 Add(const T& Item)
+    {
+        return Emplace(Item);
+    }
+
+    int32 Add(T&& Item)
+    {
+        return Emplace(std::move(Item));
+    }
+
+    template<typename... Args>
+    int32 Emplace(Args&&... args)
+    {
+        if (ArrayNum == ArrayMax)
+        {
+            // 인자가 자기 원소를 참조할 수 있으므로 재할당 전에 먼저 생성
+            T Temp(std::forward<Args>(args)...);
+            Grow(ArrayNum + 1);
+            new (Data + ArrayNum) T(std::move(Temp));
+        }
+        else
+        {
+            new (Data + ArrayNum) T(std::forward<Args>(args)...);
+        }
+        return ArrayNum++;
+    }
+
+    /** 고유 요소만 추가 */
+    int32 AddUnique(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        return Index != -1 ? Index : Add(Item);
+    }
+
+    /** 삽입 */
+    void Insert(const T& Item, int32 Index)
+    {
+        Emplace(Item);
+        std::rotate(Data + Index, Data + ArrayNum - 1, Data + ArrayNum);
+    }
+
+    /** 제거 (순서 보존) */
+    void RemoveAt(int32 Index, int32 Count = 1)
+    {
+        std::move(Data + Index + Count, Data + ArrayNum, Data + Index);
+        DestroyRange(ArrayNum - Count, ArrayNum);
+        ArrayNum -= Count;
+    }
+
+    /** 빠르게 제거 (순서 보존 X) */
+    void RemoveAtSwap(int32 Index)
+    {
+        const int32 LastIndex = ArrayNum - 1;
+        if (Index != LastIndex)
+        {
+            Data[Index] = std::move(Data[LastIndex]);
+        }
+        DestroyRange(LastIndex, ArrayNum);
+        --ArrayNum;
+    }
+
+    bool Remove(const T& Item)
+    {
+        const int32 Index = Find(Item);
+        if (Index == -1)
+        {
+            return false;
+        }
+        RemoveAt(Index);
+        return true;
+    }
+
+    /** 크기 관련 */
+    int32 Num() const { return ArrayNum; }
+    int32 Max() const { return ArrayMax; }
+    bool IsEmpty() const { return ArrayNum == 0; }
+
+    /** 힙으로 넘어가지 않고 내부 버퍼를 쓰는 중인지 */
+    bool IsInline() const { return Data == GetInlineData(); }
+
+    /** 요소만 비움 (확보한 힙 용량은 유지) */
+    void Empty()
+    {
+        DestroyRange(0, ArrayNum);
+        ArrayNum = 0;
+    }
+
+    void Reserve(int32 Capacity)
+    {
+        if (Capacity > ArrayMax)
+        {
+            Grow(Capacity);
+        }
+    }
+
+    void SetNum(int32 NewSize)
+    {
+        Reserve(NewSize);
+        for (int32 i = ArrayNum; i < NewSize; ++i)
+        {
+            new (Data + i) T();
+        }
+        if (NewSize < ArrayNum)
+        {
+            DestroyRange(NewSize, ArrayNum);
+        }
+        ArrayNum = NewSize;
+    }
+
+    /** 접근 */
+    T& operator[](int32 Index) { return Data[Index]; }
+    const T& operator[](int32 Index) const { return Data[Index]; }
+
+    T& Last() { return Data[ArrayNum - 1]; }
+    const T& Last() const { return Data[ArrayNum - 1]; }
+
+    T* GetData() { return Data; }
+    const T* GetData() const { return Data; }
+
+    /** Stack 기능 */
+    void Push(const T& Item)
+    {
+        Add(Item);
+    }
+
+    T Pop()
+    {
+        T Item = std::move(Data[ArrayNum - 1]);
+        DestroyRange(ArrayNum - 1, ArrayNum);
+        --ArrayNum;
+        return Item;
+    }
+
+    /** 검색 */
+    int32 Find(const T& Item) const
+    {
+        for (int32 i = 0; i < ArrayNum; ++i)
+        {
+            if (Data[i] == Item)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    bool Contains(const T& Item) const
+    {
+        return Find(Item) != -1;
+    }
+
+    /** 정렬 */
+    void Sort()
+    {
+        std::sort(begin(), end());
+    }
+
+    template<typename Predicate>
+    void Sort(Predicate Pred)
+    {
+        std::sort(begin(), end(), Pred);
+    }
+
+    /** range-for 지원 */
+    T* begin() { return Data; }
+    T* end() { return Data + ArrayNum; }
+    const T* begin() const { return Data; }
+    const T* end() const { return Data + ArrayNum; }
+
+private:
+    T* GetInlineData() { return reinterpret_cast<T*>(InlineStorage); }
+    const T* GetInlineData() const { return reinterpret_cast<const T*>(InlineStorage); }
+
+    template<typename IteratorType>
+    void AppendRange(IteratorType First, IteratorType Last, int32 Count)
+    {
+        Reserve(ArrayNum + Count);
+        for (; First != Last; ++First)
+        {
+            new (Data + ArrayNum) T(*First);
+            ++ArrayNum;
+        }
+    }
+
+    void Grow(int32 MinCapacity)
+    {
+        const int32 NewMax = std::max(MinCapacity, ArrayMax * 2);
+        T* NewData = std::allocator<T>().allocate(static_cast<SIZE_T>(NewMax));
+        for (int32 i = 0; i < ArrayNum; ++i)
+        {
+            new (NewData + i) T(std::move(Data[i]));
+        }
+        DestroyRange(0, ArrayNum);
+        ReleaseHeap();
+        Data = NewData;
+        ArrayMax = NewMax;
+    }
+
+    void ReleaseHeap()
+    {
+        if (!IsInline())
+        {
+            std::allocator<T>().deallocate(Data, static_cast<SIZE_T>(ArrayMax));
+            Data = GetInlineData();
+            ArrayMax = InlineCapacity;
+        }
+    }
+
+    void DestroyRange(int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            Data[i].~T();
+        }
+    }
+
+    /** Other를 비우며 요소를 가져옴 (힙 버퍼는 포인터만 넘기고, 내부 버퍼는 원소 단위로 이동) */
+    void MoveFrom(TInlineArray& Other)
+    {
+        if (!Other.IsInline())
+        {
+            Data = Other.Data;
+            ArrayNum = Other.ArrayNum;
+            ArrayMax = Other.ArrayMax;
+            Other.Data = Other.GetInlineData();
+            Other.ArrayNum = 0;
+            Other.ArrayMax = InlineCapacity;
+            return;
+        }
+
+        for (int32 i = 0; i < Other.ArrayNum; ++i)
+        {
+            new (Data + i) T(std::move(Other.Data[i]));
+        }
+        ArrayNum = Other.ArrayNum;
+        Other.Empty();
+    }
+
+    T* Data;
+    int32 ArrayNum;
+    int32 ArrayMax;
+    alignas(T) uint8 InlineStorage[sizeof(T) * InlineCapacity];
+};
+
 /** TSet - 해시 기반 집합 */
 template<typename T>
 class TSet : public std::unordered_set<T>
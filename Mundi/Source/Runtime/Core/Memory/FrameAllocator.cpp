@@ -0,0 +1,166 @@
+﻿#include "pch.h"
+#include "FrameAllocator.h"
+#include <malloc.h>
+
+namespace
+{
+	// 청크는 캐시 라인 단위로 정렬
+	constexpr SIZE_T FrameChunkAlignment = 64;
+
+	SIZE_T AlignUp(SIZE_T Value, SIZE_T Alignment)
+	{
+		return (Value + Alignment - 1) & ~(Alignment - 1);
+	}
+}
+
+// ──────────────────────────────
+// FFrameArena
+// ──────────────────────────────
+
+FFrameArena::FFrameArena(SIZE_T InChunkSize)
+	: ChunkSize(InChunkSize)
+{
+}
+
+FFrameArena::~FFrameArena()
+{
+	for (FChunk* Chunk : Chunks)
+	{
+		DestroyChunk(Chunk);
+	}
+	Chunks.Empty();
+	CurrentChunk = nullptr;
+}
+
+FFrameArena::FChunk* FFrameArena::CreateChunk(SIZE_T Capacity)
+{
+	FChunk* Chunk = new FChunk();
+	Chunk->Memory = static_cast<uint8*>(_aligned_malloc(Capacity, FrameChunkAlignment));
+	Chunk->Capacity = Chunk->Memory ? Capacity : 0;
+	return Chunk;
+}
+
+void FFrameArena::DestroyChunk(FChunk* Chunk)
+{
+	if (!Chunk)
+	{
+		return;
+	}
+	_aligned_free(Chunk->Memory);
+	delete Chunk;
+}
+
+void* FFrameArena::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	if (Size == 0)
+	{
+		Size = 1;
+	}
+
+	while (true)
+	{
+		FChunk* Chunk = CurrentChunk.load(std::memory_order_acquire);
+		if (Chunk)
+		{
+			const SIZE_T Base = reinterpret_cast<SIZE_T>(Chunk->Memory);
+			SIZE_T Offset = Chunk->Offset.load(std::memory_order_relaxed);
+			while (true)
+			{
+				const SIZE_T AlignedOffset = AlignUp(Base + Offset, Alignment) - Base;
+				if (AlignedOffset + Size > Chunk->Capacity)
+				{
+					break;
+				}
+				if (Chunk->Offset.compare_exchange_weak(Offset, AlignedOffset + Size, std::memory_order_relaxed))
+				{
+					return Chunk->Memory + AlignedOffset;
+				}
+			}
+		}
+
+		// 현재 청크가 부족 -> 새 청크 추가 후 재시도
+		Grow(Chunk, Size + Alignment);
+	}
+}
+
+void FFrameArena::Grow(FChunk* ExpectedChunk, SIZE_T MinCapacity)
+{
+	std::lock_guard<std::mutex> Guard(GrowLock);
+
+	// 다른 스레드가 이미 새 청크를 붙였으면 그대로 사용
+	if (CurrentChunk.load(std::memory_order_acquire) != ExpectedChunk)
+	{
+		return;
+	}
+
+	FChunk* NewChunk = CreateChunk(std::max(ChunkSize, AlignUp(MinCapacity, FrameChunkAlignment)));
+	if (!NewChunk->Memory)
+	{
+		DestroyChunk(NewChunk);
+		throw std::bad_alloc();
+	}
+
+	Chunks.Add(NewChunk);
+	CurrentChunk.store(NewChunk, std::memory_order_release);
+}
+
+void FFrameArena::Reset()
+{
+	if (Chunks.Num() > 1)
+	{
+		// 이번 프레임 최대 사용량만큼 한 청크로 합침
+		SIZE_T TotalCapacity = 0;
+		for (FChunk* Chunk : Chunks)
+		{
+			TotalCapacity += Chunk->Capacity;
+			DestroyChunk(Chunk);
+		}
+		Chunks.Empty();
+
+		ChunkSize = std::max(ChunkSize, TotalCapacity);
+		Chunks.Add(CreateChunk(ChunkSize));
+		CurrentChunk.store(Chunks[0], std::memory_order_release);
+		return;
+	}
+
+	if (Chunks.Num() == 1)
+	{
+		Chunks[0]->Offset.store(0, std::memory_order_relaxed);
+	}
+}
+
+SIZE_T FFrameArena::GetUsedBytes() const
+{
+	SIZE_T Used = 0;
+	for (FChunk* Chunk : Chunks)
+	{
+		Used += Chunk->Offset.load(std::memory_order_relaxed);
+	}
+	return Used;
+}
+
+SIZE_T FFrameArena::GetCapacityBytes() const
+{
+	SIZE_T Capacity = 0;
+	for (FChunk* Chunk : Chunks)
+	{
+		Capacity += Chunk->Capacity;
+	}
+	return Capacity;
+}
+
+// ──────────────────────────────
+// FFrameMemory
+// ──────────────────────────────
+
+FFrameMemory& FFrameMemory::GetInstance()
+{
+	static FFrameMemory Instance;
+	return Instance;
+}
+
+void FFrameMemory::EndFrame()
+{
+	++FrameNumber;
+	GetCurrentArena().Reset();
+}
@@ -0,0 +1,136 @@
+﻿#pragma once
+#include <atomic>
+#include <cstddef>
+#include "UEContainer.h"
+
+// ========================================================================================================
+// 프레임 메모리 - 한 프레임 동안만 쓰는 임시 데이터용 선형(Bump) 할당기
+// ========================================================================================================
+//
+// === 구조 ===
+// - FFrameArena: 큰 청크에서 포인터만 밀어 할당. 개별 해제 없음, Reset()으로 통째로 비움
+// - FFrameMemory: 아레나 2개를 번갈아 사용 (더블 버퍼)
+//   프레임 N에 할당한 데이터는 프레임 N+1이 끝날 때까지 유효 -> 다음 프레임에서 소비해도 안전
+// - TFrameAllocator / TFrameArray: 현재 프레임 아레나에 바인딩되는 STL 할당기 / TArray
+//
+// === 주의 ===
+// - 멤버 변수 등 2프레임 이상 살아남는 곳에 TFrameArray를 두면 안 됨 (FSceneRenderer처럼 프레임 임시 객체만)
+// - 아레나에서 New<T>()로 만든 객체는 소멸자가 호출되지 않음
+// ========================================================================================================
+
+class FFrameArena
+{
+public:
+	static constexpr SIZE_T DefaultChunkSize = 4 * 1024 * 1024;
+
+	explicit FFrameArena(SIZE_T InChunkSize = DefaultChunkSize);
+	~FFrameArena();
+
+	FFrameArena(const FFrameArena&) = delete;
+	FFrameArena& operator=(const FFrameArena&) = delete;
+
+	/** 스레드 안전 (현재 청크에서 CAS로 밀어 할당, 청크가 찰 때만 락) */
+	void* Allocate(SIZE_T Size, SIZE_T Alignment = alignof(std::max_align_t));
+
+	/** 아레나에 객체 생성 (소멸자 호출 안 됨) */
+	template<typename T, typename... Args>
+	T* New(Args&&... InArgs)
+	{
+		return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(InArgs)...);
+	}
+
+	/**
+	 * 모든 할당 무효화 (게임 스레드에서만, 할당 중인 스레드가 없을 때 호출)
+	 * 이번 프레임에 청크가 여러 개 필요했다면 하나로 합쳐 다음부터는 한 청크로 처리
+	 */
+	void Reset();
+
+	SIZE_T GetUsedBytes() const;
+	SIZE_T GetCapacityBytes() const;
+
+private:
+	struct FChunk
+	{
+		uint8* Memory = nullptr;
+		SIZE_T Capacity = 0;
+		std::atomic<SIZE_T> Offset{ 0 };
+	};
+
+	FChunk* CreateChunk(SIZE_T Capacity);
+	void DestroyChunk(FChunk* Chunk);
+	void Grow(FChunk* ExpectedChunk, SIZE_T MinCapacity);
+
+	std::atomic<FChunk*> CurrentChunk{ nullptr };
+	TArray<FChunk*> Chunks;
+	std::mutex GrowLock;
+	SIZE_T ChunkSize;
+};
+
+/**
+ * 더블 버퍼 프레임 메모리 (싱글톤)
+ * 엔진 메인 루프가 프레임 끝(Render 이후)에 EndFrame()을 호출
+ */
+class FFrameMemory
+{
+public:
+	static FFrameMemory& GetInstance();
+
+	FFrameArena& GetCurrentArena() { return Arenas[FrameNumber & 1]; }
+	uint64 GetFrameNumber() const { return FrameNumber; }
+
+	/** AllocFrame에 할당된 데이터가 아직 유효한지 (이번 프레임 또는 직전 프레임) */
+	bool IsFrameDataValid(uint64 AllocFrame) const { return AllocFrame + 1 >= FrameNumber; }
+
+	/** 프레임 전환: 2프레임 전 아레나를 비우고 현재 아레나로 사용 */
+	void EndFrame();
+
+private:
+	FFrameMemory() = default;
+	~FFrameMemory() = default;
+	FFrameMemory(const FFrameMemory&) = delete;
+	FFrameMemory& operator=(const FFrameMemory&) = delete;
+
+	FFrameArena Arenas[2];
+	uint64 FrameNumber = 0;
+};
+
+/**
+ * 프레임 아레나 STL 할당기
+ * 생성 시점의 현재 프레임 아레나에 바인딩됨. deallocate는 아무것도 하지 않음 (Reset에서 일괄 회수)
+ */
+template<typename T>
+class TFrameAllocator
+{
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	TFrameAllocator() noexcept : Arena(&FFrameMemory::GetInstance().GetCurrentArena()) {}
+	explicit TFrameAllocator(FFrameArena& InArena) noexcept : Arena(&InArena) {}
+
+	template<typename U>
+	TFrameAllocator(const TFrameAllocator<U>& Other) noexcept : Arena(Other.GetArena()) {}
+
+	T* allocate(SIZE_T Count)
+	{
+		return static_cast<T*>(Arena->Allocate(Count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, SIZE_T) noexcept {}
+
+	FFrameArena* GetArena() const { return Arena; }
+
+	template<typename U>
+	bool operator==(const TFrameAllocator<U>& Other) const { return Arena == Other.GetArena(); }
+	template<typename U>
+	bool operator!=(const TFrameAllocator<U>& Other) const { return Arena != Other.GetArena(); }
+
+private:
+	FFrameArena* Arena;
+};
+
+/** 프레임 아레나를 쓰는 TArray (프레임 임시 목록용) */
+template<typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
@@ -4,27 +4,365 @@
 #include <malloc.h>
 #include <algorithm>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+std::atomic<uint64> FMemoryManager::TotalAllocationBytes{ 0 };
+std::atomic<uint64> FMemoryManager::TotalAllocationCount{ 0 };
+std::atomic<uint64> FMemoryManager::LargeAllocationBytes{ 0 };
+std::atomic<uint64> FMemoryManager::LargeAllocationCount{ 0 };
 
-void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+namespace
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	// ──────────────────────────────
+	// 블록 헤더 (모든 할당 앞에 16바이트)
+	// ──────────────────────────────
+	constexpr uint32 LargeBlockClass = 0xFFFFFFFFu;
+	constexpr SIZE_T SmallBlockAlignment = 16;
+
+	struct alignas(16) FAllocHeader
+	{
+		uint32 SizeClass;    // 소형 블록이면 클래스 인덱스, 대형이면 LargeBlockClass
+		uint32 RawOffset;    // 대형 블록: Raw 포인터부터 사용자 포인터까지 거리
+		SIZE_T Size;         // 요청 크기
+	};
+	static_assert(sizeof(FAllocHeader) == 16, "FAllocHeader must stay 16 bytes to keep user pointers aligned");
+
+	FAllocHeader* GetHeader(void* UserPtr)
+	{
+		return reinterpret_cast<FAllocHeader*>(static_cast<unsigned char*>(UserPtr) - sizeof(FAllocHeader));
+	}
+
+	// ──────────────────────────────
+	// 사이즈 클래스 테이블
+	// ──────────────────────────────
+	constexpr uint32 SizeClassTable[] =
+	{
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256, 320, 384, 448, 512,
+		640, 768, 896, 1024
+	};
+	constexpr int32 NumSizeClasses = static_cast<int32>(sizeof(SizeClassTable) / sizeof(SizeClassTable[0]));
+	static_assert(SizeClassTable[NumSizeClasses - 1] == FMemoryManager::MaxSmallBlockSize, "Last size class must match MaxSmallBlockSize");
+
+	constexpr SIZE_T SlabSize = 64 * 1024;
+
+	// 16바이트 단위 크기 -> 사이즈 클래스 인덱스 (Size 0~1024, 65개 버킷)
+	struct FSizeClassLookup
+	{
+		uint8 Index[FMemoryManager::MaxSmallBlockSize / 16 + 1];
+
+		FSizeClassLookup()
+		{
+			int32 Class = 0;
+			for (int32 Bucket = 0; Bucket <= static_cast<int32>(FMemoryManager::MaxSmallBlockSize / 16); ++Bucket)
+			{
+				while (SizeClassTable[Class] < static_cast<uint32>(Bucket * 16))
+				{
+					++Class;
+				}
+				Index[Bucket] = static_cast<uint8>(Class);
+			}
+		}
+	};
+
+	int32 GetSizeClassIndex(SIZE_T Size)
+	{
+		static const FSizeClassLookup Lookup;
+		return Lookup.Index[(Size + 15) >> 4];
+	}
 
+	SIZE_T GetBlockStride(int32 ClassIndex)
+	{
+		return sizeof(FAllocHeader) + SizeClassTable[ClassIndex];
+	}
+
+	// 스레드 캐시가 한 번에 전역 풀에서 가져오는/돌려주는 블록 수
+	int32 GetBatchCount(int32 ClassIndex)
+	{
+		return std::clamp(static_cast<int32>(8192 / GetBlockStride(ClassIndex)), 8, 128);
+	}
+
+	void* SystemAlloc(SIZE_T Size, SIZE_T Alignment)
+	{
+#if defined(_MSC_VER) && defined(_DEBUG)
+		return _aligned_malloc_dbg(Size, Alignment, nullptr, 0);
+#else
+		return _aligned_malloc(Size, Alignment);
+#endif
+	}
+
+	void SystemFree(void* Ptr)
+	{
 #if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
+		_aligned_free_dbg(Ptr);
 #else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
+		_aligned_free(Ptr);
 #endif
-	if (!Raw)
+	}
+
+	// ──────────────────────────────
+	// 전역 사이즈 클래스 풀 (스레드 캐시가 비거나 넘칠 때만 락)
+	// ──────────────────────────────
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	struct FSizeClassPool
+	{
+		std::mutex Lock;
+		FFreeBlock* FreeList = nullptr;
+		TArray<void*> Slabs;
+
+		// 통계
+		std::atomic<uint64> ActiveBlocks{ 0 };
+		std::atomic<uint64> TotalAllocations{ 0 };
+		std::atomic<uint64> ReservedBytes{ 0 };
+	};
+
+	struct FSmallBlockAllocator
+	{
+		FSizeClassPool Pools[NumSizeClasses];
+
+		// 새 슬랩을 잘라 FreeList에 연결 (Lock 잡은 상태에서 호출)
+		bool AddSlab(int32 ClassIndex)
+		{
+			FSizeClassPool& Pool = Pools[ClassIndex];
+			unsigned char* Slab = static_cast<unsigned char*>(SystemAlloc(SlabSize, SmallBlockAlignment));
+			if (!Slab)
+			{
+				return false;
+			}
+			Pool.Slabs.Add(Slab);
+			Pool.ReservedBytes.fetch_add(SlabSize, std::memory_order_relaxed);
+
+			const SIZE_T Stride = GetBlockStride(ClassIndex);
+			const SIZE_T NumBlocks = SlabSize / Stride;
+
+			// 헤더의 클래스 정보는 슬랩을 자를 때 한 번만 기록
+			for (SIZE_T i = NumBlocks; i-- > 0;)
+			{
+				unsigned char* Block = Slab + i * Stride;
+				FAllocHeader* Header = reinterpret_cast<FAllocHeader*>(Block);
+				Header->SizeClass = static_cast<uint32>(ClassIndex);
+				Header->RawOffset = 0;
+				Header->Size = 0;
+
+				FFreeBlock* Free = reinterpret_cast<FFreeBlock*>(Block + sizeof(FAllocHeader));
+				Free->Next = Pool.FreeList;
+				Pool.FreeList = Free;
+			}
+			return true;
+		}
+
+		// 최대 Count개 블록을 연결 리스트로 가져감
+		int32 Refill(int32 ClassIndex, int32 Count, FFreeBlock*& OutHead)
+		{
+			FSizeClassPool& Pool = Pools[ClassIndex];
+			std::lock_guard<std::mutex> Guard(Pool.Lock);
+
+			if (!Pool.FreeList && !AddSlab(ClassIndex))
+			{
+				OutHead = nullptr;
+				return 0;
+			}
+
+			OutHead = Pool.FreeList;
+			FFreeBlock* Tail = Pool.FreeList;
+			int32 Taken = 1;
+			while (Taken < Count && Tail->Next)
+			{
+				Tail = Tail->Next;
+				++Taken;
+			}
+			Pool.FreeList = Tail->Next;
+			Tail->Next = nullptr;
+			return Taken;
+		}
+
+		// [Head..Tail] 리스트를 전역 풀로 반환
+		void Release(int32 ClassIndex, FFreeBlock* Head, FFreeBlock* Tail)
+		{
+			FSizeClassPool& Pool = Pools[ClassIndex];
+			std::lock_guard<std::mutex> Guard(Pool.Lock);
+			Tail->Next = Pool.FreeList;
+			Pool.FreeList = Head;
+		}
+	};
+
+	// 정적 소멸 순서와 무관하게 살아있도록 의도적으로 해제하지 않음
+	// (스레드 캐시 소멸자가 프로세스 종료 시점에 블록을 반환할 수 있음)
+	FSmallBlockAllocator& GetSmallBlockAllocator()
+	{
+		static FSmallBlockAllocator* Allocator = new FSmallBlockAllocator();
+		return *Allocator;
+	}
+
+	// ──────────────────────────────
+	// 스레드 로컬 캐시 (락 없음)
+	// ──────────────────────────────
+	struct FThreadCache
+	{
+		FFreeBlock* Heads[NumSizeClasses] = {};
+		int32 Counts[NumSizeClasses] = {};
+		bool bShutdown = false;
+
+		~FThreadCache()
+		{
+			FSmallBlockAllocator& Allocator = GetSmallBlockAllocator();
+			for (int32 ClassIndex = 0; ClassIndex < NumSizeClasses; ++ClassIndex)
+			{
+				FFreeBlock* Head = Heads[ClassIndex];
+				if (!Head)
+				{
+					continue;
+				}
+				FFreeBlock* Tail = Head;
+				while (Tail->Next)
+				{
+					Tail = Tail->Next;
+				}
+				Allocator.Release(ClassIndex, Head, Tail);
+				Heads[ClassIndex] = nullptr;
+				Counts[ClassIndex] = 0;
+			}
+			bShutdown = true;
+		}
+
+		FFreeBlock* Pop(int32 ClassIndex)
+		{
+			if (!Heads[ClassIndex])
+			{
+				Counts[ClassIndex] = GetSmallBlockAllocator().Refill(ClassIndex, GetBatchCount(ClassIndex), Heads[ClassIndex]);
+				if (!Heads[ClassIndex])
+				{
+					return nullptr;
+				}
+			}
+
+			FFreeBlock* Block = Heads[ClassIndex];
+			Heads[ClassIndex] = Block->Next;
+			--Counts[ClassIndex];
+			return Block;
+		}
+
+		void Push(int32 ClassIndex, FFreeBlock* Block)
+		{
+			Block->Next = Heads[ClassIndex];
+			Heads[ClassIndex] = Block;
+
+			// 캐시가 배치 2개 분량을 넘으면 한 배치를 전역 풀로 돌려줌
+			const int32 BatchCount = GetBatchCount(ClassIndex);
+			if (++Counts[ClassIndex] > BatchCount * 2)
+			{
+				FFreeBlock* Head = Heads[ClassIndex];
+				FFreeBlock* Tail = Head;
+				for (int32 i = 1; i < BatchCount; ++i)
+				{
+					Tail = Tail->Next;
+				}
+				Heads[ClassIndex] = Tail->Next;
+				Counts[ClassIndex] -= BatchCount;
+				GetSmallBlockAllocator().Release(ClassIndex, Head, Tail);
+			}
+		}
+	};
+
+	thread_local FThreadCache GThreadCache;
+
+	void* AllocateSmall(int32 ClassIndex, SIZE_T Size)
+	{
+		FFreeBlock* Block = nullptr;
+		FThreadCache& Cache = GThreadCache;
+		if (!Cache.bShutdown)
+		{
+			Block = Cache.Pop(ClassIndex);
+		}
+		else
+		{
+			// 스레드 종료 중(캐시 소멸 후) 할당은 전역 풀에서 직접
+			GetSmallBlockAllocator().Refill(ClassIndex, 1, Block);
+		}
+
+		if (!Block)
+		{
+			return nullptr;
+		}
+
+		FAllocHeader* Header = GetHeader(Block);
+		Header->Size = Size;
+
+		FSizeClassPool& Pool = GetSmallBlockAllocator().Pools[ClassIndex];
+		Pool.ActiveBlocks.fetch_add(1, std::memory_order_relaxed);
+		Pool.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+		return Block;
+	}
+
+	void DeallocateSmall(int32 ClassIndex, void* Ptr)
+	{
+		FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+		GetSmallBlockAllocator().Pools[ClassIndex].ActiveBlocks.fetch_sub(1, std::memory_order_relaxed);
+
+		FThreadCache& Cache = GThreadCache;
+		if (!Cache.bShutdown)
+		{
+			Cache.Push(ClassIndex, Block);
+		}
+		else
+		{
+			Block->Next = nullptr;
+			GetSmallBlockAllocator().Release(ClassIndex, Block, Block);
+		}
+	}
+
+	void* AllocateLarge(SIZE_T Size, SIZE_T Alignment)
+	{
+		// 헤더 뒤 사용자 포인터가 Alignment에 맞도록 헤더 영역을 Alignment 배수로 확보
+		const SIZE_T FinalAlignment = std::max(Alignment, SmallBlockAlignment);
+		const SIZE_T Offset = std::max(FinalAlignment, sizeof(FAllocHeader));
+
+		unsigned char* Raw = static_cast<unsigned char*>(SystemAlloc(Size + Offset, FinalAlignment));
+		if (!Raw)
+		{
+			return nullptr;
+		}
+
+		unsigned char* UserPtr = Raw + Offset;
+		FAllocHeader* Header = GetHeader(UserPtr);
+		Header->SizeClass = LargeBlockClass;
+		Header->RawOffset = static_cast<uint32>(Offset);
+		Header->Size = Size;
+
+		FMemoryManager::LargeAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
+		FMemoryManager::LargeAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		return UserPtr;
+	}
+
+	void DeallocateLarge(void* Ptr, const FAllocHeader* Header)
+	{
+		FMemoryManager::LargeAllocationBytes.fetch_sub(Header->Size, std::memory_order_relaxed);
+		FMemoryManager::LargeAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+		SystemFree(static_cast<unsigned char*>(Ptr) - Header->RawOffset);
+	}
+}
+
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	void* UserPtr = nullptr;
+	if (Size <= MaxSmallBlockSize && Alignment <= SmallBlockAlignment)
+	{
+		UserPtr = AllocateSmall(GetSizeClassIndex(Size), Size);
+	}
+	else
+	{
+		UserPtr = AllocateLarge(Size, Alignment);
+	}
+
+	if (!UserPtr)
 		return nullptr;
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	TotalAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	return UserPtr;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +370,47 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	const FAllocHeader* Header = GetHeader(Ptr);
+	TotalAllocationBytes.fetch_sub(Header->Size, std::memory_order_relaxed);
+	TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	if (Header->SizeClass == LargeBlockClass)
+	{
+		DeallocateLarge(Ptr, Header);
+	}
+	else
+	{
+		DeallocateSmall(static_cast<int32>(Header->SizeClass), Ptr);
+	}
+}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
-#else
-	_aligned_free(Raw);
-#endif
-}
\ No newline at end of file
+int32 FMemoryManager::GetNumSizeClasses()
+{
+	return NumSizeClasses;
+}
+
+FMemorySizeClassStats FMemoryManager::GetSizeClassStats(int32 ClassIndex)
+{
+	FMemorySizeClassStats Stats;
+	if (ClassIndex < 0 || ClassIndex >= NumSizeClasses)
+	{
+		return Stats;
+	}
+
+	const FSizeClassPool& Pool = GetSmallBlockAllocator().Pools[ClassIndex];
+	Stats.BlockSize = SizeClassTable[ClassIndex];
+	Stats.ActiveBlocks = Pool.ActiveBlocks.load(std::memory_order_relaxed);
+	Stats.TotalAllocations = Pool.TotalAllocations.load(std::memory_order_relaxed);
+	Stats.ReservedBytes = Pool.ReservedBytes.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+uint64 FMemoryManager::GetSmallBlockReservedBytes()
+{
+	uint64 Total = 0;
+	for (int32 ClassIndex = 0; ClassIndex < NumSizeClasses; ++ClassIndex)
+	{
+		Total += GetSmallBlockAllocator().Pools[ClassIndex].ReservedBytes.load(std::memory_order_relaxed);
+	}
+	return Total;
+}
@@ -1,7 +1,25 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
+/**
+ * 사이즈 클래스별 통계 (스냅샷)
+ */
+struct FMemorySizeClassStats
+{
+	uint32 BlockSize = 0;          // 사이즈 클래스 블록 크기 (헤더 제외)
+	uint64 ActiveBlocks = 0;       // 현재 사용 중인 블록 수
+	uint64 TotalAllocations = 0;   // 누적 할당 횟수
+	uint64 ReservedBytes = 0;      // 이 클래스가 확보한 슬랩 메모리 (바이트)
+};
+
+/**
+ * 엔진 메모리 할당기
+ * - 1 KiB 이하 & 16바이트 이하 정렬: 사이즈 클래스별 슬랩 풀 + 스레드 로컬 캐시 (락 없이 할당/해제)
+ * - 그 외: _aligned_malloc 대형 블록 폴백
+ * 슬랩은 한 번 확보하면 OS에 반환하지 않고 풀에서 재사용함
+ */
 class FMemoryManager
 {
 public:
@@ -9,7 +27,20 @@ public:
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
+	/** 소형 블록 풀이 처리하는 최대 크기 */
+	static constexpr SIZE_T MaxSmallBlockSize = 1024;
+
+	/** 사이즈 클래스 통계 조회 */
+	static int32 GetNumSizeClasses();
+	static FMemorySizeClassStats GetSizeClassStats(int32 ClassIndex);
+	static uint64 GetSmallBlockReservedBytes();
+
 public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	// 현재 사용 중인 바이트/할당 수 (모든 스레드에서 갱신되므로 atomic)
+	static std::atomic<uint64> TotalAllocationBytes;
+	static std::atomic<uint64> TotalAllocationCount;
+
+	// 대형 블록 폴백 경로 통계
+	static std::atomic<uint64> LargeAllocationBytes;
+	static std::atomic<uint64> LargeAllocationCount;
+};
@@ -2,28 +2,21 @@
 #include "pch.h"
 #include "PlatformTime.h"
 
-TMap<FString, FTimeProfile> TimeProfileMap;
-//Map에 이미 있으면 시간, 콜스택 추가
+TFlatMap<FString, FTimeProfile> TimeProfileMap;
+//Map에 이미 있으면 시간, 콜스택 추가 (FString 해시는 한 번만 계산)
 void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMilliseconds)
 {
-	if (TimeProfileMap.Contains(Key.Key) == false)
-	{
-		TimeProfileMap[Key.Key] = FTimeProfile{ InMilliseconds, 1 };
-	}
-	else
-	{
-		TimeProfileMap[Key.Key].Milliseconds += InMilliseconds;
-		TimeProfileMap[Key.Key].CallCount++;
-	}
+	FTimeProfile& Profile = TimeProfileMap.FindOrAdd(Key.Key);
+	Profile.Milliseconds += InMilliseconds;
+	Profile.CallCount++;
 }
 //시간, 콜스택 초기화
 void FScopeCycleCounter::TimeProfileInit()
 {
-	const TArray<FString> Keys = TimeProfileMap.GetKeys();
-	for (const FString& Key : Keys)
+	for (auto& Pair : TimeProfileMap)
 	{
-		TimeProfileMap[Key].Milliseconds = 0;
-		TimeProfileMap[Key].CallCount = 0;
+		Pair.second.Milliseconds = 0;
+		Pair.second.CallCount = 0;
 	}
 }
 //const TMap<FString, FTimeProfile>& FScopeCycleCounter::GetTimeProfiles()
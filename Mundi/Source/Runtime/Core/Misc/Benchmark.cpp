@@ -0,0 +1,45 @@
+﻿#include "pch.h"
+#include "Benchmark.h"
+
+namespace
+{
+	TArray<FBenchmark>& GetMutableBenchmarks()
+	{
+		// 다른 번역 단위의 정적 초기화에서 등록되므로 첫 사용 시 생성
+		static TArray<FBenchmark> Benchmarks;
+		return Benchmarks;
+	}
+}
+
+bool FBenchmarkRegistry::Register(const FBenchmark& Benchmark)
+{
+	GetMutableBenchmarks().Add(Benchmark);
+	return true;
+}
+
+const TArray<FBenchmark>& FBenchmarkRegistry::GetBenchmarks()
+{
+	return GetMutableBenchmarks();
+}
+
+bool FBenchmarkRegistry::Run(const char* Name)
+{
+	const bool bRunAll = _stricmp(Name, "ALL") == 0;
+
+	bool bRanAny = false;
+	for (const FBenchmark& Benchmark : GetMutableBenchmarks())
+	{
+		if (!bRunAll && _stricmp(Name, Benchmark.Name) != 0)
+		{
+			continue;
+		}
+
+		UE_LOG("[Benchmark] === %s: %s ===", Benchmark.Name, Benchmark.Description);
+		const uint64 Start = FWindowsPlatformTime::Cycles64();
+		Benchmark.Run();
+		UE_LOG("[Benchmark] %s finished in %.1f ms", Benchmark.Name,
+			FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - Start));
+		bRanAny = true;
+	}
+	return bRanAny;
+}
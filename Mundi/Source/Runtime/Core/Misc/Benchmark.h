@@ -0,0 +1,71 @@
+﻿#pragma once
+#include "PlatformTime.h"
+
+// ========================================================================================================
+// 엔진 내 마이크로 벤치마크 (콘솔 BENCH 명령)
+// ========================================================================================================
+//
+// - 각 벤치마크는 실제 엔진 코드(컨테이너, BVH, 파티클 모듈 등)를 그대로 호출해 측정하고 결과를 콘솔 로그로 출력
+// - 게임 스레드에서 동기로 돌기 때문에 실행 중 수 초간 멈출 수 있음 (수치는 Release 빌드 기준으로 볼 것)
+//
+// === 사용 예 ===
+//   BENCH            등록된 벤치마크 목록
+//   BENCH INLINEARRAY  이름이 일치하는 벤치마크 하나 실행 (대소문자 무시)
+//   BENCH ALL        전부 실행
+//
+// === 등록 ===
+//   static void RunMyBenchmark() { ... UE_LOG(...) ... }
+//   REGISTER_BENCHMARK("MYBENCH", "설명", RunMyBenchmark)
+// ========================================================================================================
+
+struct FBenchmark
+{
+	const char* Name;
+	const char* Description;
+	void (*Run)();
+};
+
+class FBenchmarkRegistry
+{
+public:
+	static bool Register(const FBenchmark& Benchmark);
+	static const TArray<FBenchmark>& GetBenchmarks();
+
+	/**
+	 * 이름이 일치하는 벤치마크 실행 ("ALL"이면 전부)
+	 * @return 실행한 벤치마크가 없으면 false
+	 */
+	static bool Run(const char* Name);
+};
+
+#define REGISTER_BENCHMARK(Name, Description, Function) \
+	static const bool Function##_Registered = FBenchmarkRegistry::Register({ Name, Description, Function });
+
+namespace Benchmark
+{
+	/**
+	 * Func를 Repeats번 실행해 가장 짧은 시간(ms)을 반환 (스케줄링 잡음 제거)
+	 * Func 안에서 매번 같은 입력으로 다시 시작해야 한다
+	 */
+	template<typename FuncType>
+	double MeasureBestMS(int32 Repeats, FuncType&& Func)
+	{
+		double Best = std::numeric_limits<double>::max();
+		for (int32 Repeat = 0; Repeat < Repeats; ++Repeat)
+		{
+			const uint64 Start = FWindowsPlatformTime::Cycles64();
+			Func();
+			const double Elapsed = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - Start);
+			Best = Elapsed < Best ? Elapsed : Best;
+		}
+		return Best;
+	}
+
+	// 측정 결과가 최적화로 사라지지 않도록 값을 소비
+	template<typename T>
+	void DoNotOptimize(const T& Value)
+	{
+		static volatile uint8 Sink;
+		Sink = *reinterpret_cast<const volatile uint8*>(&Value);
+	}
+}
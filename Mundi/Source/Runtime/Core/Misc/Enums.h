@@ -156,7 +156,7 @@ enum class EEngineShowFlags : uint64
 
     SF_OctreeDebug = 1ull << 7,  // Show/hide octree debug bounds
     SF_BVHDebug = 1ull << 8,  // Show/hide BVH debug bounds
-    SF_Culling = 1ull << 9,          // Show/hide world grid
+    SF_Culling = 1ull << 9,          // Enable/disable CPU occlusion culling
 
     SF_Decals = 1ull << 10,
     SF_Fog = 1ull << 11,
@@ -1,62 +1,169 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include "FlatHashContainer.h"
+#include <atomic>
+#include <shared_mutex>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    // 청크 하나에 들어가는 엔트리 수 / 최대 청크 수 (최대 약 400만 개 이름)
+    constexpr uint32 NameEntriesPerChunkShift = 12;
+    constexpr uint32 NameEntriesPerChunk = 1u << NameEntriesPerChunkShift;
+    constexpr uint32 MaxNameChunks = 1024;
+
+    // 문자열 -> 인덱스 검색 샤드 수 (2의 거듭제곱)
+    constexpr uint32 NumNameShards = 32;
+
+    // 샤드 맵 키: 대소문자 무시 비교 + 미리 계산한 해시
+    // Str은 등록된 엔트리의 Display를 가리키므로 청크가 해제되지 않는 한 유효
+    struct FNameKey
     {
-        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
-        // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
-    }
+        std::string_view Str;
+        uint32 Hash;
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+        bool operator==(const FNameKey& Other) const
+        {
+            if (Hash != Other.Hash || Str.size() != Other.Str.size())
+            {
+                return false;
+            }
+            for (SIZE_T i = 0; i < Str.size(); ++i)
+            {
+                if (std::tolower(static_cast<unsigned char>(Str[i])) != std::tolower(static_cast<unsigned char>(Other.Str[i])))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    struct FNameKeyHasher
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        size_t operator()(const FNameKey& Key) const noexcept { return Key.Hash; }
+    };
+
+    // 이미 등록된 이름 찾기는 공유 락, 새 이름 등록만 배타 락
+    struct FNameShard
+    {
+        std::shared_mutex Lock;
+        TFlatMap<FNameKey, uint32, FNameKeyHasher> Map;
+    };
+
+    struct FNameTable
+    {
+        std::atomic<FNameEntry*> Chunks[MaxNameChunks] = {};
+        std::atomic<uint32> NumEntries{ 0 };
+        std::mutex ChunkLock;
+        FNameShard Shards[NumNameShards];
+
+        // 범위 밖 인덱스용 (테이블과 함께 생성되므로 다른 전역 객체 초기화 중에도 안전)
+        const FNameEntry InvalidEntry = { "Invalid", 0 };
+
+        FNameEntry* GetOrCreateChunk(uint32 ChunkIndex)
+        {
+            FNameEntry* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+            if (Chunk)
+            {
+                return Chunk;
+            }
+
+            std::lock_guard<std::mutex> Guard(ChunkLock);
+            Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+            if (!Chunk)
+            {
+                Chunk = new FNameEntry[NameEntriesPerChunk];
+                Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+            }
+            return Chunk;
+        }
+    };
+
+    // 이름 테이블을 안전하게 가져오는 getter
+    // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게 단 한 번만 초기화됩니다.
+    // 정적 소멸 순서 문제를 피하기 위해 해제하지 않음 (다른 전역 객체 소멸자에서도 FName 사용 가능)
+    FNameTable& GetNameTable()
+    {
+        static FNameTable* GTable = new FNameTable();
+        return *GTable;
     }
+}
 
-    // FString을 소문자로 변환하는 헬퍼 함수
-    static FString ToLower(const FString& InStr)
+uint32 FNamePool::HashIgnoreCase(std::string_view InStr)
+{
+    // FNV-1a (소문자 기준)
+    uint32 Hash = 2166136261u;
+    for (char C : InStr)
     {
-        FString Result = InStr;
-        std::transform(Result.begin(), Result.end(), Result.begin(),
-            [](unsigned char c) { return std::tolower(c); });
-        return Result;
+        Hash ^= static_cast<uint32>(std::tolower(static_cast<unsigned char>(C)));
+        Hash *= 16777619u;
     }
+    return Hash;
 }
 
-uint32 FNamePool::Add(const FString& InStr)
+uint32 FNamePool::Add(std::string_view InStr)
 {
-    FString Lower = ToLower(InStr);
+    FNameTable& Table = GetNameTable();
 
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+    const uint32 Hash = HashIgnoreCase(InStr);
+    FNameShard& Shard = Table.Shards[Hash & (NumNameShards - 1)];
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    const FNameKey Key{ InStr, Hash };
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
+    {
+        std::shared_lock<std::shared_mutex> ReadGuard(Shard.Lock);
+        if (const uint32* Existing = Shard.Map.Find(Key))
+        {
+            return *Existing;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> WriteGuard(Shard.Lock);
+
+    // 락을 바꾸는 사이 다른 스레드가 같은 이름을 등록했을 수 있음
+    if (const uint32* Existing = Shard.Map.Find(Key))
+    {
+        return *Existing;
+    }
+
+    const uint32 NewIndex = Table.NumEntries.fetch_add(1, std::memory_order_relaxed);
+    const uint32 ChunkIndex = NewIndex >> NameEntriesPerChunkShift;
+    if (ChunkIndex >= MaxNameChunks)
+    {
+        UE_LOG("[FNamePool] Name table is full (%u entries)", NewIndex);
+        return static_cast<uint32>(-1);
+    }
+
+    FNameEntry& Entry = Table.GetOrCreateChunk(ChunkIndex)[NewIndex & (NameEntriesPerChunk - 1)];
+    Entry.Display.assign(InStr);
+    Entry.Hash = Hash;
+
+    // 키는 입력 문자열이 아니라 풀에 저장된 문자열을 가리켜야 함
+    Shard.Map.Add(FNameKey{ Entry.Display, Hash }, NewIndex);
     return NewIndex;
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    // 락 없이 읽음: 인덱스는 Add가 엔트리를 채운 뒤에만 밖으로 나가므로 안전
+    FNameTable& Table = GetNameTable();
 
     // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    const uint32 ChunkIndex = Index >> NameEntriesPerChunkShift;
+    if (Index >= Table.NumEntries.load(std::memory_order_acquire) || ChunkIndex >= MaxNameChunks)
+    {
+        return Table.InvalidEntry;
+    }
+
+    const FNameEntry* Chunk = Table.Chunks[ChunkIndex].load(std::memory_order_acquire);
+    if (!Chunk)
     {
-        static FNameEntry InvalidEntry = { "Invalid", "invalid" };
-        return InvalidEntry;
+        return Table.InvalidEntry;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+    return Chunk[Index & (NameEntriesPerChunk - 1)];
+}
+
+uint32 FNamePool::GetNumEntries()
+{
+    return GetNameTable().NumEntries.load(std::memory_order_acquire);
+}
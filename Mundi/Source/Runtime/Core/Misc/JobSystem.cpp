@@ -0,0 +1,312 @@
+﻿#include "pch.h"
+#include "JobSystem.h"
+
+struct FJob
+{
+	FJobFunction Function;
+	EJobPriority Priority = EJobPriority::Normal;
+
+	// 남은 선행 잡 수 (+1은 Launch 자체가 쥐고 있는 참조, 등록이 끝나면 해제)
+	std::atomic<int32> PendingPrerequisites{ 1 };
+	std::atomic<bool> bCompleted{ false };
+
+	// 이 잡이 끝나야 실행될 후속 잡들
+	std::mutex SubsequentsLock;
+	TArray<std::shared_ptr<FJob>> Subsequents;
+};
+
+namespace
+{
+	// 워커 스레드의 큐 인덱스 (워커가 아니면 0 = 외부 큐)
+	thread_local int32 GJobQueueIndex = 0;
+	thread_local bool GIsJobWorker = false;
+
+	// 일이 없을 때 잠들기 전까지 훔치기를 재시도하는 횟수
+	constexpr int32 SpinCountBeforeSleep = 64;
+}
+
+bool FJobHandle::IsComplete() const
+{
+	return !Job || Job->bCompleted.load(std::memory_order_acquire);
+}
+
+// ──────────────────────────────
+// FJobQueue
+// ──────────────────────────────
+
+void FJobSystem::FJobQueue::Push(std::shared_ptr<FJob> Job)
+{
+	std::lock_guard<std::mutex> Guard(Lock);
+	Jobs.push_back(std::move(Job));
+}
+
+bool FJobSystem::FJobQueue::Pop(std::shared_ptr<FJob>& OutJob)
+{
+	std::lock_guard<std::mutex> Guard(Lock);
+	if (Jobs.empty())
+	{
+		return false;
+	}
+	OutJob = std::move(Jobs.back());
+	Jobs.pop_back();
+	return true;
+}
+
+bool FJobSystem::FJobQueue::Steal(std::shared_ptr<FJob>& OutJob)
+{
+	std::lock_guard<std::mutex> Guard(Lock);
+	if (Jobs.empty())
+	{
+		return false;
+	}
+	OutJob = std::move(Jobs.front());
+	Jobs.pop_front();
+	return true;
+}
+
+// ──────────────────────────────
+// FJobSystem
+// ──────────────────────────────
+
+FJobSystem& FJobSystem::GetInstance()
+{
+	static FJobSystem Instance;
+	return Instance;
+}
+
+FJobSystem::~FJobSystem()
+{
+	Shutdown();
+}
+
+void FJobSystem::Initialize(int32 NumWorkers)
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	if (NumWorkers < 0)
+	{
+		// 게임 스레드 몫 하나를 남겨둠
+		const int32 LogicCores = static_cast<int32>(std::thread::hardware_concurrency());
+		NumWorkers = std::max(LogicCores - 1, 0);
+	}
+
+	bStopping = false;
+	Queues.Empty();
+	for (int32 i = 0; i < NumWorkers + 1; ++i)
+	{
+		Queues.Emplace(std::make_unique<FJobQueue>());
+	}
+	HighPriorityQueue = std::make_unique<FJobQueue>();
+
+	Workers.Reserve(NumWorkers);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.Emplace(&FJobSystem::WorkerMain, this, i + 1);
+	}
+
+	bInitialized = true;
+	UE_LOG("[JobSystem] Initialized with %d worker threads", NumWorkers);
+}
+
+void FJobSystem::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Guard(SleepLock);
+		bStopping = true;
+	}
+	SleepCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+
+	// 남은 잡은 호출 스레드에서 마저 처리 (Wait 중인 핸들이 영원히 끝나지 않는 것 방지)
+	while (TryExecuteOne(0)) {}
+
+	Queues.Empty();
+	HighPriorityQueue.reset();
+	NumQueuedJobs = 0;
+	bInitialized = false;
+}
+
+bool FJobSystem::IsInWorkerThread()
+{
+	return GIsJobWorker;
+}
+
+int32 FJobSystem::GetCurrentQueueIndex()
+{
+	return GJobQueueIndex;
+}
+
+FJobHandle FJobSystem::Launch(FJobFunction Function, const TArray<FJobHandle>& Prerequisites, EJobPriority Priority)
+{
+	std::shared_ptr<FJob> Job = std::make_shared<FJob>();
+	Job->Function = std::move(Function);
+	Job->Priority = Priority;
+
+	// 아직 안 끝난 선행 잡에 후속으로 등록
+	for (const FJobHandle& Prerequisite : Prerequisites)
+	{
+		if (!Prerequisite.Job)
+		{
+			continue;
+		}
+
+		std::lock_guard<std::mutex> Guard(Prerequisite.Job->SubsequentsLock);
+		if (!Prerequisite.Job->bCompleted.load(std::memory_order_acquire))
+		{
+			Job->PendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+			Prerequisite.Job->Subsequents.Add(Job);
+		}
+	}
+
+	// Launch 몫의 참조 해제. 선행 잡이 이미 모두 끝났다면 바로 큐에 넣음
+	if (Job->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Enqueue(Job);
+	}
+
+	return FJobHandle(Job);
+}
+
+void FJobSystem::Enqueue(std::shared_ptr<FJob> Job)
+{
+	// 워커가 없으면 즉시 실행 (싱글 스레드 폴백)
+	if (!bInitialized || Workers.empty())
+	{
+		Execute(Job);
+		return;
+	}
+
+	FJobQueue& Queue = Job->Priority == EJobPriority::High ? *HighPriorityQueue : *Queues[GetCurrentQueueIndex()];
+	Queue.Push(std::move(Job));
+	NumQueuedJobs.fetch_add(1, std::memory_order_release);
+
+	// 잠든 워커 하나 깨움 (락을 잡아야 Wait 직전 신호 유실이 없음)
+	{
+		std::lock_guard<std::mutex> Guard(SleepLock);
+	}
+	SleepCondition.notify_one();
+}
+
+bool FJobSystem::TryExecuteOne(int32 QueueIndex)
+{
+	if (Queues.IsEmpty())
+	{
+		return false;
+	}
+
+	std::shared_ptr<FJob> Job;
+
+	// High 우선순위 공용 큐 먼저 (FIFO), 다음은 자기 큐 (LIFO), 없으면 다른 큐에서 훔침 (FIFO)
+	bool bFound = HighPriorityQueue->Steal(Job) || Queues[QueueIndex]->Pop(Job);
+	const int32 NumQueues = Queues.Num();
+	for (int32 Offset = 1; !bFound && Offset < NumQueues; ++Offset)
+	{
+		bFound = Queues[(QueueIndex + Offset) % NumQueues]->Steal(Job);
+	}
+
+	if (!bFound)
+	{
+		return false;
+	}
+
+	NumQueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+	Execute(Job);
+	return true;
+}
+
+void FJobSystem::Execute(const std::shared_ptr<FJob>& Job)
+{
+	if (Job->Function)
+	{
+		Job->Function();
+		Job->Function = nullptr;	// 캡처된 리소스 즉시 해제
+	}
+
+	// 완료 표시 후 후속 잡을 가져옴 (락 안에서 표시해야 Launch와 경합 없음)
+	TArray<std::shared_ptr<FJob>> ReadySubsequents;
+	{
+		std::lock_guard<std::mutex> Guard(Job->SubsequentsLock);
+		Job->bCompleted.store(true, std::memory_order_release);
+		ReadySubsequents.swap(Job->Subsequents);
+	}
+
+	for (std::shared_ptr<FJob>& Subsequent : ReadySubsequents)
+	{
+		if (Subsequent->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Enqueue(std::move(Subsequent));
+		}
+	}
+}
+
+void FJobSystem::Wait(const FJobHandle& Handle)
+{
+	const int32 QueueIndex = GetCurrentQueueIndex();
+	while (!Handle.IsComplete())
+	{
+		// 기다리는 동안 놀지 않고 다른 잡 처리
+		if (!TryExecuteOne(QueueIndex))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FJobSystem::WaitAll(const TArray<FJobHandle>& Handles)
+{
+	for (const FJobHandle& Handle : Handles)
+	{
+		Wait(Handle);
+	}
+}
+
+bool FJobSystem::ExecutePendingJob()
+{
+	return bInitialized && TryExecuteOne(GetCurrentQueueIndex());
+}
+
+void FJobSystem::WorkerMain(int32 QueueIndex)
+{
+	GJobQueueIndex = QueueIndex;
+	GIsJobWorker = true;
+
+	int32 IdleSpins = 0;
+	while (!bStopping.load(std::memory_order_acquire))
+	{
+		if (TryExecuteOne(QueueIndex))
+		{
+			IdleSpins = 0;
+			continue;
+		}
+
+		if (++IdleSpins < SpinCountBeforeSleep)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		// 큐가 모두 비어있으면 새 잡이 들어올 때까지 잠듦
+		std::unique_lock<std::mutex> Guard(SleepLock);
+		SleepCondition.wait(Guard, [this]()
+		{
+			return bStopping.load(std::memory_order_acquire) || NumQueuedJobs.load(std::memory_order_acquire) > 0;
+		});
+		IdleSpins = 0;
+	}
+}
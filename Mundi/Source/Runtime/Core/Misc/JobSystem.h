@@ -0,0 +1,221 @@
+﻿#pragma once
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+
+// ========================================================================================================
+// FJobSystem - 엔진 공용 워크 스틸링(Work-Stealing) 잡 시스템 (싱글톤)
+// ========================================================================================================
+//
+// === 구조 ===
+// - 워커 스레드마다 전용 큐(Deque)를 가짐. 소유자는 뒤(Back)에서 Push/Pop (LIFO, 캐시 친화적)
+// - 일이 없는 워커는 다른 워커 큐의 앞(Front)에서 훔쳐감 (Steal, FIFO)
+// - 0번 큐는 워커가 아닌 스레드(게임 스레드 등)가 제출하는 잡을 받는 외부 큐
+// - High 우선순위 잡은 공용 큐 하나에 모이고 모든 스레드가 자기 큐보다 먼저 꺼내감 (FIFO)
+//
+// === 스레드 예산 ===
+// - 엔진 잡, PhysX 태스크(FPhysXJobDispatcher), 천 시뮬레이션 청크가 모두 이 워커들에서 돌아감
+// - 워커 수(editor.ini JobWorkerThreads)가 게임 스레드를 제외한 전체 작업 스레드 예산
+//
+// === 사용 예 ===
+//   FJobHandle A = GJobSystem.Launch([]{ ... });
+//   FJobHandle B = GJobSystem.Launch([]{ ... }, { A });   // A 완료 후 실행
+//   GJobSystem.Wait(B);
+//
+//   ParallelFor(Components.Num(), [&](int32 Index) { ... });
+//   ParallelFor(Components, [&](UPrimitiveComponent* Comp) { ... });
+//
+// === 주의 ===
+// - Wait()는 대기하는 동안 호출 스레드도 큐의 잡을 실행함 (게임 스레드가 놀지 않음)
+// - 잡 내부에서 UObject 생성/삭제, 월드 액터 목록 변경 금지 (게임 스레드 전용)
+// ========================================================================================================
+
+struct FJob;
+using FJobFunction = std::function<void()>;
+
+/**
+ * 잡 우선순위
+ * High: 다른 시스템이 결과를 기다리는 중인 잡 (PhysX 태스크 등), 모든 워커가 일반 잡보다 먼저 가져감
+ */
+enum class EJobPriority : uint8
+{
+	High,
+	Normal,
+};
+
+/**
+ * 잡 핸들
+ * 완료 여부 확인 및 다른 잡의 선행 조건(Prerequisite)으로 사용
+ */
+class FJobHandle
+{
+public:
+	FJobHandle() = default;
+
+	bool IsValid() const { return Job != nullptr; }
+	bool IsComplete() const;
+
+private:
+	friend class FJobSystem;
+	explicit FJobHandle(std::shared_ptr<FJob> InJob) : Job(std::move(InJob)) {}
+
+	std::shared_ptr<FJob> Job;
+};
+
+class FJobSystem
+{
+public:
+	static FJobSystem& GetInstance();
+
+	/**
+	 * 워커 스레드 생성
+	 * @param NumWorkers 워커 수, 음수면 (논리 코어 수 - 1) 사용. 0이면 모든 잡을 호출 스레드에서 즉시 실행
+	 */
+	void Initialize(int32 NumWorkers = -1);
+	void Shutdown();
+
+	/**
+	 * 잡 제출
+	 * @param Prerequisites 모두 완료된 뒤에 실행됨 (비어있으면 즉시 큐에 들어감)
+	 */
+	FJobHandle Launch(FJobFunction Function, const TArray<FJobHandle>& Prerequisites = {}, EJobPriority Priority = EJobPriority::Normal);
+
+	/** 잡 완료까지 대기 (대기 중에는 다른 잡을 대신 실행) */
+	void Wait(const FJobHandle& Handle);
+	void WaitAll(const TArray<FJobHandle>& Handles);
+
+	/** 큐에 있는 잡 하나를 호출 스레드에서 실행 (잡 시스템 밖의 완료를 기다리는 동안 돕기용), 없으면 false */
+	bool ExecutePendingJob();
+
+	int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+	bool IsInitialized() const { return bInitialized; }
+
+	/** 현재 스레드가 잡 시스템 워커인지 */
+	static bool IsInWorkerThread();
+
+private:
+	FJobSystem() = default;
+	~FJobSystem();
+	FJobSystem(const FJobSystem&) = delete;
+	FJobSystem& operator=(const FJobSystem&) = delete;
+
+	// 워커별 잡 큐 (소유자: Back, 도둑: Front)
+	struct FJobQueue
+	{
+		std::mutex Lock;
+		std::deque<std::shared_ptr<FJob>> Jobs;
+
+		void Push(std::shared_ptr<FJob> Job);
+		bool Pop(std::shared_ptr<FJob>& OutJob);
+		bool Steal(std::shared_ptr<FJob>& OutJob);
+	};
+
+	void WorkerMain(int32 QueueIndex);
+	void Enqueue(std::shared_ptr<FJob> Job);
+	bool TryExecuteOne(int32 QueueIndex);
+	void Execute(const std::shared_ptr<FJob>& Job);
+	static int32 GetCurrentQueueIndex();
+
+private:
+	// [0] = 외부 스레드용, [1..N] = 워커 스레드용
+	TArray<std::unique_ptr<FJobQueue>> Queues;
+
+	// High 우선순위 잡 공용 큐 (모든 스레드가 앞에서 꺼냄)
+	std::unique_ptr<FJobQueue> HighPriorityQueue;
+	TArray<std::thread> Workers;
+
+	// 잠든 워커 깨우기용
+	std::mutex SleepLock;
+	std::condition_variable SleepCondition;
+	std::atomic<int32> NumQueuedJobs{ 0 };
+
+	std::atomic<bool> bStopping{ false };
+	bool bInitialized = false;
+};
+
+#define GJobSystem FJobSystem::GetInstance()
+
+/**
+ * [0, Num) 범위를 배치 단위로 잘라 워커 + 호출 스레드에서 병렬 실행
+ * 모든 반복이 끝날 때까지 블로킹되므로 Body는 참조 캡처해도 안전함
+ * @param Body         void(int32 Index)
+ * @param MinBatchSize 한 번에 가져갈 최소 반복 수 (반복당 비용이 작으면 크게)
+ */
+template<typename FuncType>
+void ParallelFor(int32 Num, FuncType&& Body, int32 MinBatchSize = 1);
+
+/**
+ * [0, Num) 범위를 [Begin, End) 구간 단위로 병렬 실행 (SIMD 커널 등 구간 단위 처리용)
+ * @param Body void(int32 Begin, int32 End)
+ */
+template<typename FuncType>
+void ParallelForRange(int32 Num, FuncType&& Body, int32 MinBatchSize = 1);
+
+/** TArray 원소 단위 ParallelFor. Body는 void(T& Element) */
+template<typename T, typename FuncType>
+void ParallelFor(TArray<T>& Array, FuncType&& Body, int32 MinBatchSize = 1)
+{
+	T* Data = Array.GetData();
+	ParallelFor(Array.Num(), [Data, &Body](int32 Index) { Body(Data[Index]); }, MinBatchSize);
+}
+
+template<typename FuncType>
+void ParallelForRange(int32 Num, FuncType&& Body, int32 MinBatchSize)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	MinBatchSize = std::max(MinBatchSize, 1);
+	FJobSystem& JobSystem = GJobSystem;
+	const int32 NumWorkers = JobSystem.IsInitialized() ? JobSystem.GetNumWorkers() : 0;
+
+	// 워커가 없거나 배치 하나로 끝나면 호출 스레드에서 바로 처리
+	if (NumWorkers == 0 || Num <= MinBatchSize)
+	{
+		Body(0, Num);
+		return;
+	}
+
+	// 참여 스레드당 4개 정도의 배치를 가지도록 나눔 (부하 불균형 완화)
+	const int32 NumThreads = NumWorkers + 1;
+	const int32 BatchSize = std::max(MinBatchSize, (Num + NumThreads * 4 - 1) / (NumThreads * 4));
+	const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+
+	std::atomic<int32> NextBatch{ 0 };
+	auto RunBatches = [&]()
+	{
+		int32 Batch;
+		while ((Batch = NextBatch.fetch_add(1, std::memory_order_relaxed)) < NumBatches)
+		{
+			const int32 Begin = Batch * BatchSize;
+			const int32 End = std::min(Begin + BatchSize, Num);
+			Body(Begin, End);
+		}
+	};
+
+	// 헬퍼 잡은 배치 수를 넘지 않게 띄움 (늦게 시작한 헬퍼는 남은 배치가 없으면 바로 종료)
+	const int32 NumHelpers = std::min(NumWorkers, NumBatches - 1);
+	TArray<FJobHandle> Helpers;
+	Helpers.Reserve(NumHelpers);
+	for (int32 i = 0; i < NumHelpers; ++i)
+	{
+		Helpers.Add(JobSystem.Launch(RunBatches));
+	}
+
+	RunBatches();
+	JobSystem.WaitAll(Helpers);
+}
+
+template<typename FuncType>
+void ParallelFor(int32 Num, FuncType&& Body, int32 MinBatchSize)
+{
+	ParallelForRange(Num, [&Body](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			Body(Index);
+		}
+	}, MinBatchSize);
+}
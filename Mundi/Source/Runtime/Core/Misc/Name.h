@@ -2,6 +2,7 @@
 // Name.h
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -11,15 +12,25 @@
 // ──────────────────────────────
 struct FNameEntry
 {
-    FString Display;    // 원문
-    FString Comparison; // lower-case
+    FString Display;    // 원문 (처음 등록된 대소문자 그대로)
+    uint32 Hash = 0;    // 대소문자 무시 해시 (등록 시 한 번 계산)
 };
 
+/**
+ * 이름 테이블 (스레드 안전)
+ * - 엔트리는 고정 크기 청크에 추가만 함 -> 인덱스로 읽는 Get()은 락 없음
+ * - 문자열 -> 인덱스 검색은 해시로 고른 샤드 단위로 잠금: 찾기는 공유 락, 새 이름 등록만 배타 락 (워커 스레드에서도 FName 생성 가능)
+ */
 class FNamePool
 {
 public:
-    static uint32 Add(const FString& InStr);
+    static uint32 Add(std::string_view InStr);
     static const FNameEntry& Get(uint32 Index);
+
+    /** 대소문자 무시 해시 (ASCII 기준) */
+    static uint32 HashIgnoreCase(std::string_view InStr);
+
+    static uint32 GetNumEntries();
 };
 
 // ──────────────────────────────
@@ -31,10 +42,11 @@ struct FName
     uint32 ComparisonIndex = -1;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
+    FName(const char* InStr) { Init(std::string_view(InStr)); }
     FName(const FString& InStr) { Init(InStr); }
+    explicit FName(std::string_view InStr) { Init(InStr); }
 
-    void Init(const FString& InStr)
+    void Init(std::string_view InStr)
     {
         int32_t Index = FNamePool::Add(InStr);
         DisplayIndex = Index;
@@ -45,21 +57,34 @@ struct FName
     bool operator!=(const FName& Other) const { return ComparisonIndex != Other.ComparisonIndex; }
     bool IsNone() const { return DisplayIndex == static_cast<uint32>(-1); }
     bool IsValid() const { return DisplayIndex != static_cast<uint32>(-1); }
-    FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+
+    /** 풀에 있는 문자열 참조 (복사 없음, 풀 엔트리는 프로그램 종료까지 유지) */
+    const FString& ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    std::string_view ToStringView() const { return FNamePool::Get(DisplayIndex).Display; }
 
     friend FName operator+(const FName& A, const FName& B)
     {
-        return FName(A.ToString() + B.ToString());
+        return Concat(A.ToStringView(), B.ToStringView());
     }
 
     friend FName operator+(const FName& A, const FString& B)
     {
-        return FName(A.ToString() + B);
+        return Concat(A.ToStringView(), B);
     }
 
     friend FName operator+(const FString& A, const FName& B)
     {
-        return FName(A + B.ToString());
+        return Concat(A, B.ToStringView());
+    }
+
+private:
+    static FName Concat(std::string_view A, std::string_view B)
+    {
+        FString Combined;
+        Combined.reserve(A.size() + B.size());
+        Combined.append(A);
+        Combined.append(B);
+        return FName(Combined);
     }
 };
 
@@ -244,7 +244,7 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 	{
 		// 자식 컴포넌트들을 먼저 재귀적으로 삭제
 		// (자식을 먼저 삭제하면 부모의 AttachChildren이 변경되므로 복사본으로 순회)
-		TArray<USceneComponent*> ChildrenCopy = SceneComponent->GetAttachChildren();
+		TInlineArray<USceneComponent*, 8> ChildrenCopy = SceneComponent->GetAttachChildren();
 		for (USceneComponent* Child : ChildrenCopy)
 		{
 			RemoveOwnedComponent(Child); // 재귀 호출로 자식들 먼저 삭제
@@ -155,6 +155,7 @@ public:
     void SetActorHiddenInEditor(bool bNewHidden);
     bool GetActorHiddenInEditor() const { return bHiddenInEditor; }
     bool IsHiddenInOutliner() const { return bHiddenInOutliner; }  // 아웃라이너에서 숨김 여부
+    void SetHiddenInOutliner(bool bNewHidden) { bHiddenInOutliner = bNewHidden; }
     // Visible false인 경우 게임, 에디터 모두 안 보임
     void SetActorHiddenInGame(bool bNewHidden) { bActorHiddenInGame = bNewHidden; }
     bool GetActorHiddenInGame() { return bActorHiddenInGame; }
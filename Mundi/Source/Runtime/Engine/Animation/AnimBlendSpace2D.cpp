@@ -132,7 +132,7 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& Output)
             const float Time = NormalizedTime * Len * std::max(0.f, Samples[Best].RateScale);
             Ctx.CurrentTime = (Ctx.bLooping && Len>0.f) ? std::fmod(Time, Len) : FMath::Clamp(Time, 0.f, Len);
             TArray<FTransform> CompPose;
-            FAnimationRuntime::ExtractPoseFromSequence(Samples[Best].Sequence, Ctx, *Skeleton, CompPose);
+            FAnimationRuntime::ExtractPoseFromSequence(Samples[Best].Sequence, Ctx, *Skeleton, CompPose, Output.RequiredBones);
             FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, CompPose, Output.LocalSpacePose);
             return;
         }
@@ -173,7 +173,7 @@ void FAnimNode_BlendSpace2D::Evaluate(FPoseContext& Output)
         const float Time = NormalizedTime * Len * Rate;
         Ctx.CurrentTime = (Ctx.bLooping && Len>0.f) ? std::fmod(Time, Len) : FMath::Clamp(Time, 0.f, Len);
         TArray<FTransform>& OutComp = (si==0)?CompA:((si==1)?CompB:CompC);
-        FAnimationRuntime::ExtractPoseFromSequence(S.Sequence, Ctx, *Skeleton, OutComp);
+        FAnimationRuntime::ExtractPoseFromSequence(S.Sequence, Ctx, *Skeleton, OutComp, Output.RequiredBones);
     }
 
     // Blend three component poses and convert to local
@@ -0,0 +1,627 @@
+#include "pch.h"
+#include "AnimCompression.h"
+#include "VertexData.h"
+
+namespace
+{
+	// smallest-three: 가장 큰 성분을 뺀 나머지 성분의 범위는 [-1/sqrt(2), 1/sqrt(2)]
+	constexpr float QuatComponentRange = 0.70710678f;
+	constexpr uint32 QuatComponentMax = (1u << 15) - 1;
+	constexpr float VectorComponentMax = 65535.0f;
+
+	// 키 축소 시 한 구간의 최대 길이 (압축 시간이 구간 길이의 제곱에 비례하므로 제한)
+	constexpr int32 MaxKeyGap = 255;
+
+	void PackQuat48(const FQuat& InQuat, uint16 OutWords[3])
+	{
+		const FQuat Quat = InQuat.GetNormalized();
+		const float Components[4] = { Quat.X, Quat.Y, Quat.Z, Quat.W };
+
+		int32 Largest = 0;
+		for (int32 i = 1; i < 4; ++i)
+		{
+			if (std::fabs(Components[i]) > std::fabs(Components[Largest]))
+			{
+				Largest = i;
+			}
+		}
+
+		// q와 -q는 같은 회전이므로 가장 큰 성분이 양수가 되도록 부호를 맞춘다 (복원 시 sqrt로 양수 복원)
+		const float Sign = Components[Largest] < 0.0f ? -1.0f : 1.0f;
+
+		uint64 Bits = static_cast<uint64>(Largest);
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (i == Largest)
+			{
+				continue;
+			}
+			const float Normalized = (Components[i] * Sign + QuatComponentRange) / (2.0f * QuatComponentRange);
+			const int32 Quantized = static_cast<int32>(Normalized * QuatComponentMax + 0.5f);
+			Bits = (Bits << 15) | static_cast<uint64>(FMath::Clamp(Quantized, 0, static_cast<int32>(QuatComponentMax)));
+		}
+
+		OutWords[0] = static_cast<uint16>(Bits);
+		OutWords[1] = static_cast<uint16>(Bits >> 16);
+		OutWords[2] = static_cast<uint16>(Bits >> 32);
+	}
+
+	FQuat UnpackQuat48(const uint16* Words)
+	{
+		const uint64 Bits = static_cast<uint64>(Words[0]) | (static_cast<uint64>(Words[1]) << 16) | (static_cast<uint64>(Words[2]) << 32);
+		const int32 Largest = static_cast<int32>((Bits >> 45) & 3);
+
+		constexpr float Scale = (2.0f * QuatComponentRange) / QuatComponentMax;
+		float Components[4];
+		float SumSquares = 0.0f;
+		int32 Shift = 30;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (i == Largest)
+			{
+				continue;
+			}
+			const float Value = static_cast<float>((Bits >> Shift) & QuatComponentMax) * Scale - QuatComponentRange;
+			Components[i] = Value;
+			SumSquares += Value * Value;
+			Shift -= 15;
+		}
+		Components[Largest] = std::sqrt(FMath::Max(0.0f, 1.0f - SumSquares));
+
+		return FQuat(Components[0], Components[1], Components[2], Components[3]);
+	}
+
+	float QuatAngleError(const FQuat& A, const FQuat& B)
+	{
+		const float Dot = FMath::Min(std::fabs(FQuat::Dot(A.GetNormalized(), B.GetNormalized())), 1.0f);
+		return 2.0f * std::acos(Dot);
+	}
+
+	float VectorError(const FVector& A, const FVector& B)
+	{
+		return FMath::Max(std::fabs(A.X - B.X), FMath::Max(std::fabs(A.Y - B.Y), std::fabs(A.Z - B.Z)));
+	}
+
+	void AppendBytes(TArray<uint8>& Data, const void* Source, SIZE_T NumBytes)
+	{
+		const SIZE_T Offset = Data.size();
+		Data.resize(Offset + NumBytes);
+		memcpy(Data.data() + Offset, Source, NumBytes);
+	}
+
+	void AlignData(TArray<uint8>& Data)
+	{
+		Data.resize((Data.size() + 3) & ~static_cast<SIZE_T>(3));
+	}
+
+	/**
+	 * 남길 키 고르기 (0번과 마지막 키는 항상 남김)
+	 * 앞에서부터 구간을 최대한 늘리고, 구간 안의 원본 키가 하나라도 허용 오차를 넘으면 직전 길이에서 끊는다
+	 * @param InterpolationError (구간 시작, 구간 끝, 원본 키) → 구간 보간 값과 원본 키의 오차
+	 */
+	template<typename ErrorFunc>
+	void ReduceKeys(int32 NumKeys, float Tolerance, ErrorFunc InterpolationError, TArray<uint16>& OutKeptFrames)
+	{
+		OutKeptFrames.Empty();
+		OutKeptFrames.Add(0);
+
+		int32 Start = 0;
+		while (Start < NumKeys - 1)
+		{
+			int32 End = Start + 1;
+			const int32 MaxEnd = FMath::Min(Start + MaxKeyGap, NumKeys - 1);
+			while (End < MaxEnd)
+			{
+				const int32 Candidate = End + 1;
+				bool bWithinTolerance = true;
+				for (int32 Key = Start + 1; Key < Candidate; ++Key)
+				{
+					if (InterpolationError(Start, Candidate, Key) > Tolerance)
+					{
+						bWithinTolerance = false;
+						break;
+					}
+				}
+				if (!bWithinTolerance)
+				{
+					break;
+				}
+				End = Candidate;
+			}
+
+			OutKeptFrames.Add(static_cast<uint16>(End));
+			Start = End;
+		}
+	}
+
+	// 모든 키가 Value와 허용 오차 안인지
+	bool AllKeysNear(const TArray<FVector>& Keys, const FVector& Value, float Tolerance)
+	{
+		for (const FVector& Key : Keys)
+		{
+			if (VectorError(Key, Value) > Tolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool AllKeysNear(const TArray<FQuat>& Keys, const FQuat& Value, float Tolerance)
+	{
+		for (const FQuat& Key : Keys)
+		{
+			if (QuatAngleError(Key, Value) > Tolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void WriteFrameTable(const TArray<uint16>& KeptFrames, int32 NumSourceKeys, TArray<uint8>& Data)
+	{
+		if (KeptFrames.Num() < NumSourceKeys)
+		{
+			AppendBytes(Data, KeptFrames.data(), KeptFrames.Num() * sizeof(uint16));
+			AlignData(Data);
+		}
+	}
+
+	void CompressVectorChannel(const TArray<FVector>& Keys, const FVector& IdentityValue, const FVector* RefValue,
+		float Tolerance, FCompressedAnimChannel& OutChannel, TArray<uint8>& Data)
+	{
+		OutChannel = FCompressedAnimChannel();
+		OutChannel.NumSourceKeys = static_cast<uint16>(Keys.Num());
+		if (Keys.IsEmpty())
+		{
+			return;
+		}
+
+		if (RefValue && AllKeysNear(Keys, *RefValue, Tolerance))
+		{
+			OutChannel.Format = EAnimChannelFormat::RefPose;
+			return;
+		}
+		if (AllKeysNear(Keys, IdentityValue, Tolerance))
+		{
+			OutChannel.Format = EAnimChannelFormat::Identity;
+			return;
+		}
+
+		OutChannel.DataOffset = static_cast<uint32>(Data.Num());
+		if (AllKeysNear(Keys, Keys[0], Tolerance))
+		{
+			OutChannel.Format = EAnimChannelFormat::Constant;
+			OutChannel.NumKeys = 1;
+			AppendBytes(Data, &Keys[0], sizeof(FVector));
+			return;
+		}
+
+		TArray<uint16> KeptFrames;
+		ReduceKeys(Keys.Num(), Tolerance, [&Keys](int32 Start, int32 End, int32 Key)
+		{
+			const float Alpha = static_cast<float>(Key - Start) / static_cast<float>(End - Start);
+			return VectorError(FMath::Lerp(Keys[Start], Keys[End], Alpha), Keys[Key]);
+		}, KeptFrames);
+
+		OutChannel.Format = EAnimChannelFormat::Animated;
+		OutChannel.NumKeys = static_cast<uint16>(KeptFrames.Num());
+		WriteFrameTable(KeptFrames, Keys.Num(), Data);
+
+		// 남긴 키의 범위
+		FVector Min = Keys[KeptFrames[0]];
+		FVector Max = Min;
+		for (uint16 Frame : KeptFrames)
+		{
+			const FVector& Key = Keys[Frame];
+			Min = FVector(FMath::Min(Min.X, Key.X), FMath::Min(Min.Y, Key.Y), FMath::Min(Min.Z, Key.Z));
+			Max = FVector(FMath::Max(Max.X, Key.X), FMath::Max(Max.Y, Key.Y), FMath::Max(Max.Z, Key.Z));
+		}
+		const FVector Extent = Max - Min;
+
+		// 16비트 간격의 절반이 허용 오차보다 크면 양자화하지 않는다
+		const float MaxExtent = FMath::Max(Extent.X, FMath::Max(Extent.Y, Extent.Z));
+		if (MaxExtent * 0.5f / VectorComponentMax > Tolerance)
+		{
+			OutChannel.bFullPrecision = 1;
+			for (uint16 Frame : KeptFrames)
+			{
+				AppendBytes(Data, &Keys[Frame], sizeof(FVector));
+			}
+			return;
+		}
+
+		AppendBytes(Data, &Min, sizeof(FVector));
+		AppendBytes(Data, &Extent, sizeof(FVector));
+
+		auto Quantize = [](float Value, float RangeMin, float RangeExtent) -> uint16
+		{
+			if (RangeExtent <= 0.0f)
+			{
+				return 0;
+			}
+			const int32 Quantized = static_cast<int32>((Value - RangeMin) / RangeExtent * VectorComponentMax + 0.5f);
+			return static_cast<uint16>(FMath::Clamp(Quantized, 0, 65535));
+		};
+
+		for (uint16 Frame : KeptFrames)
+		{
+			const FVector& Key = Keys[Frame];
+			const uint16 Words[3] = {
+				Quantize(Key.X, Min.X, Extent.X),
+				Quantize(Key.Y, Min.Y, Extent.Y),
+				Quantize(Key.Z, Min.Z, Extent.Z)
+			};
+			AppendBytes(Data, Words, sizeof(Words));
+		}
+		AlignData(Data);
+	}
+
+	void CompressRotationChannel(const TArray<FQuat>& Keys, const FQuat* RefValue, float Tolerance,
+		FCompressedAnimChannel& OutChannel, TArray<uint8>& Data)
+	{
+		OutChannel = FCompressedAnimChannel();
+		OutChannel.NumSourceKeys = static_cast<uint16>(Keys.Num());
+		if (Keys.IsEmpty())
+		{
+			return;
+		}
+
+		if (RefValue && AllKeysNear(Keys, *RefValue, Tolerance))
+		{
+			OutChannel.Format = EAnimChannelFormat::RefPose;
+			return;
+		}
+		if (AllKeysNear(Keys, FQuat::Identity(), Tolerance))
+		{
+			OutChannel.Format = EAnimChannelFormat::Identity;
+			return;
+		}
+
+		OutChannel.DataOffset = static_cast<uint32>(Data.Num());
+		if (AllKeysNear(Keys, Keys[0], Tolerance))
+		{
+			OutChannel.Format = EAnimChannelFormat::Constant;
+			OutChannel.NumKeys = 1;
+			const FQuat Value = Keys[0].GetNormalized();
+			AppendBytes(Data, &Value, sizeof(FQuat));
+			return;
+		}
+
+		TArray<uint16> KeptFrames;
+		ReduceKeys(Keys.Num(), Tolerance, [&Keys](int32 Start, int32 End, int32 Key)
+		{
+			const float Alpha = static_cast<float>(Key - Start) / static_cast<float>(End - Start);
+			return QuatAngleError(FQuat::Nlerp(Keys[Start], Keys[End], Alpha), Keys[Key]);
+		}, KeptFrames);
+
+		OutChannel.Format = EAnimChannelFormat::Animated;
+		OutChannel.NumKeys = static_cast<uint16>(KeptFrames.Num());
+		WriteFrameTable(KeptFrames, Keys.Num(), Data);
+
+		for (uint16 Frame : KeptFrames)
+		{
+			uint16 Words[3];
+			PackQuat48(Keys[Frame], Words);
+			AppendBytes(Data, Words, sizeof(Words));
+		}
+		AlignData(Data);
+	}
+
+	/**
+	 * 원본 FindKeyframeIndices와 같은 규칙으로 시간 → (구간 시작 키, 구간 끝 키, 구간 안 알파)
+	 * 키를 줄인 채널은 원본 프레임 위치(프레임 + 알파)를 남긴 키 구간에 다시 대응시킨다
+	 */
+	struct FKeySample
+	{
+		int32 Key0 = 0;
+		int32 Key1 = 0;
+		float Alpha = 0.0f;
+	};
+
+	FKeySample FindChannelKeys(const FCompressedAnimChannel& Channel, const uint16* FrameTable, float FrameTime, bool bInterpolate)
+	{
+		FKeySample Sample;
+		const int32 NumSourceKeys = Channel.NumSourceKeys;
+
+		int32 FrameIndex = FMath::Clamp(static_cast<int32>(FrameTime), 0, NumSourceKeys - 1);
+		float FrameAlpha = bInterpolate ? FMath::Clamp(FrameTime - static_cast<float>(FrameIndex), 0.0f, 1.0f) : 0.0f;
+		if (FrameIndex == NumSourceKeys - 1)
+		{
+			FrameAlpha = 0.0f;
+		}
+
+		if (!FrameTable)
+		{
+			Sample.Key0 = FrameIndex;
+			Sample.Key1 = FMath::Min(FrameIndex + 1, NumSourceKeys - 1);
+			Sample.Alpha = FrameAlpha;
+			return Sample;
+		}
+
+		// FrameIndex가 들어 있는 구간 [FrameTable[Key0], FrameTable[Key0 + 1]) (마지막 키는 항상 마지막 프레임)
+		const int32 NumKeys = Channel.NumKeys;
+		const uint16* Upper = std::upper_bound(FrameTable, FrameTable + NumKeys, static_cast<uint16>(FrameIndex));
+		const int32 Key1 = static_cast<int32>(Upper - FrameTable);
+		if (Key1 >= NumKeys)
+		{
+			Sample.Key0 = NumKeys - 1;
+			Sample.Key1 = NumKeys - 1;
+			return Sample;
+		}
+
+		Sample.Key0 = Key1 - 1;
+		Sample.Key1 = Key1;
+		const float Frame0 = static_cast<float>(FrameTable[Sample.Key0]);
+		const float Frame1 = static_cast<float>(FrameTable[Sample.Key1]);
+		Sample.Alpha = (static_cast<float>(FrameIndex) + FrameAlpha - Frame0) / (Frame1 - Frame0);
+		return Sample;
+	}
+
+	const uint16* GetFrameTable(const FCompressedAnimChannel& Channel, const uint8* ChannelData)
+	{
+		return Channel.NumKeys < Channel.NumSourceKeys ? reinterpret_cast<const uint16*>(ChannelData) : nullptr;
+	}
+
+	SIZE_T GetFrameTableSize(const FCompressedAnimChannel& Channel)
+	{
+		return Channel.NumKeys < Channel.NumSourceKeys ? ((Channel.NumKeys * sizeof(uint16) + 3) & ~static_cast<SIZE_T>(3)) : 0;
+	}
+
+	// 채널을 디코드해 OutValue에 씀, 쓰지 않아야 하면(RefPose, 최근접 샘플의 Empty) false
+	bool DecodeVectorChannel(const FCompressedAnimChannel& Channel, const uint8* Data, float FrameTime, bool bInterpolate,
+		const FVector& IdentityValue, FVector& OutValue)
+	{
+		switch (Channel.Format)
+		{
+		case EAnimChannelFormat::Empty:
+			if (!bInterpolate)
+			{
+				return false;
+			}
+			OutValue = IdentityValue;
+			return true;
+
+		case EAnimChannelFormat::RefPose:
+			return false;
+
+		case EAnimChannelFormat::Identity:
+			OutValue = IdentityValue;
+			return true;
+
+		case EAnimChannelFormat::Constant:
+			OutValue = *reinterpret_cast<const FVector*>(Data + Channel.DataOffset);
+			return true;
+
+		case EAnimChannelFormat::Animated:
+		{
+			const uint8* ChannelData = Data + Channel.DataOffset;
+			const uint16* FrameTable = GetFrameTable(Channel, ChannelData);
+			const float* Range = reinterpret_cast<const float*>(ChannelData + GetFrameTableSize(Channel));
+			const FKeySample Sample = FindChannelKeys(Channel, FrameTable, FrameTime, bInterpolate);
+
+			if (Channel.bFullPrecision)
+			{
+				const FVector* FloatKeys = reinterpret_cast<const FVector*>(Range);
+				OutValue = FMath::Lerp(FloatKeys[Sample.Key0], FloatKeys[Sample.Key1], Sample.Alpha);
+				return true;
+			}
+
+			const uint16* Keys = reinterpret_cast<const uint16*>(Range + 6);
+			const uint16* Key0 = Keys + Sample.Key0 * 3;
+			const uint16* Key1 = Keys + Sample.Key1 * 3;
+
+			constexpr float Inv = 1.0f / VectorComponentMax;
+			float Result[3];
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float Scale = Range[3 + Axis] * Inv;
+				const float Value0 = Range[Axis] + static_cast<float>(Key0[Axis]) * Scale;
+				const float Value1 = Range[Axis] + static_cast<float>(Key1[Axis]) * Scale;
+				Result[Axis] = Value0 + (Value1 - Value0) * Sample.Alpha;
+			}
+			OutValue = FVector(Result[0], Result[1], Result[2]);
+			return true;
+		}
+		}
+		return false;
+	}
+
+	bool DecodeRotationChannel(const FCompressedAnimChannel& Channel, const uint8* Data, float FrameTime, bool bInterpolate,
+		FQuat& OutValue)
+	{
+		switch (Channel.Format)
+		{
+		case EAnimChannelFormat::Empty:
+			if (!bInterpolate)
+			{
+				return false;
+			}
+			OutValue = FQuat::Identity();
+			return true;
+
+		case EAnimChannelFormat::RefPose:
+			return false;
+
+		case EAnimChannelFormat::Identity:
+			OutValue = FQuat::Identity();
+			return true;
+
+		case EAnimChannelFormat::Constant:
+			OutValue = *reinterpret_cast<const FQuat*>(Data + Channel.DataOffset);
+			return true;
+
+		case EAnimChannelFormat::Animated:
+		{
+			const uint8* ChannelData = Data + Channel.DataOffset;
+			const uint16* FrameTable = GetFrameTable(Channel, ChannelData);
+			const uint16* Keys = reinterpret_cast<const uint16*>(ChannelData + GetFrameTableSize(Channel));
+
+			const FKeySample Sample = FindChannelKeys(Channel, FrameTable, FrameTime, bInterpolate);
+			const FQuat Quat0 = UnpackQuat48(Keys + Sample.Key0 * 3);
+			if (Sample.Key0 == Sample.Key1 || Sample.Alpha <= 0.0f)
+			{
+				OutValue = Quat0;
+				return true;
+			}
+			OutValue = FQuat::Nlerp(Quat0, UnpackQuat48(Keys + Sample.Key1 * 3), Sample.Alpha);
+			return true;
+		}
+		}
+		return false;
+	}
+
+	/**
+	 * 본별 회전 허용 오차
+	 * 본이 각도 θ만큼 틀어지면 거리 L만큼 떨어진 자손은 약 L·θ 움직이므로, 가장 먼 자손까지의 거리로 나눈다
+	 */
+	void BuildRotationTolerances(const FSkeleton& Skeleton, const FAnimCompressionSettings& Settings, TArray<float>& OutTolerances)
+	{
+		const int32 NumBones = Skeleton.Bones.Num();
+		TArray<FVector> BindPositions;
+		BindPositions.SetNum(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			BindPositions[BoneIndex] = FTransform(Skeleton.Bones[BoneIndex].BindPose).Translation;
+		}
+
+		TArray<float> Reach;
+		Reach.SetNum(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			Reach[BoneIndex] = 0.0f;
+		}
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			for (int32 Ancestor = Skeleton.Bones[BoneIndex].ParentIndex; Ancestor >= 0 && Ancestor < NumBones; Ancestor = Skeleton.Bones[Ancestor].ParentIndex)
+			{
+				const float Distance = (BindPositions[BoneIndex] - BindPositions[Ancestor]).Size();
+				Reach[Ancestor] = FMath::Max(Reach[Ancestor], Distance);
+			}
+		}
+
+		OutTolerances.SetNum(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			float Tolerance = Settings.MaxRotationTolerance;
+			if (Reach[BoneIndex] > KINDA_SMALL_NUMBER)
+			{
+				Tolerance = FMath::Min(Tolerance, Settings.PositionTolerance / Reach[BoneIndex]);
+			}
+			OutTolerances[BoneIndex] = Tolerance;
+		}
+	}
+
+	void BuildRefLocalPose(const FSkeleton& Skeleton, TArray<FTransform>& OutRefLocalPose)
+	{
+		// UAnimSequence::ExtractBonePose가 채우는 바인드 로컬 포즈와 같은 계산
+		const int32 NumBones = Skeleton.Bones.Num();
+		OutRefLocalPose.SetNum(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const FBone& Bone = Skeleton.Bones[BoneIndex];
+			if (Bone.ParentIndex == -1)
+			{
+				OutRefLocalPose[BoneIndex] = FTransform(Bone.BindPose);
+			}
+			else
+			{
+				OutRefLocalPose[BoneIndex] = FTransform(Bone.BindPose * Skeleton.Bones[Bone.ParentIndex].InverseBindPose);
+			}
+		}
+	}
+}
+
+namespace AnimCompression
+{
+	bool CompressTracks(const TArray<FBoneAnimationTrack>& Tracks, const FSkeleton* Skeleton,
+		const FAnimCompressionSettings& Settings, FCompressedAnimSequence& OutCompressed)
+	{
+		OutCompressed.Reset();
+
+		for (const FBoneAnimationTrack& Track : Tracks)
+		{
+			const FRawAnimSequenceTrack& Raw = Track.InternalTrack;
+			if (Raw.GetNumPosKeys() > 65535 || Raw.GetNumRotKeys() > 65535 || Raw.GetNumScaleKeys() > 65535)
+			{
+				return false;
+			}
+		}
+
+		TArray<FTransform> RefLocalPose;
+		TArray<float> RotationTolerances;
+		if (Skeleton)
+		{
+			BuildRefLocalPose(*Skeleton, RefLocalPose);
+			BuildRotationTolerances(*Skeleton, Settings, RotationTolerances);
+		}
+
+		for (const FBoneAnimationTrack& Track : Tracks)
+		{
+			if (Track.BoneIndex < 0)
+			{
+				continue;
+			}
+
+			float ToleranceScale = 1.0f;
+			if (const float* Scale = Settings.BoneToleranceScales.Find(Track.BoneName))
+			{
+				ToleranceScale = *Scale;
+			}
+
+			const bool bHasRefPose = Track.BoneIndex < RefLocalPose.Num();
+			const FTransform* RefPose = bHasRefPose ? &RefLocalPose[Track.BoneIndex] : nullptr;
+			const float RotationTolerance = (bHasRefPose ? RotationTolerances[Track.BoneIndex] : Settings.MaxRotationTolerance) * ToleranceScale;
+
+			FCompressedBoneTrack Compressed;
+			Compressed.BoneIndex = Track.BoneIndex;
+
+			const FRawAnimSequenceTrack& Raw = Track.InternalTrack;
+			CompressVectorChannel(Raw.PositionKeys, FVector(0.0f, 0.0f, 0.0f), RefPose ? &RefPose->Translation : nullptr,
+				Settings.PositionTolerance * ToleranceScale, Compressed.Position, OutCompressed.Data);
+			CompressRotationChannel(Raw.RotationKeys, RefPose ? &RefPose->Rotation : nullptr,
+				RotationTolerance, Compressed.Rotation, OutCompressed.Data);
+			CompressVectorChannel(Raw.ScaleKeys, FVector(1.0f, 1.0f, 1.0f), RefPose ? &RefPose->Scale3D : nullptr,
+				Settings.ScaleTolerance * ToleranceScale, Compressed.Scale, OutCompressed.Data);
+
+			// 바인드 포즈에서 움직이지 않는 본은 트랙째 제거
+			if (Compressed.Position.Format == EAnimChannelFormat::RefPose &&
+				Compressed.Rotation.Format == EAnimChannelFormat::RefPose &&
+				Compressed.Scale.Format == EAnimChannelFormat::RefPose)
+			{
+				continue;
+			}
+
+			OutCompressed.Tracks.Add(Compressed);
+		}
+
+		OutCompressed.Data.Shrink();
+		return true;
+	}
+
+	void DecompressPose(const FCompressedAnimSequence& Compressed, float Time, float FrameRate, bool bInterpolate,
+		TArray<FTransform>& InOutPose, const TArray<uint8>* RequiredBones)
+	{
+		const uint8* Data = Compressed.Data.data();
+		const int32 NumBones = InOutPose.Num();
+		const float FrameTime = Time * FrameRate;
+
+		for (const FCompressedBoneTrack& Track : Compressed.Tracks)
+		{
+			if (Track.BoneIndex < 0 || Track.BoneIndex >= NumBones)
+			{
+				continue;
+			}
+			if (RequiredBones && Track.BoneIndex < RequiredBones->Num() && !(*RequiredBones)[Track.BoneIndex])
+			{
+				continue;
+			}
+
+			FTransform& BoneTransform = InOutPose[Track.BoneIndex];
+			DecodeVectorChannel(Track.Position, Data, FrameTime, bInterpolate, FVector(0.0f, 0.0f, 0.0f), BoneTransform.Translation);
+			DecodeRotationChannel(Track.Rotation, Data, FrameTime, bInterpolate, BoneTransform.Rotation);
+			DecodeVectorChannel(Track.Scale, Data, FrameTime, bInterpolate, FVector(1.0f, 1.0f, 1.0f), BoneTransform.Scale3D);
+		}
+	}
+}
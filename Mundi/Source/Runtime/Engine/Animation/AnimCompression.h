@@ -0,0 +1,56 @@
+#pragma once
+#include "AnimTypes.h"
+
+struct FSkeleton;
+
+/**
+ * 애니메이션 압축 설정
+ * 회전 허용 오차는 본마다 다르다: 본 끝(가장 먼 자손)이 PositionTolerance 이상 움직이지 않도록
+ * 바인드 포즈에서 잰 자손까지의 거리로 나누고, MaxRotationTolerance로 상한을 둔다.
+ */
+struct FAnimCompressionSettings
+{
+	float PositionTolerance = 0.0005f;      // 위치 허용 오차 (m)
+	float MaxRotationTolerance = 0.002f;    // 회전 허용 오차 상한 (rad)
+	float ScaleTolerance = 0.0005f;         // 스케일 허용 오차
+
+	// 본 이름별 허용 오차 배율 (예: 손/발을 더 정밀하게 하려면 0.5)
+	TMap<FString, float> BoneToleranceScales;
+};
+
+/**
+ * 애니메이션 트랙 압축 코덱
+ *
+ * - 회전: smallest-three 48비트 (가장 큰 성분 인덱스 2비트 + 나머지 세 성분 15비트씩)
+ * - 위치/스케일: 채널별 범위(Min, Extent)로 정규화한 성분당 16비트
+ * - 모든 키가 같은 채널은 바인드 포즈/항등값이면 데이터 없이, 아니면 float 값 하나로 저장하고
+ *   세 채널이 모두 바인드 포즈인 본은 트랙째 제거한다
+ * - 남은 채널은 허용 오차 안에서 선형 보간(회전은 Nlerp, 오차 검사도 Nlerp 기준)으로 복원되는 키를 제거한다
+ *   (양자화 오차가 더해지므로 최종 오차는 허용 오차 + 양자화 간격의 절반 정도)
+ * - 위치/스케일 범위가 너무 넓어 16비트 간격의 절반이 허용 오차를 넘는 채널(먼 거리를 이동하는 루트 등)은 float 키로 저장
+ */
+namespace AnimCompression
+{
+	/**
+	 * Raw 트랙을 압축
+	 * @param Skeleton 바인드 포즈 채널 제거와 본별 회전 허용 오차 계산용 (nullptr이면 둘 다 생략)
+	 * @return 압축하지 못했으면 false (키가 65535개를 넘는 트랙)
+	 */
+	bool CompressTracks(const TArray<FBoneAnimationTrack>& Tracks, const FSkeleton* Skeleton,
+		const FAnimCompressionSettings& Settings, FCompressedAnimSequence& OutCompressed);
+
+	/**
+	 * 압축 데이터를 포즈 버퍼에 직접 디코드 (트랙이 있는 본의 채널만 덮어씀)
+	 * InOutPose는 바인드 로컬 포즈로 채워져 있어야 한다 (RefPose 채널과 제거된 본은 그대로 둔다)
+	 * 원본 트랙 평가(UAnimSequence::ExtractBonePose)와 같은 시간 → 프레임 규칙을 따른다
+	 * @param RequiredBones 본 LOD 마스크 (0인 본의 트랙은 디코드하지 않음, nullptr이면 모든 본)
+	 */
+	void DecompressPose(const FCompressedAnimSequence& Compressed, float Time, float FrameRate, bool bInterpolate,
+		TArray<FTransform>& InOutPose, const TArray<uint8>* RequiredBones = nullptr);
+
+	// 압축 데이터 크기 (바이트)
+	inline SIZE_T GetCompressedSize(const FCompressedAnimSequence& Compressed)
+	{
+		return Compressed.Tracks.Num() * sizeof(FCompressedBoneTrack) + Compressed.Data.Num();
+	}
+}
@@ -39,6 +39,12 @@ public:
 	/** FBX AnimCurve에서 추출한 실제 키프레임 데이터 */
 	FAnimationCurveData CurveData;
 
+	/** 압축 트랙 (압축되면 BoneAnimationTracks와 CurveData는 비어 있음, AnimCompression 참고) */
+	FCompressedAnimSequence CompressedData;
+
+	/** 압축 트랙으로 재생하는지 여부 */
+	bool IsCompressed() const { return !CompressedData.IsEmpty(); }
+
 	/**
 	 * 본 인덱스로 트랙 가져오기
 	 * @param BoneIndex 스켈레톤의 본 인덱스
@@ -88,7 +94,7 @@ public:
 	 */
 	bool IsValid() const
 	{
-		return BoneAnimationTracks.Num() > 0 && SequenceLength > 0.0f;
+		return (BoneAnimationTracks.Num() > 0 || IsCompressed()) && SequenceLength > 0.0f;
 	}
 
 	/**
@@ -99,6 +105,7 @@ public:
 		BoneAnimationTracks.clear();
 		NotifyTracks.clear();
 		CurveData.Reset();
+		CompressedData.Reset();
 		SequenceLength = 0.0f;
 		FrameRate = 30.0f;
 		NumberOfFrames = 0;
@@ -110,16 +117,34 @@ public:
 	 */
 	friend FArchive& operator<<(FArchive& Ar, UAnimDataModel& Model)
 	{
-		// 본 애니메이션 트랙 직렬화
-		int32 NumTracks = Model.BoneAnimationTracks.Num();
-		Ar << NumTracks;
-		if (Ar.IsLoading())
+		// 포맷 버전 (예전 캐시는 여기서 실패하고 FBX에서 다시 만든다)
+		uint32 Version = CacheVersion;
+		Ar << Version;
+		if (Ar.IsLoading() && Version != CacheVersion)
 		{
-			Model.BoneAnimationTracks.SetNum(NumTracks);
+			throw std::runtime_error("Anim cache version mismatch");
 		}
-		for (int32 i = 0; i < NumTracks; ++i)
+
+		uint8 bCompressed = Model.IsCompressed() ? 1 : 0;
+		Ar << bCompressed;
+
+		if (bCompressed)
 		{
-			Ar << Model.BoneAnimationTracks[i];
+			Ar << Model.CompressedData;
+		}
+		else
+		{
+			// 본 애니메이션 트랙 직렬화
+			int32 NumTracks = Model.BoneAnimationTracks.Num();
+			Ar << NumTracks;
+			if (Ar.IsLoading())
+			{
+				Model.BoneAnimationTracks.SetNum(NumTracks);
+			}
+			for (int32 i = 0; i < NumTracks; ++i)
+			{
+				Ar << Model.BoneAnimationTracks[i];
+			}
 		}
 
 		// 애니메이션 메타 데이터 직렬화
@@ -128,8 +153,11 @@ public:
 		Ar << Model.NumberOfFrames;
 		Ar << Model.NumberOfKeys;
 
-		// 커브 데이터 직렬화
-		Ar << Model.CurveData;
+		// 커브 데이터 직렬화 (압축되면 원본과 함께 버림)
+		if (!bCompressed)
+		{
+			Ar << Model.CurveData;
+		}
 
 		// 노티파이 트랙 직렬화
 		int32 NumNotifyTracks = Model.NotifyTracks.Num();
@@ -161,4 +189,8 @@ public:
 
 		return Ar;
 	}
+
+private:
+	// 캐시 포맷이 바뀌면 올린다 ('ANM' + 번호)
+	static constexpr uint32 CacheVersion = 0x414E4D02;
 };
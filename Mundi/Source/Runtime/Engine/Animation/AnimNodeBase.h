@@ -35,6 +35,10 @@ struct FPoseContext : public FAnimationBaseContext
 {
     TArray<FTransform> LocalSpacePose;
 
+    // 본 LOD 마스크 (0인 본은 샘플링하지 않고 바인드 로컬 포즈로 둔다, nullptr이면 모든 본 평가)
+    // 하위 노드용 컨텍스트를 따로 만들 때는 이 포인터도 넘겨야 한다
+    const TArray<uint8>* RequiredBones = nullptr;
+
     void Initialize(USkeletalMeshComponent* InComponent, const FSkeleton* InSkeleton, float InDeltaSeconds = 0.f)
     {
         FAnimationBaseContext::Initialize(InComponent, InSkeleton, InDeltaSeconds);
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "AnimSequence.h"
 #include "VertexData.h"
+#include "AnimCompression.h"
 
 UAnimSequence::UAnimSequence()
 	: AnimDataModel(nullptr)
@@ -37,6 +38,13 @@ void UAnimSequence::GetBonePose(float Time, TArray<FTransform>& OutBonePose) con
 	// 시간을 [0, SequenceLength] 범위로 클램프
 	Time = FMath::Clamp(Time, 0.0f, SequenceLength);
 
+	// 압축 트랙은 포즈 버퍼에 바로 디코드 (바인드 포즈 채널은 OutBonePose 값을 그대로 둠)
+	if (AnimDataModel->IsCompressed())
+	{
+		AnimCompression::DecompressPose(AnimDataModel->CompressedData, Time, AnimDataModel->FrameRate, true, OutBonePose);
+		return;
+	}
+
 	// 각 본 트랙에 대해 포즈 계산
 	const TArray<FBoneAnimationTrack>& Tracks = AnimDataModel->GetBoneAnimationTracks();
 	for (const FBoneAnimationTrack& Track : Tracks)
@@ -62,7 +70,8 @@ void UAnimSequence::GetBonePose(float Time, TArray<FTransform>& OutBonePose) con
 	}
 }
 
-void UAnimSequence::ExtractBonePose(const FSkeleton& Skeleton, float Time, bool bLooping, bool bInterpolate, TArray<FTransform>& OutLocalPose) const
+void UAnimSequence::ExtractBonePose(const FSkeleton& Skeleton, float Time, bool bLooping, bool bInterpolate, TArray<FTransform>& OutLocalPose,
+    const TArray<uint8>* RequiredBones) const
 {
     // Ensure output size equals skeleton bones and start from bind local pose
     const int32 NumBones = static_cast<int32>(Skeleton.Bones.Num());
@@ -110,6 +119,13 @@ void UAnimSequence::ExtractBonePose(const FSkeleton& Skeleton, float Time, bool
         EvalTime = FMath::Clamp(EvalTime, 0.0f, Length);
     }
 
+    // Compressed tracks decode straight into the bind local pose
+    if (AnimDataModel->IsCompressed())
+    {
+        AnimCompression::DecompressPose(AnimDataModel->CompressedData, EvalTime, AnimDataModel->FrameRate, bInterpolate, OutLocalPose, RequiredBones);
+        return;
+    }
+
     // Fill from tracks
     const TArray<FBoneAnimationTrack>& Tracks = AnimDataModel->GetBoneAnimationTracks();
     for (const FBoneAnimationTrack& Track : Tracks)
@@ -120,6 +136,12 @@ void UAnimSequence::ExtractBonePose(const FSkeleton& Skeleton, float Time, bool
             continue;
         }
 
+        // 본 LOD로 제외된 본은 바인드 로컬 포즈 유지
+        if (RequiredBones && BoneIndex < RequiredBones->Num() && !(*RequiredBones)[BoneIndex])
+        {
+            continue;
+        }
+
         const FRawAnimSequenceTrack& Raw = Track.InternalTrack;
 
         if (!bInterpolate)
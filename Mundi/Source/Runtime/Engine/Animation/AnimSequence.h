@@ -49,7 +49,8 @@ public:
 	virtual bool IsValid() const override;
 
 	// UAnimSequenceBase override
-	virtual void ExtractBonePose(const FSkeleton& Skeleton, float Time, bool bLooping, bool bInterpolate, TArray<FTransform>& OutLocalPose) const override;
+	virtual void ExtractBonePose(const FSkeleton& Skeleton, float Time, bool bLooping, bool bInterpolate, TArray<FTransform>& OutLocalPose,
+		const TArray<uint8>* RequiredBones = nullptr) const override;
 
 protected:
 	/** 실제 애니메이션 키프레임 데이터를 저장하는 모델 */
@@ -4,7 +4,8 @@
 #include "VertexData.h"
 
 // 기본 구현: 바인드 포즈(로컬)로 채웁니다. 파생(UAnimSequence)에서 실제 트랙 기반 추출을 제공합니다.
-void UAnimSequenceBase::ExtractBonePose(const FSkeleton& Skeleton, float Time, bool /*bLooping*/, bool /*bInterpolate*/, TArray<FTransform>& OutLocalPose) const
+void UAnimSequenceBase::ExtractBonePose(const FSkeleton& Skeleton, float Time, bool /*bLooping*/, bool /*bInterpolate*/, TArray<FTransform>& OutLocalPose,
+    const TArray<uint8>* /*RequiredBones*/) const
 {
     const int32 NumBones = static_cast<int32>(Skeleton.Bones.Num());
     OutLocalPose.SetNum(NumBones);
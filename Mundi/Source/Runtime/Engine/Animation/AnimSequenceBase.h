@@ -72,8 +72,10 @@ public:
 	 * @param bLooping 루프 여부
 	 * @param bInterpolate 키 보간 사용 여부
 	 * @param OutLocalPose 본 개수 크기의 로컬 포즈 배열(출력)
+	 * @param RequiredBones 본 LOD 마스크 (0인 본은 바인드 로컬 포즈로 둠, nullptr이면 모든 본)
 	 **/
-	virtual void ExtractBonePose(const FSkeleton& Skeleton, float Time, bool bLooping, bool bInterpolate, TArray<FTransform>& OutLocalPose) const;
+	virtual void ExtractBonePose(const FSkeleton& Skeleton, float Time, bool bLooping, bool bInterpolate, TArray<FTransform>& OutLocalPose,
+		const TArray<uint8>* RequiredBones = nullptr) const;
 
 protected:
 	/** 애니메이션 전체 재생 길이 (초 단위) */
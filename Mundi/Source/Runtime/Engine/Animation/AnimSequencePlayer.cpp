@@ -21,7 +21,7 @@ void FAnimNode_SequencePlayer::Evaluate(FPoseContext& Output)
 
     // Build component-space pose and convert to local-space for the output
     TArray<FTransform> ComponentPose;
-    FAnimationRuntime::ExtractPoseFromSequence(Sequence, ExtractCtx, *Skeleton, ComponentPose);
+    FAnimationRuntime::ExtractPoseFromSequence(Sequence, ExtractCtx, *Skeleton, ComponentPose, Output.RequiredBones);
     FAnimationRuntime::ConvertComponentToLocalSpace(*Skeleton, ComponentPose, Output.LocalSpacePose);
 }
 
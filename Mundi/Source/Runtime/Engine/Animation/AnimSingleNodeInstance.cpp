@@ -114,8 +114,8 @@ void UAnimSingleNodeInstance::EvaluateAnimation(FPoseContext& Output)
         FAnimExtractContext RefCtx = CurrCtx;  RefCtx.CurrentTime = ReferenceTime;
 
         TArray<FTransform> CurrComp, RefComp;
-        FAnimationRuntime::ExtractPoseFromSequence(Seq, CurrCtx, *Skeleton, CurrComp);
-        FAnimationRuntime::ExtractPoseFromSequence(Seq, RefCtx,  *Skeleton, RefComp);
+        FAnimationRuntime::ExtractPoseFromSequence(Seq, CurrCtx, *Skeleton, CurrComp, Output.RequiredBones);
+        FAnimationRuntime::ExtractPoseFromSequence(Seq, RefCtx,  *Skeleton, RefComp, Output.RequiredBones);
 
         // 3) Convert to local-space
         TArray<FTransform> CurrLocal, RefLocal;
@@ -329,6 +329,8 @@ void FAnimNode_StateMachine::Evaluate(FPoseContext& Output)
     // Evaluate current and optional next via sequence players
     FPoseContext PoseA; PoseA.Initialize(Output.GetComponent(), Skeleton, Output.GetDeltaSeconds());
     FPoseContext PoseB; PoseB.Initialize(Output.GetComponent(), Skeleton, Output.GetDeltaSeconds());
+    PoseA.RequiredBones = Output.RequiredBones;
+    PoseB.RequiredBones = Output.RequiredBones;
 
     FAnimState* Curr = (Runtime.CurrentState >= 0 && Runtime.CurrentState < States.Num()) ? &States[Runtime.CurrentState] : nullptr;
     FAnimState* Next = (Runtime.NextState >= 0 && Runtime.NextState < States.Num()) ? &States[Runtime.NextState] : nullptr;
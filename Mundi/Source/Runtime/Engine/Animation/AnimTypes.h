@@ -315,6 +315,82 @@ public:
 	}
 };
 
+/**
+ * 압축 트랙 채널 형식 (AnimCompression 참고)
+ */
+enum class EAnimChannelFormat : uint8
+{
+	Empty = 0,      // 원본 키 없음 (원본 트랙과 같이 보간 시 항등값, 최근접 샘플 시 기존 값 유지)
+	RefPose,        // 모든 키가 바인드 로컬 포즈와 같음 → 쓰지 않음 (포즈 버퍼의 바인드 값 유지)
+	Identity,       // 모든 키가 항등값 (위치 0, 회전 단위, 스케일 1) → 데이터 없음
+	Constant,       // 모든 키가 같음 → float 값 하나
+	Animated,       // 양자화된 키 (키 축소 시 프레임 번호 표 포함)
+};
+
+/**
+ * 압축된 채널 하나 (위치/회전/스케일)
+ * 데이터는 FCompressedAnimSequence::Data의 DataOffset부터:
+ * - Constant: 위치/스케일 float×3, 회전 float×4
+ * - Animated: [NumKeys < NumSourceKeys면 uint16 프레임 번호 × NumKeys (4바이트 정렬)]
+ *             [위치/스케일이면 범위 float×6 (Min, Extent)] [키 × NumKeys, 키 하나 = uint16×3]
+ *             (bFullPrecision이면 범위 없이 키 하나 = float×3)
+ */
+struct FCompressedAnimChannel
+{
+	EAnimChannelFormat Format = EAnimChannelFormat::Empty;
+	uint8 bFullPrecision = 0;    // 위치/스케일 키를 양자화하지 않고 float로 저장 (범위가 넓어 16비트로는 허용 오차를 못 지킬 때)
+	uint16 NumKeys = 0;          // 저장된 키 개수
+	uint16 NumSourceKeys = 0;    // 원본 키 개수 (= 샘플 프레임 수, 시간 → 프레임 변환 기준)
+	uint16 Padding2 = 0;
+	uint32 DataOffset = 0;
+};
+
+/**
+ * 압축된 본 트랙 (세 채널이 모두 RefPose인 본은 트랙째 제거됨)
+ */
+struct FCompressedBoneTrack
+{
+	int32 BoneIndex = -1;
+	FCompressedAnimChannel Position;
+	FCompressedAnimChannel Rotation;
+	FCompressedAnimChannel Scale;
+};
+
+/**
+ * 압축된 애니메이션 시퀀스
+ * 모든 키 데이터가 연속된 바이트 배열 하나에 있어 평가 시 본마다 몇 개의 캐시 라인만 읽는다
+ */
+struct FCompressedAnimSequence
+{
+public:
+	TArray<FCompressedBoneTrack> Tracks;
+	TArray<uint8> Data;
+
+	bool IsEmpty() const { return Tracks.Num() == 0; }
+
+	void Reset()
+	{
+		Tracks.Empty();
+		Data.Empty();
+	}
+
+	/** 아카이브로 직렬화 (두 배열 모두 POD) */
+	friend FArchive& operator<<(FArchive& Ar, FCompressedAnimSequence& Sequence)
+	{
+		if (Ar.IsSaving())
+		{
+			Serialization::WriteArray(Ar, Sequence.Tracks);
+			Serialization::WriteArray(Ar, Sequence.Data);
+		}
+		else if (Ar.IsLoading())
+		{
+			Serialization::ReadArray(Ar, Sequence.Tracks);
+			Serialization::ReadArray(Ar, Sequence.Data);
+		}
+		return Ar;
+	}
+};
+
 /**
  * 애니메이션 노티파이 이벤트
  * 특정 시간에 발생하는 이벤트 (사운드, 이펙트 등)
@@ -68,7 +68,7 @@ void FAnimationRuntime::ConvertComponentToLocalSpace(const FSkeleton& Skeleton,
 }
 
 void FAnimationRuntime::ExtractPoseFromSequence(const UAnimSequenceBase* Sequence, const FAnimExtractContext& ExtractContext,
-    const FSkeleton& Skeleton, TArray<FTransform>& OutComponentPose)
+    const FSkeleton& Skeleton, TArray<FTransform>& OutComponentPose, const TArray<uint8>* RequiredBones)
 {
     const int32 NumBones = Skeleton.Bones.Num();
     if (NumBones <= 0)
@@ -83,7 +83,7 @@ void FAnimationRuntime::ExtractPoseFromSequence(const UAnimSequenceBase* Sequenc
 
     if (Sequence)
     {
-        Sequence->ExtractBonePose(Skeleton, ExtractContext.CurrentTime, ExtractContext.bLooping, ExtractContext.bEnableInterpolation, LocalPose);
+        Sequence->ExtractBonePose(Skeleton, ExtractContext.CurrentTime, ExtractContext.bLooping, ExtractContext.bEnableInterpolation, LocalPose, RequiredBones);
     }
     else
     {
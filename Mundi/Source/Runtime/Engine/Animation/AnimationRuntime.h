@@ -12,9 +12,9 @@ public:
     static void ConvertComponentToLocalSpace(const FSkeleton& Skeleton, const TArray<FTransform>& ComponentPose,
         TArray<FTransform>& OutLocalPose);
 
-    // extraction
+    // extraction (RequiredBones: FPoseContext::RequiredBones, nullptr이면 모든 본)
     static void ExtractPoseFromSequence(const UAnimSequenceBase* Sequence, const FAnimExtractContext& ExtractContext,
-        const FSkeleton& Skeleton, TArray<FTransform>& OutComponentPose);
+        const FSkeleton& Skeleton, TArray<FTransform>& OutComponentPose, const TArray<uint8>* RequiredBones = nullptr);
 
     // blending
     static void BlendTwoPoses(const FSkeleton& Skeleton, const TArray<FTransform>& ComponentPoseA, const TArray<FTransform>& ComponentPoseB,
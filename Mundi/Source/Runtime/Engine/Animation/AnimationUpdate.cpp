@@ -0,0 +1,266 @@
+#include "pch.h"
+#include "AnimationUpdate.h"
+#include "SkeletalMeshComponent.h"
+#include "JobSystem.h"
+#include "SkinningStats.h"
+#include "PlatformTime.h"
+
+FAnimUpdateRateSettings FAnimationUpdate::Settings;
+
+namespace
+{
+    // 화면 크기 → 평가 간격 (화면 밖은 OffscreenUpdateRate)
+    int32 ComputeUpdateRate(const FAnimUpdateRateSettings& InSettings, const FAnimUpdateRateState& State)
+    {
+        if (State.ScreenSize <= 0.0f)
+        {
+            return FMath::Max(1, InSettings.OffscreenUpdateRate);
+        }
+
+        int32 Rate = 1;
+        for (float Threshold : InSettings.ScreenSizeThresholds)
+        {
+            if (State.ScreenSize >= Threshold)
+            {
+                break;
+            }
+            ++Rate;
+        }
+        return Rate;
+    }
+
+    int32 ComputeBoneLODLevel(const FAnimUpdateRateSettings& InSettings, const FAnimUpdateRateState& State)
+    {
+        int32 Level = 0;
+        for (float Distance : InSettings.BoneLODDistances)
+        {
+            if (State.ViewDistance > Distance)
+            {
+                ++Level;
+            }
+        }
+        return Level;
+    }
+}
+
+bool FAnimationUpdate::Enqueue(USkeletalMeshComponent* Component, float DeltaTime)
+{
+    if (!bGathering || !Component)
+    {
+        return false;
+    }
+
+    if (Component->PendingAnimationIndex != -1)
+    {
+        PendingComponents[Component->PendingAnimationIndex].DeltaTime += DeltaTime;
+        return true;
+    }
+
+    Component->PendingAnimationIndex = PendingComponents.Num();
+
+    FPendingComponent Pending;
+    Pending.Component = Component;
+    Pending.DeltaTime = DeltaTime;
+    PendingComponents.Add(Pending);
+    return true;
+}
+
+void FAnimationUpdate::Remove(USkeletalMeshComponent* Component)
+{
+    if (!Component || Component->PendingAnimationIndex == -1)
+    {
+        return;
+    }
+
+    // 인덱스를 유지해야 하므로 자리만 비운다
+    PendingComponents[Component->PendingAnimationIndex].Component = nullptr;
+    Component->PendingAnimationIndex = -1;
+}
+
+void FAnimationUpdate::Execute()
+{
+    bGathering = false;
+
+    if (PendingComponents.IsEmpty())
+    {
+        return;
+    }
+
+    // === 1. Update (게임 스레드, 등록 순서) ===
+    // 노티파이 콜백이 다른 컴포넌트를 해제할 수 있으므로 매번 슬롯을 다시 읽는다
+    for (int32 i = 0; i < PendingComponents.Num(); ++i)
+    {
+        FPendingComponent& Pending = PendingComponents[i];
+        if (Pending.Component)
+        {
+            Pending.bNeedsEvaluate = Pending.Component->UpdateAnimationState(Pending.DeltaTime);
+        }
+    }
+
+    EvaluateTasks.clear();
+    for (const FPendingComponent& Pending : PendingComponents)
+    {
+        if (Pending.Component && Pending.bNeedsEvaluate)
+        {
+            EvaluateTasks.Add(Pending);
+        }
+    }
+
+    // 평가 간격 / 본 LOD 결정
+    ++FrameIndex;
+    FAnimUpdateRateStats RateStats;
+    UpdateRateOptimizations(RateStats);
+
+    // === 2. Evaluate (병렬) ===
+    // 컴포넌트는 자기 포즈/스키닝 버퍼만 쓰고 시퀀스, 스켈레톤, 애님 인스턴스 상태는 읽기만 한다
+    // 이번 프레임 평가 차례가 아닌 컴포넌트는 마지막 두 평가 포즈 사이를 보간한다
+    FPendingComponent* Tasks = EvaluateTasks.data();
+    ParallelFor(EvaluateTasks.Num(), [Tasks](int32 Index)
+    {
+        USkeletalMeshComponent* Component = Tasks[Index].Component;
+        if (Component->UpdateRateState.bEvaluateThisFrame)
+        {
+            Component->EvaluateAnimationPose(Tasks[Index].DeltaTime);
+        }
+        else
+        {
+            Component->InterpolateAnimationPose();
+        }
+    });
+
+    for (const FPendingComponent& Task : EvaluateTasks)
+    {
+        const FAnimUpdateRateState& State = Task.Component->UpdateRateState;
+        if (State.bEvaluateThisFrame)
+        {
+            RateStats.EvaluateTimeMS += State.LastEvaluateTimeMS;
+            RateStats.SkippedBoneCount += State.NumSkippedBones;
+        }
+    }
+    FSkinningStatManager::GetInstance().SetAnimUpdateRateStats(RateStats);
+
+    // === 3. Write back (게임 스레드, 등록 순서) ===
+    for (const FPendingComponent& Task : EvaluateTasks)
+    {
+        Task.Component->FinishAnimationUpdate();
+    }
+
+    for (const FPendingComponent& Pending : PendingComponents)
+    {
+        if (Pending.Component)
+        {
+            Pending.Component->PendingAnimationIndex = -1;
+        }
+    }
+    PendingComponents.clear();
+}
+
+void FAnimationUpdate::UpdateRateOptimizations(FAnimUpdateRateStats& OutStats)
+{
+    const int32 MaxRate = FMath::Max(1, Settings.MaxUpdateRate);
+    OutStats.AnimatedMeshCount = EvaluateTasks.Num();
+    OutStats.BudgetMS = Settings.BudgetMS;
+
+    // 1. 지난 프레임 화면 크기/거리로 기본 간격과 본 LOD 결정
+    for (const FPendingComponent& Task : EvaluateTasks)
+    {
+        USkeletalMeshComponent* Component = Task.Component;
+        FAnimUpdateRateState& State = Component->UpdateRateState;
+
+        if (State.UpdatePhase < 0)
+        {
+            State.UpdatePhase = NextUpdatePhase++;
+        }
+
+        Component->GetRenderSignificance(State.ScreenSize, State.ViewDistance);
+        if (State.ScreenSize <= 0.0f)
+        {
+            ++OutStats.OffscreenCount;
+        }
+
+        if (Settings.bEnabled && Component->bEnableUpdateRateOptimizations)
+        {
+            State.UpdateRate = FMath::Min(ComputeUpdateRate(Settings, State), MaxRate);
+            State.BoneLODLevel = ComputeBoneLODLevel(Settings, State);
+        }
+        else
+        {
+            State.UpdateRate = 1;
+            State.BoneLODLevel = 0;
+        }
+    }
+
+    // 2. 예산: 추정 비용(마지막 평가 시간 / 간격) 합이 넘치면 덜 중요한 메시부터 간격을 최대로
+    for (const FPendingComponent& Task : EvaluateTasks)
+    {
+        const FAnimUpdateRateState& State = Task.Component->UpdateRateState;
+        OutStats.EstimatedCostMS += State.LastEvaluateTimeMS / State.UpdateRate;
+    }
+
+    if (Settings.bEnabled && Settings.BudgetMS > 0.0f && OutStats.EstimatedCostMS > Settings.BudgetMS)
+    {
+        BudgetOrder.clear();
+        for (const FPendingComponent& Task : EvaluateTasks)
+        {
+            if (Task.Component->bEnableUpdateRateOptimizations)
+            {
+                BudgetOrder.Add(Task.Component);
+            }
+        }
+
+        std::sort(BudgetOrder.begin(), BudgetOrder.end(), [](const USkeletalMeshComponent* A, const USkeletalMeshComponent* B)
+        {
+            const FAnimUpdateRateState& StateA = A->UpdateRateState;
+            const FAnimUpdateRateState& StateB = B->UpdateRateState;
+            if (StateA.ScreenSize != StateB.ScreenSize)
+            {
+                return StateA.ScreenSize < StateB.ScreenSize;
+            }
+            return StateA.ViewDistance > StateB.ViewDistance;
+        });
+
+        for (USkeletalMeshComponent* Component : BudgetOrder)
+        {
+            if (OutStats.EstimatedCostMS <= Settings.BudgetMS)
+            {
+                break;
+            }
+
+            FAnimUpdateRateState& State = Component->UpdateRateState;
+            if (State.UpdateRate < MaxRate)
+            {
+                OutStats.EstimatedCostMS -= State.LastEvaluateTimeMS / State.UpdateRate;
+                State.UpdateRate = MaxRate;
+                OutStats.EstimatedCostMS += State.LastEvaluateTimeMS / State.UpdateRate;
+                ++OutStats.BudgetThrottledCount;
+            }
+        }
+    }
+
+    // 3. 이번 프레임 평가/보간 결정 (UpdatePhase로 같은 간격의 메시들이 서로 다른 프레임에 평가되게 흩음)
+    const int32 NumHistogramBins = static_cast<int32>(std::size(OutStats.UpdateRateHistogram));
+    for (const FPendingComponent& Task : EvaluateTasks)
+    {
+        FAnimUpdateRateState& State = Task.Component->UpdateRateState;
+
+        State.bEvaluateThisFrame = !State.bHasEvaluatedPose || State.UpdateRate <= 1
+            || (FrameIndex + State.UpdatePhase) % State.UpdateRate == 0
+            || State.FramesSinceEvaluate + 1 >= MaxRate;
+
+        if (State.bEvaluateThisFrame)
+        {
+            ++OutStats.EvaluatedCount;
+        }
+        else
+        {
+            ++OutStats.InterpolatedCount;
+        }
+
+        if (State.BoneLODLevel > 0)
+        {
+            ++OutStats.BoneLODMeshCount;
+        }
+
+        ++OutStats.UpdateRateHistogram[FMath::Min(State.UpdateRate, NumHistogramBins - 1)];
+    }
+}
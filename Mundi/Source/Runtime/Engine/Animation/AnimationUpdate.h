@@ -0,0 +1,112 @@
+#pragma once
+
+class USkeletalMeshComponent;
+struct FAnimUpdateRateStats;
+
+/**
+ * 애니메이션 업데이트 빈도 최적화 / 본 LOD 설정 (FAnimationUpdate::GetSettings로 조정)
+ */
+struct FAnimUpdateRateSettings
+{
+    bool bEnabled = true;
+
+    // 화면 크기(바운드 반지름 / 거리)가 첫 값 이상이면 매 프레임, 값 하나 아래로 내려갈 때마다 간격 +1
+    float ScreenSizeThresholds[3] = { 0.25f, 0.12f, 0.06f };
+
+    // 지난 프레임에 그려지지 않은(화면 밖) 메시의 평가 간격
+    int32 OffscreenUpdateRate = 8;
+
+    // 예산 초과 시 늘릴 수 있는 최대 간격
+    int32 MaxUpdateRate = 8;
+
+    // 이 거리(m)를 넘으면 말단 본부터 한 단계씩 평가에서 제외 (1단계: 말단 본, 2단계: 말단에서 두 번째까지)
+    float BoneLODDistances[2] = { 15.0f, 30.0f };
+
+    // 프레임당 포즈 평가 예산 (모든 워커 합계, 0 이하면 예산 조절 안 함)
+    float BudgetMS = 2.0f;
+};
+
+/**
+ * 컴포넌트별 업데이트 빈도 상태 (FAnimationUpdate가 매 프레임 갱신, 컴포넌트가 보관)
+ */
+struct FAnimUpdateRateState
+{
+    int32 UpdateRate = 1;               // N 프레임마다 포즈 평가
+    int32 UpdatePhase = -1;             // 같은 간격끼리 평가 프레임을 흩어 놓기 위한 오프셋 (-1이면 미할당)
+    int32 FramesSinceEvaluate = 0;
+    int32 EvaluateInterval = 1;         // 마지막 두 평가 포즈 사이의 보간 길이 (프레임)
+    int32 BoneLODLevel = 0;
+    int32 NumSkippedBones = 0;          // 현재 본 LOD로 평가에서 빠지는 본 수
+    float ScreenSize = 0.0f;            // 지난 프레임 화면 크기 (화면 밖이면 0)
+    float ViewDistance = 0.0f;
+    double LastEvaluateTimeMS = 0.0;    // 마지막 평가에 걸린 시간 (예산 추정용)
+    bool bEvaluateThisFrame = true;
+    bool bHasEvaluatedPose = false;     // false면 보간할 포즈가 없으므로 반드시 평가
+};
+
+/**
+ * FAnimationUpdate
+ * 월드 단위 스켈레탈 메시 애니메이션 단계입니다.
+ *
+ * 액터 틱 동안 USkeletalMeshComponent::TickComponent는 애니메이션을 직접 계산하지 않고 여기에 등록만 합니다.
+ * 액터 틱이 끝나면 UWorld::Tick이 Execute()를 호출하고 세 단계로 처리합니다.
+ *
+ * 1. Update (게임 스레드, 등록 순서): 애님 인스턴스 시간 전진, 상태 머신 전이, 노티파이 발생 (Lua 콜백, 사운드 등 게임플레이 상태 변경)
+ * 2. Evaluate (잡 시스템 워커, 컴포넌트 단위 병렬): 포즈 추출/블렌드 → 컴포넌트 공간 변환 → 스키닝 행렬
+ *    각 컴포넌트는 자기 포즈 버퍼만 쓰고 애니메이션 에셋과 스켈레톤은 읽기만 한다
+ * 3. Write back (게임 스레드, 등록 순서): 키네마틱 바디를 본 위치로 이동 (PhysX 호출)
+ *
+ * 결과는 같은 틱 안에서 파티클 시뮬레이션(소켓 부착), 렌더링, 다음 프레임 물리 시뮬레이션 전에 반영됩니다.
+ * 월드 틱 밖에서 직접 TickComponent를 부르는 경우(에디터 뷰어 스크러빙 등)는 등록되지 않고 즉시 계산됩니다.
+ *
+ * 업데이트 빈도 최적화(URO): Evaluate 전에 지난 프레임 화면 크기로 컴포넌트마다 평가 간격(N 프레임)과 본 LOD를 정한다.
+ * 평가하지 않는 프레임은 마지막 두 평가 포즈 사이를 보간한다 (Update 단계는 매 프레임 그대로 돌아 노티파이/상태 전이는 정확함).
+ * 추정 평가 비용 합이 예산을 넘으면 덜 중요한(화면에 작게 보이는) 메시부터 간격을 최대로 늘린다.
+ */
+class FAnimationUpdate
+{
+public:
+    // UWorld::Tick에서 액터 틱 직전에 호출 (이때부터 Execute까지 등록을 받음)
+    void BeginGather() { bGathering = true; }
+
+    /**
+     * TickComponent에서 호출 (같은 프레임에 다시 등록되면 DeltaTime만 누적)
+     * @return 등록을 받는 중이 아니면 false (호출자가 즉시 계산해야 함)
+     */
+    bool Enqueue(USkeletalMeshComponent* Component, float DeltaTime);
+
+    // 컴포넌트 해제 시 호출 (이번 프레임 대기 목록에서 제외)
+    void Remove(USkeletalMeshComponent* Component);
+
+    // 등록된 모든 컴포넌트의 애니메이션을 Update → Evaluate(병렬) → Write back 순서로 처리 (게임 스레드, 액터 틱 이후)
+    void Execute();
+
+    bool IsEmpty() const { return PendingComponents.IsEmpty(); }
+
+    static FAnimUpdateRateSettings& GetSettings() { return Settings; }
+
+private:
+    struct FPendingComponent
+    {
+        USkeletalMeshComponent* Component = nullptr;
+        float DeltaTime = 0.0f;
+        bool bNeedsEvaluate = false;
+    };
+
+    // 이번 프레임 EvaluateTasks의 평가 간격, 본 LOD, 평가/보간 여부 결정 (게임 스레드)
+    void UpdateRateOptimizations(FAnimUpdateRateStats& OutStats);
+
+    static FAnimUpdateRateSettings Settings;
+
+    // Execute 호출 횟수 (평가 프레임 판정용)
+    uint64 FrameIndex = 0;
+    int32 NextUpdatePhase = 0;
+
+    TArray<FPendingComponent> PendingComponents;
+
+    // 프레임마다 재사용 (게임 스레드에서만 채운다)
+    TArray<FPendingComponent> EvaluateTasks;
+    TArray<USkeletalMeshComponent*> BudgetOrder;
+
+    bool bGathering = false;
+};
@@ -34,6 +34,69 @@ namespace
 	{
 		return (ExpandBits(x) << 2) | (ExpandBits(y) << 1) | ExpandBits(z);
 	}
+
+	/**
+	 * fat AABB 여유분: 각 방향으로 (크기 * 비율 + 최소값)만큼 키운다
+	 * 작은 흔들림이나 느린 이동은 재삽입 없이 흡수된다
+	 */
+	constexpr float FatBoundsRatio = 0.1f;
+	constexpr float FatBoundsMinMargin = 0.1f;
+
+	inline FAABB FattenBounds(const FAABB& InBounds)
+	{
+		const FVector Size = InBounds.Max - InBounds.Min;
+		const FVector Margin(
+			Size.X * FatBoundsRatio + FatBoundsMinMargin,
+			Size.Y * FatBoundsRatio + FatBoundsMinMargin,
+			Size.Z * FatBoundsRatio + FatBoundsMinMargin);
+		return FAABB(InBounds.Min - Margin, InBounds.Max + Margin);
+	}
+
+	/**
+	 * 삽입 비용 휴리스틱용 표면적
+	 */
+	inline float SurfaceArea(const FAABB& InBounds)
+	{
+		const FVector Size = InBounds.Max - InBounds.Min;
+		return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+	}
+
+	/**
+	 * AABB 12개 모서리를 디버그 라인으로 추가
+	 */
+	void AddBoxLines(const FAABB& InBounds, const FVector4& LineColor, TArray<FVector>& Start, TArray<FVector>& End, TArray<FVector4>& Color)
+	{
+		const FVector Min = InBounds.Min;
+		const FVector Max = InBounds.Max;
+
+		// AABB 8개 꼭짓점
+		const FVector v0(Min.X, Min.Y, Min.Z);
+		const FVector v1(Max.X, Min.Y, Min.Z);
+		const FVector v2(Max.X, Max.Y, Min.Z);
+		const FVector v3(Min.X, Max.Y, Min.Z);
+		const FVector v4(Min.X, Min.Y, Max.Z);
+		const FVector v5(Max.X, Min.Y, Max.Z);
+		const FVector v6(Max.X, Max.Y, Max.Z);
+		const FVector v7(Min.X, Max.Y, Max.Z);
+
+		// 뒤쪽 면 (4개 선분)
+		Start.Add(v0); End.Add(v1); Color.Add(LineColor);
+		Start.Add(v1); End.Add(v2); Color.Add(LineColor);
+		Start.Add(v2); End.Add(v3); Color.Add(LineColor);
+		Start.Add(v3); End.Add(v0); Color.Add(LineColor);
+
+		// 앞쪽 면 (4개 선분)
+		Start.Add(v4); End.Add(v5); Color.Add(LineColor);
+		Start.Add(v5); End.Add(v6); Color.Add(LineColor);
+		Start.Add(v6); End.Add(v7); Color.Add(LineColor);
+		Start.Add(v7); End.Add(v4); Color.Add(LineColor);
+
+		// 앞뒤 연결 (4개 선분)
+		Start.Add(v0); End.Add(v4); Color.Add(LineColor);
+		Start.Add(v1); End.Add(v5); Color.Add(LineColor);
+		Start.Add(v2); End.Add(v6); Color.Add(LineColor);
+		Start.Add(v3); End.Add(v7); Color.Add(LineColor);
+	}
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -65,10 +128,24 @@ void FCollisionBVH::Clear()
 	Nodes = TArray<FLBVHNode>();
 	Bounds = FAABB();
 	bPendingRebuild = false;
+	ClearTree();
 }
 
 void FCollisionBVH::BulkUpdate(const TArray<UShapeComponent*>& Components)
 {
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		// 동적 트리는 개별 삽입/이동으로 충분 (삽입마다 회전으로 균형 유지)
+		for (UShapeComponent* Comp : Components)
+		{
+			if (Comp)
+			{
+				UpdateTreeProxy(Comp, Comp->GetWorldAABB());
+			}
+		}
+		return;
+	}
+
 	for (UShapeComponent* Comp : Components)
 	{
 		if (Comp)
@@ -90,6 +167,12 @@ void FCollisionBVH::Update(UShapeComponent* InComponent)
 		return;
 	}
 
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		UpdateTreeProxy(InComponent, InComponent->GetWorldAABB());
+		return;
+	}
+
 	ShapeComponentBounds[InComponent] = InComponent->GetWorldAABB();
 	bPendingRebuild = true;
 }
@@ -101,6 +184,12 @@ void FCollisionBVH::Remove(UShapeComponent* InComponent)
 		return;
 	}
 
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		RemoveTreeProxy(InComponent);
+		return;
+	}
+
 	if (ShapeComponentBounds.Find(InComponent))
 	{
 		ShapeComponentBounds.Remove(InComponent);
@@ -117,6 +206,52 @@ void FCollisionBVH::FlushRebuild()
 	}
 }
 
+void FCollisionBVH::SetMode(ECollisionBVHMode InMode)
+{
+	if (Mode == InMode)
+	{
+		return;
+	}
+
+	if (InMode == ECollisionBVHMode::DynamicTree)
+	{
+		// LBVH → 동적 트리: 마지막으로 받은 AABB로 모두 삽입
+		const TMap<UShapeComponent*, FAABB> Registered = ShapeComponentBounds;
+		ShapeComponentBounds = TMap<UShapeComponent*, FAABB>();
+		ShapeComponentArray = TArray<UShapeComponent*>();
+		Nodes = TArray<FLBVHNode>();
+		bPendingRebuild = false;
+
+		Mode = InMode;
+		for (const auto& Pair : Registered)
+		{
+			UpdateTreeProxy(Pair.first, Pair.second);
+		}
+	}
+	else
+	{
+		// 동적 트리 → LBVH: 리프의 실제 AABB로 맵을 채우고 재구축
+		for (const auto& Pair : ComponentProxies)
+		{
+			ShapeComponentBounds[Pair.first] = TreeNodes[Pair.second].TightBounds;
+		}
+		ClearTree();
+
+		Mode = InMode;
+		BuildLBVH();
+		bPendingRebuild = false;
+	}
+}
+
+bool FCollisionBVH::Contains(UShapeComponent* InComponent) const
+{
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		return ComponentProxies.Contains(InComponent);
+	}
+	return ShapeComponentBounds.Find(InComponent) != nullptr;
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // 쿼리 API
 // ────────────────────────────────────────────────────────────────────────────
@@ -137,6 +272,43 @@ TArray<UShapeComponent*> FCollisionBVH::QueryIntersectedComponents(const FAABB&
 {
 	TArray<UShapeComponent*> Result;
 
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		if (TreeRoot == -1)
+		{
+			return Result;
+		}
+
+		TArray<int32> TreeStack;
+		TreeStack.push_back(TreeRoot);
+
+		while (!TreeStack.empty())
+		{
+			const int32 Idx = TreeStack.back();
+			TreeStack.pop_back();
+
+			const FTreeNode& Node = TreeNodes[Idx];
+			if (!Node.FatBounds.Intersects(InBound))
+			{
+				continue;
+			}
+
+			// 리프: fat AABB가 아니라 실제 AABB로 판정
+			if (Node.IsLeaf())
+			{
+				if (Node.TightBounds.Intersects(InBound))
+				{
+					Result.push_back(Node.Component);
+				}
+				continue;
+			}
+
+			TreeStack.push_back(Node.Left);
+			TreeStack.push_back(Node.Right);
+		}
+		return Result;
+	}
+
 	if (Nodes.empty())
 	{
 		return Result;
@@ -203,14 +375,31 @@ void FCollisionBVH::DebugDraw(URenderer* Renderer) const
 	if (!Renderer)
 		return;
 
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		// 리프(fat AABB)는 초록색, 내부 노드는 노란색
+		for (const FTreeNode& N : TreeNodes)
+		{
+			if (N.Height < 0)
+			{
+				continue;
+			}
+
+			TArray<FVector> Start;
+			TArray<FVector> End;
+			TArray<FVector4> Color;
+			AddBoxLines(N.FatBounds, FVector4(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f), Start, End, Color);
+			Renderer->AddLines(Start, End, Color);
+		}
+		return;
+	}
+
 	if (Nodes.empty())
 		return;
 
 	for (size_t i = 0; i < Nodes.size(); ++i)
 	{
 		const FLBVHNode& N = Nodes[i];
-		const FVector Min = N.Bounds.Min;
-		const FVector Max = N.Bounds.Max;
 
 		// 리프 노드는 초록색, 내부 노드는 노란색
 		const FVector4 LineColor(1.0f, N.IsLeaf() ? 0.2f : 0.8f, 0.0f, 1.0f);
@@ -218,34 +407,7 @@ void FCollisionBVH::DebugDraw(URenderer* Renderer) const
 		TArray<FVector> Start;
 		TArray<FVector> End;
 		TArray<FVector4> Color;
-
-		// AABB 8개 꼭짓점
-		const FVector v0(Min.X, Min.Y, Min.Z);
-		const FVector v1(Max.X, Min.Y, Min.Z);
-		const FVector v2(Max.X, Max.Y, Min.Z);
-		const FVector v3(Min.X, Max.Y, Min.Z);
-		const FVector v4(Min.X, Min.Y, Max.Z);
-		const FVector v5(Max.X, Min.Y, Max.Z);
-		const FVector v6(Max.X, Max.Y, Max.Z);
-		const FVector v7(Min.X, Max.Y, Max.Z);
-
-		// 뒤쪽 면 (4개 선분)
-		Start.Add(v0); End.Add(v1); Color.Add(LineColor);
-		Start.Add(v1); End.Add(v2); Color.Add(LineColor);
-		Start.Add(v2); End.Add(v3); Color.Add(LineColor);
-		Start.Add(v3); End.Add(v0); Color.Add(LineColor);
-
-		// 앞쪽 면 (4개 선분)
-		Start.Add(v4); End.Add(v5); Color.Add(LineColor);
-		Start.Add(v5); End.Add(v6); Color.Add(LineColor);
-		Start.Add(v6); End.Add(v7); Color.Add(LineColor);
-		Start.Add(v7); End.Add(v4); Color.Add(LineColor);
-
-		// 앞뒤 연결 (4개 선분)
-		Start.Add(v0); End.Add(v4); Color.Add(LineColor);
-		Start.Add(v1); End.Add(v5); Color.Add(LineColor);
-		Start.Add(v2); End.Add(v6); Color.Add(LineColor);
-		Start.Add(v3); End.Add(v7); Color.Add(LineColor);
+		AddBoxLines(N.Bounds, LineColor, Start, End, Color);
 
 		Renderer->AddLines(Start, End, Color);
 	}
@@ -253,24 +415,64 @@ void FCollisionBVH::DebugDraw(URenderer* Renderer) const
 
 int FCollisionBVH::TotalNodeCount() const
 {
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		return TreeNodeCount;
+	}
 	return static_cast<int>(Nodes.size());
 }
 
 int FCollisionBVH::TotalComponentCount() const
 {
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		return ComponentProxies.Num();
+	}
 	return static_cast<int>(ShapeComponentArray.size());
 }
 
 int FCollisionBVH::MaxOccupiedDepth() const
 {
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		return TreeRoot == -1 ? 0 : TreeNodes[TreeRoot].Height + 1;
+	}
 	return (Nodes.empty()) ? 0 : static_cast<int>(std::ceil(std::log2(static_cast<double>(Nodes.size()) + 1)));
 }
 
 void FCollisionBVH::DebugDump() const
 {
+	char buf[256];
+
+	if (Mode == ECollisionBVHMode::DynamicTree)
+	{
+		UE_LOG("===== CollisionBVH (DynamicTree) DUMP BEGIN =====\r\n");
+
+		std::snprintf(buf, sizeof(buf), "nodes=%d, components=%d, height=%d, reinserts=%d\r\n",
+			TreeNodeCount, ComponentProxies.Num(), MaxOccupiedDepth(), ReinsertCount);
+		UE_LOG(buf);
+
+		for (size_t i = 0; i < TreeNodes.size(); ++i)
+		{
+			const FTreeNode& n = TreeNodes[i];
+			if (n.Height < 0)
+			{
+				continue;
+			}
+			std::snprintf(buf, sizeof(buf),
+				"[%zu] P=%d L=%d R=%d H=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
+				i, n.Parent, n.Left, n.Right, n.Height,
+				n.FatBounds.Min.X, n.FatBounds.Min.Y, n.FatBounds.Min.Z,
+				n.FatBounds.Max.X, n.FatBounds.Max.Y, n.FatBounds.Max.Z);
+			UE_LOG(buf);
+		}
+
+		UE_LOG("===== CollisionBVH (DynamicTree) DUMP END =====\r\n");
+		return;
+	}
+
 	UE_LOG("===== CollisionBVH (LBVH) DUMP BEGIN =====\r\n");
 
-	char buf[256];
 	std::snprintf(buf, sizeof(buf), "nodes=%zu, components=%zu\r\n", Nodes.size(), ShapeComponentArray.size());
 	UE_LOG(buf);
 
@@ -442,3 +644,361 @@ int FCollisionBVH::BuildRange(int s, int e)
 
 	return nodeIdx;
 }
+
+// ────────────────────────────────────────────────────────────────────────────
+// 동적 AABB 트리
+// ────────────────────────────────────────────────────────────────────────────
+
+int32 FCollisionBVH::AllocateTreeNode()
+{
+	int32 NodeIndex;
+	if (FreeListHead != -1)
+	{
+		NodeIndex = FreeListHead;
+		FreeListHead = TreeNodes[NodeIndex].Parent;
+	}
+	else
+	{
+		NodeIndex = TreeNodes.Num();
+		TreeNodes.push_back(FTreeNode{});
+	}
+
+	FTreeNode& Node = TreeNodes[NodeIndex];
+	Node = FTreeNode{};
+	Node.Height = 0;
+	++TreeNodeCount;
+	return NodeIndex;
+}
+
+void FCollisionBVH::FreeTreeNode(int32 NodeIndex)
+{
+	FTreeNode& Node = TreeNodes[NodeIndex];
+	Node.Component = nullptr;
+	Node.Left = -1;
+	Node.Right = -1;
+	Node.Height = -1;
+	Node.Parent = FreeListHead;
+	FreeListHead = NodeIndex;
+	--TreeNodeCount;
+}
+
+void FCollisionBVH::InsertLeaf(int32 Leaf)
+{
+	if (TreeRoot == -1)
+	{
+		TreeRoot = Leaf;
+		TreeNodes[Leaf].Parent = -1;
+		return;
+	}
+
+	// 1. 형제 찾기: 여기서 새 부모를 만드는 비용과 자식으로 내려가는 비용(표면적 증가)을 비교하며 내려감
+	const FAABB LeafBounds = TreeNodes[Leaf].FatBounds;
+	int32 Index = TreeRoot;
+	while (!TreeNodes[Index].IsLeaf())
+	{
+		const FTreeNode& Node = TreeNodes[Index];
+		const int32 Left = Node.Left;
+		const int32 Right = Node.Right;
+
+		const float Area = SurfaceArea(Node.FatBounds);
+		const float CombinedArea = SurfaceArea(FAABB::Union(Node.FatBounds, LeafBounds));
+
+		// 이 노드와 새 리프를 묶는 새 부모를 만드는 비용
+		const float Cost = 2.0f * CombinedArea;
+
+		// 더 내려가면 이 노드부터 위쪽이 모두 커지는 비용
+		const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+		auto DescendCost = [&](int32 Child)
+		{
+			const FAABB& ChildBounds = TreeNodes[Child].FatBounds;
+			const float NewArea = SurfaceArea(FAABB::Union(ChildBounds, LeafBounds));
+			if (TreeNodes[Child].IsLeaf())
+			{
+				return NewArea + InheritanceCost;
+			}
+			return (NewArea - SurfaceArea(ChildBounds)) + InheritanceCost;
+		};
+
+		const float CostLeft = DescendCost(Left);
+		const float CostRight = DescendCost(Right);
+
+		if (Cost < CostLeft && Cost < CostRight)
+		{
+			break;
+		}
+
+		Index = CostLeft < CostRight ? Left : Right;
+	}
+
+	// 2. 형제와 새 리프를 묶는 새 부모 생성 (AllocateTreeNode가 배열을 늘릴 수 있으므로 참조는 이후에 얻는다)
+	const int32 Sibling = Index;
+	const int32 OldParent = TreeNodes[Sibling].Parent;
+	const int32 NewParent = AllocateTreeNode();
+
+	FTreeNode& ParentNode = TreeNodes[NewParent];
+	ParentNode.Parent = OldParent;
+	ParentNode.FatBounds = FAABB::Union(LeafBounds, TreeNodes[Sibling].FatBounds);
+	ParentNode.Height = TreeNodes[Sibling].Height + 1;
+	ParentNode.Left = Sibling;
+	ParentNode.Right = Leaf;
+	TreeNodes[Sibling].Parent = NewParent;
+	TreeNodes[Leaf].Parent = NewParent;
+
+	if (OldParent != -1)
+	{
+		FTreeNode& OldParentNode = TreeNodes[OldParent];
+		if (OldParentNode.Left == Sibling)
+		{
+			OldParentNode.Left = NewParent;
+		}
+		else
+		{
+			OldParentNode.Right = NewParent;
+		}
+	}
+	else
+	{
+		TreeRoot = NewParent;
+	}
+
+	// 3. 위로 올라가며 균형을 맞추고 높이/AABB 갱신
+	Index = TreeNodes[Leaf].Parent;
+	while (Index != -1)
+	{
+		Index = Balance(Index);
+
+		FTreeNode& Node = TreeNodes[Index];
+		Node.Height = 1 + std::max(TreeNodes[Node.Left].Height, TreeNodes[Node.Right].Height);
+		Node.FatBounds = FAABB::Union(TreeNodes[Node.Left].FatBounds, TreeNodes[Node.Right].FatBounds);
+
+		Index = Node.Parent;
+	}
+}
+
+void FCollisionBVH::RemoveLeaf(int32 Leaf)
+{
+	if (Leaf == TreeRoot)
+	{
+		TreeRoot = -1;
+		return;
+	}
+
+	// 부모를 없애고 형제를 부모 자리로 올린다
+	const int32 Parent = TreeNodes[Leaf].Parent;
+	const int32 GrandParent = TreeNodes[Parent].Parent;
+	const int32 Sibling = TreeNodes[Parent].Left == Leaf ? TreeNodes[Parent].Right : TreeNodes[Parent].Left;
+
+	if (GrandParent != -1)
+	{
+		FTreeNode& GrandParentNode = TreeNodes[GrandParent];
+		if (GrandParentNode.Left == Parent)
+		{
+			GrandParentNode.Left = Sibling;
+		}
+		else
+		{
+			GrandParentNode.Right = Sibling;
+		}
+		TreeNodes[Sibling].Parent = GrandParent;
+		FreeTreeNode(Parent);
+
+		int32 Index = GrandParent;
+		while (Index != -1)
+		{
+			Index = Balance(Index);
+
+			FTreeNode& Node = TreeNodes[Index];
+			Node.Height = 1 + std::max(TreeNodes[Node.Left].Height, TreeNodes[Node.Right].Height);
+			Node.FatBounds = FAABB::Union(TreeNodes[Node.Left].FatBounds, TreeNodes[Node.Right].FatBounds);
+
+			Index = Node.Parent;
+		}
+	}
+	else
+	{
+		TreeRoot = Sibling;
+		TreeNodes[Sibling].Parent = -1;
+		FreeTreeNode(Parent);
+	}
+}
+
+int32 FCollisionBVH::Balance(int32 IndexA)
+{
+	FTreeNode& A = TreeNodes[IndexA];
+	if (A.IsLeaf() || A.Height < 2)
+	{
+		return IndexA;
+	}
+
+	const int32 IndexB = A.Left;
+	const int32 IndexC = A.Right;
+	FTreeNode& B = TreeNodes[IndexB];
+	FTreeNode& C = TreeNodes[IndexC];
+
+	const int32 BalanceFactor = C.Height - B.Height;
+
+	// C가 더 높으면 C를 A 자리로 올린다
+	if (BalanceFactor > 1)
+	{
+		const int32 IndexF = C.Left;
+		const int32 IndexG = C.Right;
+		FTreeNode& F = TreeNodes[IndexF];
+		FTreeNode& G = TreeNodes[IndexG];
+
+		C.Left = IndexA;
+		C.Parent = A.Parent;
+		A.Parent = IndexC;
+
+		if (C.Parent != -1)
+		{
+			FTreeNode& CParent = TreeNodes[C.Parent];
+			if (CParent.Left == IndexA)
+			{
+				CParent.Left = IndexC;
+			}
+			else
+			{
+				CParent.Right = IndexC;
+			}
+		}
+		else
+		{
+			TreeRoot = IndexC;
+		}
+
+		// C의 자식 중 높은 쪽은 C에 남기고 낮은 쪽을 A로 내린다
+		if (F.Height > G.Height)
+		{
+			C.Right = IndexF;
+			A.Right = IndexG;
+			G.Parent = IndexA;
+			A.FatBounds = FAABB::Union(B.FatBounds, G.FatBounds);
+			C.FatBounds = FAABB::Union(A.FatBounds, F.FatBounds);
+			A.Height = 1 + std::max(B.Height, G.Height);
+			C.Height = 1 + std::max(A.Height, F.Height);
+		}
+		else
+		{
+			C.Right = IndexG;
+			A.Right = IndexF;
+			F.Parent = IndexA;
+			A.FatBounds = FAABB::Union(B.FatBounds, F.FatBounds);
+			C.FatBounds = FAABB::Union(A.FatBounds, G.FatBounds);
+			A.Height = 1 + std::max(B.Height, F.Height);
+			C.Height = 1 + std::max(A.Height, G.Height);
+		}
+
+		return IndexC;
+	}
+
+	// B가 더 높으면 B를 A 자리로 올린다
+	if (BalanceFactor < -1)
+	{
+		const int32 IndexD = B.Left;
+		const int32 IndexE = B.Right;
+		FTreeNode& D = TreeNodes[IndexD];
+		FTreeNode& E = TreeNodes[IndexE];
+
+		B.Left = IndexA;
+		B.Parent = A.Parent;
+		A.Parent = IndexB;
+
+		if (B.Parent != -1)
+		{
+			FTreeNode& BParent = TreeNodes[B.Parent];
+			if (BParent.Left == IndexA)
+			{
+				BParent.Left = IndexB;
+			}
+			else
+			{
+				BParent.Right = IndexB;
+			}
+		}
+		else
+		{
+			TreeRoot = IndexB;
+		}
+
+		if (D.Height > E.Height)
+		{
+			B.Right = IndexD;
+			A.Left = IndexE;
+			E.Parent = IndexA;
+			A.FatBounds = FAABB::Union(C.FatBounds, E.FatBounds);
+			B.FatBounds = FAABB::Union(A.FatBounds, D.FatBounds);
+			A.Height = 1 + std::max(C.Height, E.Height);
+			B.Height = 1 + std::max(A.Height, D.Height);
+		}
+		else
+		{
+			B.Right = IndexE;
+			A.Left = IndexD;
+			D.Parent = IndexA;
+			A.FatBounds = FAABB::Union(C.FatBounds, D.FatBounds);
+			B.FatBounds = FAABB::Union(A.FatBounds, E.FatBounds);
+			A.Height = 1 + std::max(C.Height, D.Height);
+			B.Height = 1 + std::max(A.Height, E.Height);
+		}
+
+		return IndexB;
+	}
+
+	return IndexA;
+}
+
+void FCollisionBVH::UpdateTreeProxy(UShapeComponent* InComponent, const FAABB& InBounds)
+{
+	if (const int32* Existing = ComponentProxies.Find(InComponent))
+	{
+		const int32 Leaf = *Existing;
+		FTreeNode& Node = TreeNodes[Leaf];
+		Node.TightBounds = InBounds;
+
+		// fat AABB 안에서의 이동은 트리를 건드리지 않는다
+		if (Node.FatBounds.Contains(InBounds))
+		{
+			return;
+		}
+
+		RemoveLeaf(Leaf);
+		TreeNodes[Leaf].FatBounds = FattenBounds(InBounds);
+		InsertLeaf(Leaf);
+		++ReinsertCount;
+		return;
+	}
+
+	const int32 Leaf = AllocateTreeNode();
+	FTreeNode& Node = TreeNodes[Leaf];
+	Node.Component = InComponent;
+	Node.TightBounds = InBounds;
+	Node.FatBounds = FattenBounds(InBounds);
+	ComponentProxies.Add(InComponent, Leaf);
+
+	InsertLeaf(Leaf);
+}
+
+void FCollisionBVH::RemoveTreeProxy(UShapeComponent* InComponent)
+{
+	const int32* Existing = ComponentProxies.Find(InComponent);
+	if (!Existing)
+	{
+		return;
+	}
+
+	const int32 Leaf = *Existing;
+	ComponentProxies.Remove(InComponent);
+
+	RemoveLeaf(Leaf);
+	FreeTreeNode(Leaf);
+}
+
+void FCollisionBVH::ClearTree()
+{
+	TreeNodes = TArray<FTreeNode>();
+	TreeRoot = -1;
+	FreeListHead = -1;
+	TreeNodeCount = 0;
+	ComponentProxies = TFlatMap<UShapeComponent*, int32>();
+}
@@ -10,11 +10,28 @@
 class UShapeComponent;
 class URenderer;
 
+/**
+ * 충돌 BVH 모드 (A/B 비교용으로 전환 가능)
+ * - LBVH: Morton 코드 기반 정적 트리, 컴포넌트 하나만 바뀌어도 FlushRebuild에서 전체 재구축
+ * - DynamicTree: 여유(fat) AABB 리프를 가진 동적 AABB 트리, 삽입/삭제/이동이 O(log N)이고
+ *   여유 AABB 안에서 움직이는 이동은 트리를 건드리지 않음 (대부분 정적인 트리거 배치에 유리)
+ */
+enum class ECollisionBVHMode : uint8
+{
+	LBVH,
+	DynamicTree,
+};
+
 /**
  * FCollisionBVH
  *
  * ShapeComponent 기반 충돌 감지를 위한 BVH 구조입니다.
- * LBVH (Linear BVH) 알고리즘을 사용하여 O(log N) 쿼리 성능을 제공합니다.
+ * LBVH (Linear BVH) 또는 동적 AABB 트리로 O(log N) 쿼리 성능을 제공합니다.
+ *
+ * DynamicTree 모드:
+ * - 리프는 실제 AABB를 여유분만큼 키운 fat AABB를 가지며, 새 AABB가 그 안에 있으면 Update는 아무것도 하지 않음
+ * - 벗어나면 리프를 떼어 새 fat AABB로 다시 삽입 (표면적 증가가 가장 작은 형제를 찾아 내려감)
+ * - 삽입/삭제 후 부모 방향으로 올라가며 높이 차가 1을 넘는 노드를 회전해 트리 균형을 유지
  *
  * 주요 기능:
  * - ShapeComponent 등록/해제/업데이트
@@ -75,9 +92,32 @@ public:
 	/**
 	 * 보류 중인 BVH 재구축을 즉시 실행합니다.
 	 * Update 호출 후 쿼리 전에 호출해야 합니다.
+	 * DynamicTree 모드에서는 Update/Remove가 즉시 반영되므로 아무것도 하지 않습니다.
 	 */
 	void FlushRebuild();
 
+	/**
+	 * BVH 모드를 바꿉니다. 등록된 컴포넌트는 새 모드의 구조로 옮겨집니다.
+	 *
+	 * @param InMode - 사용할 모드
+	 */
+	void SetMode(ECollisionBVHMode InMode);
+
+	/**
+	 * 현재 BVH 모드를 반환합니다.
+	 *
+	 * @return BVH 모드
+	 */
+	ECollisionBVHMode GetMode() const { return Mode; }
+
+	/**
+	 * 컴포넌트가 등록되어 있는지 반환합니다.
+	 *
+	 * @param InComponent - 확인할 컴포넌트
+	 * @return 등록되어 있으면 true
+	 */
+	bool Contains(UShapeComponent* InComponent) const;
+
 	// ────────────────────────────────────────────────
 	// 쿼리 API
 	// ────────────────────────────────────────────────
@@ -136,6 +176,13 @@ public:
 	 */
 	void DebugDump() const;
 
+	/**
+	 * DynamicTree 모드에서 fat AABB를 벗어나 다시 삽입된 횟수를 반환합니다 (누적).
+	 *
+	 * @return 재삽입 횟수
+	 */
+	int32 GetReinsertCount() const { return ReinsertCount; }
+
 	/**
 	 * BVH 루트 노드의 경계를 반환합니다.
 	 *
@@ -177,6 +224,33 @@ private:
 		bool IsLeaf() const { return Count > 0; }
 	};
 
+	/**
+	 * 동적 AABB 트리 노드
+	 * 리프는 컴포넌트 하나를 가지며, 해제된 노드는 Parent를 다음 빈 노드 인덱스로 쓴다.
+	 */
+	struct FTreeNode
+	{
+		/** fat AABB (내부 노드는 자식 fat AABB의 합) */
+		FAABB FatBounds;
+
+		/** 리프 노드: 컴포넌트의 실제 AABB (쿼리 판정용) */
+		FAABB TightBounds;
+
+		/** 리프 노드: 컴포넌트 */
+		UShapeComponent* Component = nullptr;
+
+		/** 부모 노드 인덱스 (빈 노드면 다음 빈 노드 인덱스) */
+		int32 Parent = -1;
+
+		int32 Left = -1;
+		int32 Right = -1;
+
+		/** 리프 0, 빈 노드 -1 */
+		int32 Height = -1;
+
+		bool IsLeaf() const { return Left == -1; }
+	};
+
 	// ────────────────────────────────────────────────
 	// 내부 함수
 	// ────────────────────────────────────────────────
@@ -196,6 +270,34 @@ private:
 	 */
 	int BuildRange(int s, int e);
 
+	/** 동적 트리 노드를 할당합니다 (빈 노드 목록 재사용). */
+	int32 AllocateTreeNode();
+
+	/** 동적 트리 노드를 빈 노드 목록으로 돌려보냅니다. */
+	void FreeTreeNode(int32 NodeIndex);
+
+	/** 리프를 표면적 증가가 가장 작은 형제 옆에 삽입하고 부모 방향으로 균형을 맞춥니다. */
+	void InsertLeaf(int32 Leaf);
+
+	/** 리프를 트리에서 떼어냅니다 (노드는 해제하지 않음). */
+	void RemoveLeaf(int32 Leaf);
+
+	/**
+	 * 높이 차가 1을 넘으면 높은 쪽 자식을 위로 회전합니다.
+	 *
+	 * @return 회전 후 그 자리의 노드 인덱스
+	 */
+	int32 Balance(int32 NodeIndex);
+
+	/** 동적 트리에 컴포넌트를 삽입하거나 이동합니다. */
+	void UpdateTreeProxy(UShapeComponent* InComponent, const FAABB& InBounds);
+
+	/** 동적 트리에서 컴포넌트를 제거합니다. */
+	void RemoveTreeProxy(UShapeComponent* InComponent);
+
+	/** 동적 트리를 비웁니다. */
+	void ClearTree();
+
 	// ────────────────────────────────────────────────
 	// 멤버 변수
 	// ────────────────────────────────────────────────
@@ -223,4 +325,29 @@ private:
 
 	/** 재구축 대기 플래그 */
 	bool bPendingRebuild = false;
+
+	/** 현재 모드 */
+	ECollisionBVHMode Mode = ECollisionBVHMode::DynamicTree;
+
+	// ────────────────────────────────────────────────
+	// 동적 트리 (DynamicTree 모드)
+	// ────────────────────────────────────────────────
+
+	/** 동적 트리 노드 배열 (빈 노드 포함) */
+	TArray<FTreeNode> TreeNodes;
+
+	/** 루트 노드 인덱스 (-1이면 비어 있음) */
+	int32 TreeRoot = -1;
+
+	/** 빈 노드 목록의 첫 인덱스 */
+	int32 FreeListHead = -1;
+
+	/** 사용 중인 노드 수 */
+	int32 TreeNodeCount = 0;
+
+	/** 컴포넌트 -> 리프 노드 인덱스 */
+	TFlatMap<UShapeComponent*, int32> ComponentProxies;
+
+	/** fat AABB를 벗어나 다시 삽입된 횟수 (누적) */
+	int32 ReinsertCount = 0;
 };
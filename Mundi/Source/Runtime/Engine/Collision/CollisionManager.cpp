@@ -7,6 +7,7 @@
 #include "ShapeComponent.h"
 #include "World.h"
 #include "Renderer.h"
+#include "Collision.h"
 
 IMPLEMENT_CLASS(UCollisionManager)
 
@@ -19,6 +20,13 @@ UCollisionManager::UCollisionManager()
 	// BVH 초기화 (월드 크기에 맞게 설정)
 	FAABB WorldBounds(FVector(-100000, -100000, -100000), FVector(100000, 100000, 100000));
 	BVH = std::make_unique<FCollisionBVH>(WorldBounds, 0, 12, 8);
+
+	// editor.ini의 CollisionBVHMode=LBVH면 매 프레임 전체 재구축하는 기존 LBVH 사용 (기본 동적 트리)
+	auto BVHModeIt = EditorINI.find("CollisionBVHMode");
+	if (BVHModeIt != EditorINI.end() && BVHModeIt->second == "LBVH")
+	{
+		BVH->SetMode(ECollisionBVHMode::LBVH);
+	}
 }
 
 UCollisionManager::~UCollisionManager()
@@ -75,10 +83,10 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 	BVH->Remove(Component);
 
 	// Dirty 목록에서도 제거
-	DirtyComponents.erase(
-		std::remove(DirtyComponents.begin(), DirtyComponents.end(), Component),
-		DirtyComponents.end()
-	);
+	DirtyComponents.Remove(Component);
+
+	// 겹침 쌍에서도 제거 (다음 프레임에 End 이벤트가 해제된 컴포넌트로 나가지 않도록)
+	RemoveOverlapPairs(Component);
 
 	bNeedsFullRebuild = true;
 }
@@ -90,19 +98,14 @@ void UCollisionManager::MarkComponentDirty(UShapeComponent* Component)
 		return;
 	}
 
-	// 등록된 컴포넌트만 Dirty 마킹
-	if (!RegisteredComponents.Contains(Component))
+	// 등록된 컴포넌트만 Dirty 마킹 (BVH 멤버십으로 O(1) 판별)
+	if (!BVH || !BVH->Contains(Component))
 	{
 		return;
 	}
 
 	// 이미 Dirty 목록에 있으면 무시
-	if (DirtyComponents.Contains(Component))
-	{
-		return;
-	}
-
-	DirtyComponents.push_back(Component);
+	DirtyComponents.Add(Component);
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -110,30 +113,147 @@ void UCollisionManager::MarkComponentDirty(UShapeComponent* Component)
 // ────────────────────────────────────────────────────────────────────────────
 
 void UCollisionManager::UpdateCollisions(float DeltaTime)
+{
+	// 통계(CollisionPairsChecked/OverlapEventsTriggered)는 UpdateOverlaps가 프레임마다 초기화하므로 건드리지 않음
+	if (!BVH)
+	{
+		return;
+	}
+
+	if (BVH->GetMode() == ECollisionBVHMode::DynamicTree)
+	{
+		// 동적 트리: 움직였다고 마킹된 컴포넌트만 갱신 (fat AABB 안의 이동은 트리를 건드리지 않음)
+		UpdateBVHIncremental();
+	}
+	else
+	{
+		// LBVH: 매 프레임 모든 등록된 컴포넌트의 현재 위치로 BVH 업데이트
+		// (WorldPartitionManager와 동일한 방식)
+		for (UShapeComponent* Comp : RegisteredComponents)
+		{
+			if (Comp)
+			{
+				BVH->Update(Comp);
+			}
+		}
+	}
+
+	// BVH 재구축 플러시 (동적 트리는 이미 반영되어 있어 아무것도 하지 않음)
+	BVH->FlushRebuild();
+
+	// Dirty 플래그 초기화
+	ClearDirtyFlags();
+	bNeedsFullRebuild = false;
+}
+
+void UCollisionManager::UpdateOverlaps()
 {
 	// 통계 초기화
 	CollisionPairsChecked = 0;
 	OverlapEventsTriggered = 0;
 
-	// 매 프레임 모든 등록된 컴포넌트의 현재 위치로 BVH 업데이트
-	// (WorldPartitionManager와 동일한 방식)
+	// 1. 이번 프레임 겹침 쌍 (PreviousPairs에는 지난 프레임 쌍이 정렬된 채로 남아 있음)
+	GatherOverlapPairs();
+
+	// 2. 정렬된 두 목록을 병합하며 새로 생긴 쌍은 Begin, 사라진 쌍은 End
+	BeginEvents.clear();
+	EndEvents.clear();
+
+	int32 PrevIndex = 0;
+	int32 CurrIndex = 0;
+	while (PrevIndex < PreviousPairs.Num() || CurrIndex < CurrentPairs.Num())
+	{
+		if (CurrIndex >= CurrentPairs.Num()
+			|| (PrevIndex < PreviousPairs.Num() && PreviousPairs[PrevIndex] < CurrentPairs[CurrIndex]))
+		{
+			EndEvents.Add(PreviousPairs[PrevIndex++]);
+		}
+		else if (PrevIndex >= PreviousPairs.Num() || CurrentPairs[CurrIndex] < PreviousPairs[PrevIndex])
+		{
+			BeginEvents.Add(CurrentPairs[CurrIndex++]);
+		}
+		else
+		{
+			++PrevIndex;
+			++CurrIndex;
+		}
+	}
+
+	// 3. 컴포넌트별 OverlapInfos를 이번 프레임 쌍으로 다시 채움
 	for (UShapeComponent* Comp : RegisteredComponents)
 	{
-		if (Comp && BVH)
+		if (Comp)
 		{
-			BVH->Update(Comp);
+			Comp->OverlapInfos.clear();
 		}
 	}
 
-	// BVH 재구축 플러시
-	if (BVH)
+	for (const FOverlapPair& Pair : CurrentPairs)
 	{
-		BVH->FlushRebuild();
+		FOverlapInfo InfoA;
+		InfoA.OtherActor = Pair.B->GetOwner();
+		InfoA.Other = Pair.B;
+		Pair.A->OverlapInfos.Add(InfoA);
+
+		FOverlapInfo InfoB;
+		InfoB.OtherActor = Pair.A->GetOwner();
+		InfoB.Other = Pair.A;
+		Pair.B->OverlapInfos.Add(InfoB);
 	}
 
-	// Dirty 플래그 초기화
-	ClearDirtyFlags();
-	bNeedsFullRebuild = false;
+	// 이번 프레임 쌍이 다음 프레임의 비교 대상 (버퍼는 교환해서 재사용)
+	std::swap(PreviousPairs, CurrentPairs);
+
+	// 4. 이벤트 발생 (양방향, UUID 순서)
+	// 콜백에서 컴포넌트가 해제되면 RemoveOverlapPairs가 남은 이벤트를 비우므로 인덱스로 순회하며 매번 다시 읽는다
+	auto CanBroadcast = [](const UShapeComponent* Comp)
+	{
+		return Comp && !Comp->IsPendingDestroy() && Comp->GetOwner() && !Comp->GetOwner()->IsPendingDestroy();
+	};
+
+	// 액터 쌍마다 프레임당 한 번만 (셰이프가 여러 개인 액터끼리도 이벤트 하나, Begin/End 공유)
+	BroadcastActorPairs.clear();
+	auto TryMarkActorPair = [this](const FOverlapPair& Pair)
+	{
+		const uint32 OwnerA = Pair.A->GetOwner()->UUID;
+		const uint32 OwnerB = Pair.B->GetOwner()->UUID;
+		const uint64 Key = OwnerA < OwnerB
+			? (static_cast<uint64>(OwnerA) << 32) | OwnerB
+			: (static_cast<uint64>(OwnerB) << 32) | OwnerA;
+		return BroadcastActorPairs.insert(Key).second;
+	};
+
+	for (int32 i = 0; i < BeginEvents.Num(); ++i)
+	{
+		const FOverlapPair Pair = BeginEvents[i];
+		if (!CanBroadcast(Pair.A) || !CanBroadcast(Pair.B) || !TryMarkActorPair(Pair))
+		{
+			continue;
+		}
+
+		Pair.A->GetOwner()->OnComponentBeginOverlap.Broadcast(Pair.A, Pair.B);
+		if (CanBroadcast(Pair.B))
+		{
+			Pair.B->GetOwner()->OnComponentBeginOverlap.Broadcast(Pair.B, Pair.A);
+		}
+		++OverlapEventsTriggered;
+	}
+
+	for (int32 i = 0; i < EndEvents.Num(); ++i)
+	{
+		const FOverlapPair Pair = EndEvents[i];
+		if (!CanBroadcast(Pair.A) || !CanBroadcast(Pair.B) || !TryMarkActorPair(Pair))
+		{
+			continue;
+		}
+
+		Pair.A->GetOwner()->OnComponentEndOverlap.Broadcast(Pair.A, Pair.B);
+		if (CanBroadcast(Pair.B))
+		{
+			Pair.B->GetOwner()->OnComponentEndOverlap.Broadcast(Pair.B, Pair.A);
+		}
+		++OverlapEventsTriggered;
+	}
 }
 
 void UCollisionManager::RebuildBVH()
@@ -147,6 +267,19 @@ void UCollisionManager::RebuildBVH()
 	BVH->BulkUpdate(RegisteredComponents);
 }
 
+void UCollisionManager::SetBVHMode(ECollisionBVHMode InMode)
+{
+	if (BVH)
+	{
+		BVH->SetMode(InMode);
+	}
+}
+
+ECollisionBVHMode UCollisionManager::GetBVHMode() const
+{
+	return BVH ? BVH->GetMode() : ECollisionBVHMode::DynamicTree;
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // 쿼리 API
 // ────────────────────────────────────────────────────────────────────────────
@@ -192,6 +325,7 @@ void UCollisionManager::GetStats(int& OutTotalComponents, int& OutTotalNodes, in
 void UCollisionManager::DebugDump() const
 {
 	UE_LOG("===== CollisionManager Debug Info =====");
+	UE_LOG("BVH Mode: %s", GetBVHMode() == ECollisionBVHMode::DynamicTree ? "DynamicTree" : "LBVH");
 	UE_LOG("Registered Components: %d", RegisteredComponents.Num());
 	UE_LOG("Dirty Components: %d", DirtyComponents.Num());
 	UE_LOG("Collision Pairs Checked (Last Frame): %d", CollisionPairsChecked);
@@ -228,15 +362,136 @@ void UCollisionManager::UpdateBVHIncremental()
 			BVH->Update(Comp);
 		}
 	}
+}
+
+void UCollisionManager::ClearDirtyFlags()
+{
+	DirtyComponents.clear();
+}
 
-	// 너무 많은 컴포넌트가 Dirty면 완전 재구축
-	if (DirtyComponents.Num() > RegisteredComponents.Num() / 2)
+void UCollisionManager::GatherOverlapPairs()
+{
+	// 1. 겹침 이벤트를 만드는 컴포넌트만 모아 월드 AABB를 한 번씩 읽는다
+	SweepProxies.clear();
+	for (UShapeComponent* Comp : RegisteredComponents)
 	{
-		bNeedsFullRebuild = true;
+		if (!Comp || Comp->IsPendingDestroy() || !Comp->bGenerateOverlapEvents)
+		{
+			continue;
+		}
+
+		// 모양이 없는 기본 클래스는 제외 (GetShape가 비어 있음)
+		if (Comp->GetClass() == UShapeComponent::StaticClass())
+		{
+			continue;
+		}
+
+		AActor* Owner = Comp->GetOwner();
+		if (!Owner || !Owner->IsActorActive() || Owner->IsPendingDestroy())
+		{
+			continue;
+		}
+
+		FSweepProxy Proxy;
+		Proxy.Bounds = Comp->GetWorldAABB();
+		Proxy.Component = Comp;
+		Proxy.Owner = Owner;
+		SweepProxies.Add(Proxy);
 	}
+
+	// 2. Sweep and Prune: X축 최소값으로 정렬하고, 각 항목의 X 구간 안에서 시작하는 항목만 후보로 본다
+	std::sort(SweepProxies.begin(), SweepProxies.end(), [](const FSweepProxy& A, const FSweepProxy& B)
+	{
+		return A.Bounds.Min.X < B.Bounds.Min.X;
+	});
+
+	CurrentPairs.clear();
+	const int32 NumProxies = SweepProxies.Num();
+	for (int32 i = 0; i < NumProxies; ++i)
+	{
+		const FSweepProxy& ProxyA = SweepProxies[i];
+		for (int32 j = i + 1; j < NumProxies && SweepProxies[j].Bounds.Min.X <= ProxyA.Bounds.Max.X; ++j)
+		{
+			const FSweepProxy& ProxyB = SweepProxies[j];
+
+			// 같은 액터의 컴포넌트끼리는 겹침 이벤트 없음
+			if (ProxyA.Owner == ProxyB.Owner)
+			{
+				continue;
+			}
+
+			// 나머지 두 축 AABB 검사
+			if (ProxyA.Bounds.Max.Y < ProxyB.Bounds.Min.Y || ProxyB.Bounds.Max.Y < ProxyA.Bounds.Min.Y
+				|| ProxyA.Bounds.Max.Z < ProxyB.Bounds.Min.Z || ProxyB.Bounds.Max.Z < ProxyA.Bounds.Min.Z)
+			{
+				continue;
+			}
+
+			// 3. Narrow Phase (쌍마다 한 번)
+			++CollisionPairsChecked;
+			if (!Collision::CheckOverlap(ProxyA.Component, ProxyB.Component))
+			{
+				continue;
+			}
+
+			// UUID 순서로 정규화 (포인터 순서는 실행마다 달라 이벤트 순서가 흔들린다)
+			const uint32 UUIDA = ProxyA.Component->UUID;
+			const uint32 UUIDB = ProxyB.Component->UUID;
+			const bool bAFirst = UUIDA != UUIDB ? UUIDA < UUIDB : std::less<UShapeComponent*>()(ProxyA.Component, ProxyB.Component);
+
+			FOverlapPair Pair;
+			Pair.A = bAFirst ? ProxyA.Component : ProxyB.Component;
+			Pair.B = bAFirst ? ProxyB.Component : ProxyA.Component;
+			Pair.UUIDA = bAFirst ? UUIDA : UUIDB;
+			Pair.UUIDB = bAFirst ? UUIDB : UUIDA;
+			CurrentPairs.Add(Pair);
+		}
+	}
+
+	// 지난 프레임 목록과 병합 비교하기 위해 정렬
+	std::sort(CurrentPairs.begin(), CurrentPairs.end());
 }
 
-void UCollisionManager::ClearDirtyFlags()
+void UCollisionManager::RemoveOverlapPairs(UShapeComponent* Component)
 {
-	DirtyComponents.clear();
+	auto Involves = [Component](const FOverlapPair& Pair)
+	{
+		return Pair.A == Component || Pair.B == Component;
+	};
+
+	// 상대 컴포넌트의 OverlapInfos에서 제거
+	for (const FOverlapPair& Pair : PreviousPairs)
+	{
+		if (!Involves(Pair))
+		{
+			continue;
+		}
+
+		UShapeComponent* Other = Pair.A == Component ? Pair.B : Pair.A;
+		Other->OverlapInfos.erase(
+			std::remove_if(Other->OverlapInfos.begin(), Other->OverlapInfos.end(),
+				[Component](const FOverlapInfo& Info) { return Info.Other == Component; }),
+			Other->OverlapInfos.end()
+		);
+	}
+	Component->OverlapInfos.clear();
+
+	PreviousPairs.erase(std::remove_if(PreviousPairs.begin(), PreviousPairs.end(), Involves), PreviousPairs.end());
+	CurrentPairs.erase(std::remove_if(CurrentPairs.begin(), CurrentPairs.end(), Involves), CurrentPairs.end());
+
+	// 이벤트 발생 중(콜백 안에서) 해제된 경우 아직 나가지 않은 이벤트를 비운다
+	for (FOverlapPair& Pair : BeginEvents)
+	{
+		if (Involves(Pair))
+		{
+			Pair = FOverlapPair();
+		}
+	}
+	for (FOverlapPair& Pair : EndEvents)
+	{
+		if (Involves(Pair))
+		{
+			Pair = FOverlapPair();
+		}
+	}
 }
@@ -10,6 +10,7 @@
 // Forward Declarations
 class UShapeComponent;
 class UWorld;
+class AActor;
 class URenderer;
 
 /**
@@ -17,6 +18,8 @@ class URenderer;
  *
  * 월드의 모든 ShapeComponent를 관리하고 충돌 감지를 수행하는 중앙 관리자입니다.
  * BVH(Bounding Volume Hierarchy)를 사용하여 O(log N) 성능의 충돌 감지를 제공합니다.
+ * 기본은 동적 AABB 트리 모드로 MarkComponentDirty된 컴포넌트만 갱신합니다.
+ * editor.ini의 CollisionBVHMode=LBVH면 매 프레임 전체를 재구축하는 LBVH 모드로 동작합니다 (A/B 비교용).
  *
  * 주요 기능:
  * - ShapeComponent 등록/해제
@@ -26,8 +29,16 @@ class URenderer;
  *
  * 사용법:
  * - World::Initialize()에서 생성
- * - World::Tick()에서 UpdateCollisions() 호출
+ * - World::Tick()에서 SF_CollisionBVH 표시 중일 때만 UpdateCollisions() 호출 (트리는 디버그 표시 전용)
+ * - World::Tick()에서 액터 틱이 끝난 뒤 UpdateOverlaps() 호출 (월드 단위 Overlap 단계)
  * - ShapeComponent가 BeginPlay/EndPlay에서 자동 등록/해제
+ *
+ * Overlap 단계:
+ * 1. Broad Phase: 등록된 컴포넌트의 월드 AABB를 X축 최소값으로 정렬해 Sweep and Prune으로 후보 쌍을 만든다
+ * 2. Narrow Phase: 후보 쌍마다 Collision::CheckOverlap 한 번 (쌍은 UUID 순서로 정규화되어 A-B/B-A 중복이 없음)
+ * 3. 정렬된 이번 프레임 쌍 목록과 지난 프레임 목록을 병합 비교해 Begin/End 이벤트를 양방향으로 발생
+ *    - 쌍은 컴포넌트 단위지만 이벤트는 액터 쌍마다 프레임당 한 번 (셰이프가 여러 개인 액터도 한 번만 받음)
+ *    - UUID 순서로 발생하므로 실행마다 이벤트 순서가 같다
  */
 class UCollisionManager : public UObject
 {
@@ -73,25 +84,48 @@ public:
 	// ────────────────────────────────────────────────
 
 	/**
-	 * 모든 충돌을 감지하고 Overlap 이벤트를 발생시킵니다.
-	 * World::Tick()에서 매 프레임 호출됩니다.
+	 * BVH를 이번 프레임 컴포넌트 위치로 갱신합니다.
+	 * World::Tick()에서 SF_CollisionBVH가 켜져 있는 프레임에만 호출됩니다.
+	 * DynamicTree 모드는 Dirty 컴포넌트만, LBVH 모드는 모든 컴포넌트를 갱신하고 재구축합니다.
 	 *
 	 * @param DeltaTime - 프레임 시간
 	 */
 	void UpdateCollisions(float DeltaTime);
 
+	/**
+	 * 겹침 쌍을 갱신하고 Begin/End Overlap 이벤트를 발생시킵니다.
+	 * World::Tick()에서 액터 틱 이후 매 프레임 한 번 호출됩니다.
+	 * 각 컴포넌트의 OverlapInfos도 이번 프레임 쌍으로 다시 채웁니다.
+	 */
+	void UpdateOverlaps();
+
 	/**
 	 * BVH를 강제로 재구축합니다.
 	 * 대량의 컴포넌트가 추가/제거/이동한 경우 호출합니다.
 	 */
 	void RebuildBVH();
 
+	/**
+	 * BVH 모드를 바꿉니다 (등록된 컴포넌트는 새 구조로 옮겨짐).
+	 *
+	 * @param InMode - 사용할 모드
+	 */
+	void SetBVHMode(ECollisionBVHMode InMode);
+
+	/**
+	 * 현재 BVH 모드를 반환합니다.
+	 *
+	 * @return BVH 모드
+	 */
+	ECollisionBVHMode GetBVHMode() const;
+
 	// ────────────────────────────────────────────────
 	// 쿼리 API
 	// ────────────────────────────────────────────────
 
 	/**
 	 * 특정 AABB와 겹치는 ShapeComponent들을 반환합니다.
+	 * 트리는 UpdateCollisions() 시점 기준이므로 SF_CollisionBVH가 꺼져 있으면 먼저 UpdateCollisions()를 호출할 것
 	 *
 	 * @param InBound - 쿼리할 AABB
 	 * @return 겹치는 컴포넌트 배열
@@ -165,6 +199,53 @@ private:
 	 */
 	void ClearDirtyFlags();
 
+	/**
+	 * Sweep and Prune + Narrow Phase로 이번 프레임 겹침 쌍을 CurrentPairs에 채웁니다 (정렬됨).
+	 */
+	void GatherOverlapPairs();
+
+	/**
+	 * 컴포넌트가 포함된 쌍과 아직 발생하지 않은 이벤트를 제거합니다 (해제 시, End 이벤트 없음).
+	 *
+	 * @param Component - 해제되는 컴포넌트
+	 */
+	void RemoveOverlapPairs(UShapeComponent* Component);
+
+	// ────────────────────────────────────────────────
+	// Overlap 단계 자료구조
+	// ────────────────────────────────────────────────
+
+	/**
+	 * 겹침 쌍 (항상 A < B, UUID 순서이고 같으면 포인터 순서)
+	 * 정렬 키인 UUID를 같이 들고 있어 병합 비교 중 컴포넌트를 다시 읽지 않는다
+	 */
+	struct FOverlapPair
+	{
+		UShapeComponent* A = nullptr;
+		UShapeComponent* B = nullptr;
+		uint32 UUIDA = 0;
+		uint32 UUIDB = 0;
+
+		bool operator==(const FOverlapPair& Other) const { return A == Other.A && B == Other.B; }
+		bool operator<(const FOverlapPair& Other) const
+		{
+			if (UUIDA != Other.UUIDA) return UUIDA < Other.UUIDA;
+			if (A != Other.A) return std::less<UShapeComponent*>()(A, Other.A);
+			if (UUIDB != Other.UUIDB) return UUIDB < Other.UUIDB;
+			return std::less<UShapeComponent*>()(B, Other.B);
+		}
+	};
+
+	/**
+	 * Sweep and Prune 항목 (X축 구간 + 나머지 축 비교용 AABB)
+	 */
+	struct FSweepProxy
+	{
+		FAABB Bounds;
+		UShapeComponent* Component = nullptr;
+		AActor* Owner = nullptr;
+	};
+
 	// ────────────────────────────────────────────────
 	// 멤버 변수
 	// ────────────────────────────────────────────────
@@ -178,8 +259,22 @@ private:
 	/** 등록된 모든 컴포넌트 */
 	TArray<UShapeComponent*> RegisteredComponents;
 
-	/** 이동한 컴포넌트 (증분 업데이트용) */
-	TArray<UShapeComponent*> DirtyComponents;
+	/** 이동한 컴포넌트 (증분 업데이트용, 매 프레임 모든 셰이프가 마킹하므로 O(1) 중복 검사) */
+	TFlatSet<UShapeComponent*> DirtyComponents;
+
+	/** 지난 프레임 / 이번 프레임 겹침 쌍 (정렬됨, 매 프레임 교환하며 재사용) */
+	TArray<FOverlapPair> PreviousPairs;
+	TArray<FOverlapPair> CurrentPairs;
+
+	/** Sweep and Prune 항목 (매 프레임 재사용) */
+	TArray<FSweepProxy> SweepProxies;
+
+	/** 이벤트를 모은 뒤 한꺼번에 발생 (콜백 중 등록/해제가 쌍 목록을 바꿔도 안전하도록) */
+	TArray<FOverlapPair> BeginEvents;
+	TArray<FOverlapPair> EndEvents;
+
+	/** 이번 프레임 이벤트를 이미 보낸 액터 쌍 (작은 UUID << 32 | 큰 UUID, Begin/End 공유) */
+	TFlatSet<uint64> BroadcastActorPairs;
 
 	/** 완전 재구축 필요 여부 */
 	bool bNeedsFullRebuild = false;
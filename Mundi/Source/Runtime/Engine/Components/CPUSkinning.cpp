@@ -0,0 +1,162 @@
+#include "pch.h"
+#include "CPUSkinning.h"
+#include "VertexData.h"
+#include "JobSystem.h"
+#include <immintrin.h>
+
+namespace
+{
+    // 정점 하나가 가벼우므로 잡 하나가 이 정도는 처리하게 한다
+    constexpr int32 MinVerticesPerJob = 1024;
+
+    // 출력은 정점 하나 = __m128 4개로 통째로 쓴다
+    static_assert(sizeof(FNormalVertex) == 64, "CPU 스키닝 커널은 FNormalVertex가 64바이트라고 가정함");
+
+    // FVector::GetSafeNormal과 같은 규칙 (길이가 KINDA_SMALL_NUMBER 이하면 0 벡터)
+    inline __m128 SafeNormalize3(__m128 V)
+    {
+        const __m128 Squared = _mm_mul_ps(V, V);
+        const float LengthSquared = _mm_cvtss_f32(Squared)
+            + _mm_cvtss_f32(_mm_shuffle_ps(Squared, Squared, _MM_SHUFFLE(1, 1, 1, 1)))
+            + _mm_cvtss_f32(_mm_shuffle_ps(Squared, Squared, _MM_SHUFFLE(2, 2, 2, 2)));
+        const float Length = std::sqrt(LengthSquared);
+        if (Length <= KINDA_SMALL_NUMBER)
+        {
+            return _mm_setzero_ps();
+        }
+        return _mm_div_ps(V, _mm_set1_ps(Length));
+    }
+}
+
+void FCPUSkinningStreams::Build(const TArray<FSkinnedVertex>& Vertices)
+{
+    NumVertices = Vertices.Num();
+
+    PositionX.SetNum(NumVertices); PositionY.SetNum(NumVertices); PositionZ.SetNum(NumVertices);
+    NormalX.SetNum(NumVertices); NormalY.SetNum(NumVertices); NormalZ.SetNum(NumVertices);
+    TangentX.SetNum(NumVertices); TangentY.SetNum(NumVertices); TangentZ.SetNum(NumVertices); TangentW.SetNum(NumVertices);
+    UV.SetNum(NumVertices);
+    NumInfluences.SetNum(NumVertices);
+    BoneIndices.SetNum(NumVertices * 4);
+    BoneWeights.SetNum(NumVertices * 4);
+
+    for (int32 i = 0; i < NumVertices; ++i)
+    {
+        const FSkinnedVertex& Vertex = Vertices[i];
+
+        PositionX[i] = Vertex.Position.X;
+        PositionY[i] = Vertex.Position.Y;
+        PositionZ[i] = Vertex.Position.Z;
+        NormalX[i] = Vertex.Normal.X;
+        NormalY[i] = Vertex.Normal.Y;
+        NormalZ[i] = Vertex.Normal.Z;
+        TangentX[i] = Vertex.Tangent.X;
+        TangentY[i] = Vertex.Tangent.Y;
+        TangentZ[i] = Vertex.Tangent.Z;
+        TangentW[i] = Vertex.Tangent.W;
+        UV[i] = Vertex.UV;
+
+        // 기존 스키닝과 같이 가중치가 0보다 큰 영향만 쓴다
+        uint8 Count = 0;
+        for (int32 k = 0; k < 4; ++k)
+        {
+            if (Vertex.BoneWeights[k] > 0.f)
+            {
+                BoneIndices[i * 4 + Count] = static_cast<uint16>(Vertex.BoneIndices[k]);
+                BoneWeights[i * 4 + Count] = Vertex.BoneWeights[k];
+                ++Count;
+            }
+        }
+        for (int32 k = Count; k < 4; ++k)
+        {
+            BoneIndices[i * 4 + k] = 0;
+            BoneWeights[i * 4 + k] = 0.f;
+        }
+        NumInfluences[i] = Count;
+    }
+}
+
+void FCPUSkinningStreams::Reset()
+{
+    NumVertices = 0;
+    PositionX.Empty(); PositionY.Empty(); PositionZ.Empty();
+    NormalX.Empty(); NormalY.Empty(); NormalZ.Empty();
+    TangentX.Empty(); TangentY.Empty(); TangentZ.Empty(); TangentW.Empty();
+    UV.Empty();
+    NumInfluences.Empty();
+    BoneIndices.Empty();
+    BoneWeights.Empty();
+}
+
+namespace CPUSkinning
+{
+    void SkinVertices(const FCPUSkinningStreams& Streams, const FMatrix* SkinningMatrices, int32 NumMatrices,
+        int32 Begin, int32 End, FNormalVertex* OutVertices)
+    {
+        const uint8* NumInfluences = Streams.NumInfluences.data();
+        const uint16* BoneIndices = Streams.BoneIndices.data();
+        const float* BoneWeights = Streams.BoneWeights.data();
+
+        for (int32 i = Begin; i < End; ++i)
+        {
+            // 1. 영향 본 행렬을 가중치로 블렌드 (행 단위, 마지막 행은 이동)
+            __m128 Row0 = _mm_setzero_ps();
+            __m128 Row1 = _mm_setzero_ps();
+            __m128 Row2 = _mm_setzero_ps();
+            __m128 Row3 = _mm_setzero_ps();
+
+            const int32 Count = NumInfluences[i];
+            for (int32 k = 0; k < Count; ++k)
+            {
+                const uint32 BoneIndex = BoneIndices[i * 4 + k];
+                if (BoneIndex >= static_cast<uint32>(NumMatrices))
+                {
+                    continue;
+                }
+
+                const FMatrix& Matrix = SkinningMatrices[BoneIndex];
+                const __m128 Weight = _mm_set1_ps(BoneWeights[i * 4 + k]);
+                Row0 = _mm_add_ps(Row0, _mm_mul_ps(Matrix.Rows[0], Weight));
+                Row1 = _mm_add_ps(Row1, _mm_mul_ps(Matrix.Rows[1], Weight));
+                Row2 = _mm_add_ps(Row2, _mm_mul_ps(Matrix.Rows[2], Weight));
+                Row3 = _mm_add_ps(Row3, _mm_mul_ps(Matrix.Rows[3], Weight));
+            }
+
+            // 2. 블렌드된 행렬 하나로 위치/노멀/탄젠트 변환 (행 벡터 * 행렬, FMatrix::TransformPosition/TransformVector와 같은 식)
+            const __m128 Position = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Streams.PositionX[i]), Row0), _mm_mul_ps(_mm_set1_ps(Streams.PositionY[i]), Row1)),
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Streams.PositionZ[i]), Row2), Row3));
+
+            const __m128 Normal = SafeNormalize3(_mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Streams.NormalX[i]), Row0), _mm_mul_ps(_mm_set1_ps(Streams.NormalY[i]), Row1)),
+                _mm_mul_ps(_mm_set1_ps(Streams.NormalZ[i]), Row2)));
+
+            const __m128 Tangent = SafeNormalize3(_mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Streams.TangentX[i]), Row0), _mm_mul_ps(_mm_set1_ps(Streams.TangentY[i]), Row1)),
+                _mm_mul_ps(_mm_set1_ps(Streams.TangentZ[i]), Row2)));
+
+            // 3. 정점 하나를 로컬에서 완성한 뒤 통째로 쓴다 (업로드 버퍼는 write-combined라 순서대로 한 번에 쓰는 게 좋음)
+            alignas(16) float P[4], N[4], T[4];
+            _mm_store_ps(P, Position);
+            _mm_store_ps(N, Normal);
+            _mm_store_ps(T, Tangent);
+
+            FNormalVertex Vertex;
+            Vertex.pos = FVector(P[0], P[1], P[2]);
+            Vertex.normal = FVector(N[0], N[1], N[2]);
+            Vertex.tex = Streams.UV[i];
+            Vertex.Tangent = FVector4(T[0], T[1], T[2], Streams.TangentW[i]);
+            Vertex.color = FVector4(0.f, 0.f, 0.f, 0.f);
+            OutVertices[i] = Vertex;
+        }
+    }
+
+    void SkinVerticesParallel(const FCPUSkinningStreams& Streams, const FMatrix* SkinningMatrices, int32 NumMatrices,
+        FNormalVertex* OutVertices)
+    {
+        ParallelForRange(Streams.NumVertices, [&](int32 Begin, int32 End)
+        {
+            SkinVertices(Streams, SkinningMatrices, NumMatrices, Begin, End, OutVertices);
+        }, MinVerticesPerJob);
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+/**
+ * CPU 스키닝 입력 스트림 (USkeletalMesh가 CPU 스키닝을 처음 할 때 한 번 만든다)
+ *
+ * 위치/노멀/탄젠트는 성분별 배열(SoA)로 나눠 커널이 필요한 성분만 순서대로 읽게 한다.
+ * 영향 본은 정점마다 4개 묶음으로 두되 가중치가 0인 것은 빼고 앞으로 모아 NumInfluences개만 블렌드한다.
+ */
+struct FCPUSkinningStreams
+{
+    int32 NumVertices = 0;
+
+    TArray<float> PositionX, PositionY, PositionZ;
+    TArray<float> NormalX, NormalY, NormalZ;
+    TArray<float> TangentX, TangentY, TangentZ, TangentW;
+    TArray<FVector2D> UV;
+
+    TArray<uint8> NumInfluences;    // 0 ~ 4
+    TArray<uint16> BoneIndices;     // 정점 i의 k번째 영향 = [i * 4 + k]
+    TArray<float> BoneWeights;
+
+    void Build(const TArray<FSkinnedVertex>& Vertices);
+    void Reset();
+};
+
+namespace CPUSkinning
+{
+    /**
+     * [Begin, End) 정점을 스키닝해 OutVertices[Begin, End)에 쓴다 (워커 스레드에서 구간별로 호출 가능)
+     * 정점마다 영향 본 행렬을 가중치로 한 번 블렌드한 뒤 위치/노멀/탄젠트를 그 행렬 하나로 같이 변환한다 (SSE).
+     * 노멀/탄젠트는 정규화하고 탄젠트 W와 UV는 그대로 복사한다.
+     * @param OutVertices 매핑된 업로드 버퍼를 바로 넘겨도 된다 (정점 하나를 64바이트 통째로 순서대로 씀)
+     */
+    void SkinVertices(const FCPUSkinningStreams& Streams, const FMatrix* SkinningMatrices, int32 NumMatrices,
+        int32 Begin, int32 End, FNormalVertex* OutVertices);
+
+    /**
+     * 전체 정점을 잡 시스템 워커로 나눠 스키닝 (모든 구간이 끝나야 반환)
+     */
+    void SkinVerticesParallel(const FCPUSkinningStreams& Streams, const FMatrix* SkinningMatrices, int32 NumMatrices,
+        FNormalVertex* OutVertices);
+}
@@ -946,7 +946,7 @@ void UClothComponent::UpdateDynamicMesh()
     }
 }
 
-void UClothComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UClothComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
     if (!DynamicMesh || !DynamicMesh->IsInitialized())
     {
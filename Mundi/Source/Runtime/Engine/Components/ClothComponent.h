@@ -206,7 +206,7 @@ public:
     void UpdateDynamicMesh();
 
     // ===== Batch Rendering =====
-    void CollectMeshBatches(TArray<struct FMeshBatchElement>& OutMeshBatchElements, const struct FSceneView* View) override;
+    void CollectMeshBatches(TFrameArray<struct FMeshBatchElement>& OutMeshBatchElements, const struct FSceneView* View) override;
 
     // ===== Duplication =====
     void DuplicateSubObjects() override;
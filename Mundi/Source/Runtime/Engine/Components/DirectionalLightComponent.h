@@ -39,7 +39,7 @@ public:
 
 	UPROPERTY(EditAnywhere, Category="ShadowMap", Range="-1, 8")
 	int CascadedAreaShadowDebugValue = -1;
-	void GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests) override;
+	void GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests) override;
 
 	// 월드 회전을 반영한 라이트 방향 반환 (Transform의 Forward 벡터)
 	FVector GetLightDirection() const;
@@ -26,6 +26,9 @@
 #include "World.h"
 #include "ObjectFactory.h"
 #include "ParticleEventManager.h"
+#include "ParticleSimulation.h"
+#include "ParticleSort.h"
+#include "ParticleSystemPool.h"
 
 // Quad 버텍스 구조체 (UV만 포함)
 struct FSpriteQuadVertex
@@ -99,19 +102,6 @@ UParticleSystemComponent::~UParticleSystemComponent()
 		bOwnsTemplate = false;
 	}
 
-	if (EmitterRenderData.Num() > 0)
-	{
-		for (int32 i = 0; i < EmitterRenderData.Num(); i++)
-		{
-			if (EmitterRenderData[i])
-			{
-				delete EmitterRenderData[i];
-				EmitterRenderData[i] = nullptr;
-			}
-		}
-		EmitterRenderData.Empty();
-	}
-
 	// 스프라이트 인스턴스 버퍼 해제
 	if (SpriteInstanceBuffer)
 	{
@@ -391,6 +381,7 @@ void UParticleSystemComponent::CreateDebugSpriteParticleSystem()
 	SizeModule->SizeOverLife.Type = EDistributionType::ConstantCurve;
 	SizeModule->SizeOverLife.ConstantCurve.Points.Add(FInterpCurvePointVector(0.0f, FVector(5.0f, 5.0f, 5.0f)));
 	SizeModule->SizeOverLife.ConstantCurve.Points.Add(FInterpCurvePointVector(1.0f, FVector(15.0f, 15.0f, 15.0f)));
+	SizeModule->SizeOverLife.Bake();
 	LODLevel->Modules.Add(SizeModule);
 
 	// 색상 모듈 (페이드 아웃 효과)
@@ -401,6 +392,7 @@ void UParticleSystemComponent::CreateDebugSpriteParticleSystem()
 	ColorModule->ColorOverLife.Alpha.Type = EDistributionType::ConstantCurve;
 	ColorModule->ColorOverLife.Alpha.ConstantCurve.Points.Add(FInterpCurvePointFloat(0.0f, 1.0f));
 	ColorModule->ColorOverLife.Alpha.ConstantCurve.Points.Add(FInterpCurvePointFloat(1.0f, 0.0f));
+	ColorModule->ColorOverLife.Bake();
 	LODLevel->Modules.Add(ColorModule);
 
 	// 회전 모듈 (2D 회전)
@@ -553,18 +545,25 @@ void UParticleSystemComponent::CreateDebugRibbonParticleSystem()
 
 void UParticleSystemComponent::OnUnregister()
 {
-	// 이미터 인스턴스 정리
-	DeactivateSystem();
+	// 풀 목록에서 제외 (레벨 정리 등으로 풀 밖에서 파괴되는 경우)
+	if (OwningPool)
+	{
+		OwningPool->NotifyComponentDestroyed(this);
+	}
 
-	// 렌더 데이터 정리
-	for (int32 i = 0; i < EmitterRenderData.Num(); i++)
+	// 이번 프레임 시뮬레이션 대기 목록에서 제외
+	if (UWorld* World = GetWorld())
 	{
-		if (EmitterRenderData[i])
+		if (FParticleSimulation* Simulation = World->GetParticleSimulation())
 		{
-			delete EmitterRenderData[i];
-			EmitterRenderData[i] = nullptr;
+			Simulation->Remove(this);
 		}
 	}
+
+	// 이미터 인스턴스 정리
+	DeactivateSystem();
+
+	// 렌더 데이터 정리
 	EmitterRenderData.Empty();
 
 	// 인스턴스 버퍼 정리
@@ -622,6 +621,19 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 {
 	USceneComponent::TickComponent(DeltaTime);
 
+	// 풀에 반납된 동안에는 시뮬레이션하지 않음
+	if (bInPool)
+	{
+		return;
+	}
+
+	// 풀에서 꺼낸 일회성 이펙트는 재생이 끝나면 스스로 반납
+	if (OwningPool && HasCompleted())
+	{
+		OwningPool->Release(this);
+		return;
+	}
+
 	// BeamTargetPosition 프로퍼티를 InstanceParameters에 동기화
 	SetVectorParameter("BeamTarget", BeamTargetPosition);
 
@@ -663,7 +675,17 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 	// 이벤트 클리어 (매 프레임 시작 시)
 	ClearEvents();
 
-	// 모든 이미터 인스턴스 틱
+	// 이미터 틱은 액터 틱이 끝난 뒤 월드의 파티클 시뮬레이션 단계에서 다른 컴포넌트와 함께 병렬로 수행
+	if (UWorld* World = GetWorld())
+	{
+		if (FParticleSimulation* Simulation = World->GetParticleSimulation())
+		{
+			Simulation->Enqueue(this, DeltaTime);
+			return;
+		}
+	}
+
+	// 월드가 없으면 바로 순차 틱
 	for (FParticleEmitterInstance* Instance : EmitterInstances)
 	{
 		if (Instance)
@@ -672,6 +694,14 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 		}
 	}
 
+	FinishSimulation();
+}
+
+void UParticleSystemComponent::FinishSimulation()
+{
+	// 이미터별로 모아둔 이벤트를 이미터 순서대로 합침 (순차 틱과 같은 순서)
+	MergeEmitterEvents();
+
 	// 렌더 데이터 업데이트
 	UpdateRenderData();
 
@@ -707,6 +737,26 @@ void UParticleSystemComponent::ClearEvents()
 	DeathEvents.Empty();
 }
 
+void UParticleSystemComponent::MergeEmitterEvents()
+{
+	for (FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (!Instance)
+		{
+			continue;
+		}
+
+		CollisionEvents.Append(Instance->DeferredCollisionEvents);
+		SpawnEvents.Append(Instance->DeferredSpawnEvents);
+		DeathEvents.Append(Instance->DeferredDeathEvents);
+
+		Instance->DeferredCollisionEvents.Empty();
+		Instance->DeferredSpawnEvents.Empty();
+		Instance->DeferredDeathEvents.Empty();
+		Instance->bDeferEvents = false;
+	}
+}
+
 void UParticleSystemComponent::AddCollisionEvent(const FParticleEventCollideData& Event)
 {
 	CollisionEvents.Add(Event);
@@ -810,6 +860,7 @@ void UParticleSystemComponent::ActivateSystem()
 	if (Template)
 	{
 		InitializeEmitterInstances();
+		bInPool = false;
 	}
 }
 
@@ -818,6 +869,45 @@ void UParticleSystemComponent::DeactivateSystem()
 	ClearEmitterInstances();
 }
 
+bool UParticleSystemComponent::HasCompleted() const
+{
+	// 비활성화된 시스템(인스턴스 없음)도 끝난 것으로 본다
+	for (const FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (!Instance)
+		{
+			continue;
+		}
+
+		// 꺼진 LOD는 스폰하지 않으므로 끝난 것으로 본다
+		const bool bCanSpawn = Instance->bEmitterEnabled && Instance->CurrentLODLevel && Instance->CurrentLODLevel->bEnabled;
+		if (bCanSpawn || Instance->ActiveParticles > 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void UParticleSystemComponent::EnterPooledState()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (FParticleSimulation* Simulation = World->GetParticleSimulation())
+		{
+			Simulation->Remove(this);
+		}
+	}
+
+	ResetParticles();
+	ClearEvents();
+
+	EmitterRenderData.Empty();
+	SpriteDrawOrderSerial = 0;
+
+	bInPool = true;
+}
+
 void UParticleSystemComponent::ResetParticles()
 {
 	for (FParticleEmitterInstance* Instance : EmitterInstances)
@@ -997,13 +1087,43 @@ void UParticleSystemComponent::RefreshDebugParticleSystem()
 
 void UParticleSystemComponent::InitializeEmitterInstances()
 {
-	ClearEmitterInstances();
-
 	if (!Template)
 	{
+		ClearEmitterInstances();
+		return;
+	}
+
+	// 같은 템플릿으로 다시 활성화하면 (풀 재사용 포함) 인스턴스를 지우지 않고 제자리에서 재초기화
+	// Init이 파티클/인스턴스 데이터 버퍼를 크기 그대로 재사용한다
+	int32 NumTemplateEmitters = 0;
+	bool bCanReuseInstances = EmitterInstances.Num() > 0;
+	for (UParticleEmitter* Emitter : Template->Emitters)
+	{
+		if (!Emitter)
+		{
+			continue;
+		}
+		if (NumTemplateEmitters >= EmitterInstances.Num() || !EmitterInstances[NumTemplateEmitters] ||
+			EmitterInstances[NumTemplateEmitters]->SpriteTemplate != Emitter)
+		{
+			bCanReuseInstances = false;
+			break;
+		}
+		++NumTemplateEmitters;
+	}
+
+	if (bCanReuseInstances && NumTemplateEmitters == EmitterInstances.Num())
+	{
+		CurrentLODLevel = 0;
+		for (FParticleEmitterInstance* Instance : EmitterInstances)
+		{
+			Instance->Init(this, Instance->SpriteTemplate);
+		}
 		return;
 	}
 
+	ClearEmitterInstances();
+
 	// 이미터 인스턴스 생성
 	for (UParticleEmitter* Emitter : Template->Emitters)
 	{
@@ -1018,6 +1138,9 @@ void UParticleSystemComponent::InitializeEmitterInstances()
 
 void UParticleSystemComponent::ClearEmitterInstances()
 {
+	// 렌더 데이터는 이미터 인스턴스가 소유하므로 함께 비운다
+	EmitterRenderData.Empty();
+
 	for (FParticleEmitterInstance* Instance : EmitterInstances)
 	{
 		if (Instance)
@@ -1030,15 +1153,7 @@ void UParticleSystemComponent::ClearEmitterInstances()
 
 void UParticleSystemComponent::UpdateRenderData()
 {
-	// 기존 렌더 데이터 제거
-	for (int32 i = 0; i < EmitterRenderData.Num(); i++)
-	{
-		if (EmitterRenderData[i])
-		{
-			delete EmitterRenderData[i];
-			EmitterRenderData[i] = nullptr;
-		}
-	}
+	// 지난 프레임 렌더 데이터 목록 비움 (객체는 각 이미터 인스턴스가 재사용)
 	EmitterRenderData.Empty();
 
 	// 각 이미터 인스턴스에서 GetDynamicData() 호출 (캡슐화된 패턴)
@@ -1058,6 +1173,9 @@ void UParticleSystemComponent::UpdateRenderData()
 			EmitterRenderData.Add(DynamicData);
 		}
 	}
+
+	RenderDataFrame = FFrameMemory::GetInstance().GetFrameNumber();
+	++RenderDataSerial;
 }
 
 // 언리얼 엔진 호환: 인스턴스 파라미터 시스템 구현
@@ -1173,11 +1291,20 @@ void UParticleSystemComponent::DuplicateSubObjects()
 	EmitterInstances.Empty();
 	EmitterRenderData.Empty();
 
+	// 시뮬레이션 대기 목록은 원본 월드 것이므로 복사본은 대기 중 아님
+	PendingSimulationIndex = -1;
+
+	// 풀도 원본 월드 것이므로 복사본은 일반 컴포넌트로 취급
+	OwningPool = nullptr;
+	PoolTemplate = nullptr;
+	bInPool = false;
+
 	// 인스턴스 버퍼도 원본 소유이므로 nullptr로 초기화
 	MeshInstanceBuffer = nullptr;
 	AllocatedMeshInstanceCount = 0;
 	SpriteInstanceBuffer = nullptr;
 	AllocatedSpriteInstanceCount = 0;
+	SpriteDrawOrderSerial = 0;
 
 	// 빔 버퍼도 원본 소유이므로 nullptr로 초기화
 	BeamVertexBuffer = nullptr;
@@ -1199,7 +1326,7 @@ void UParticleSystemComponent::DuplicateSubObjects()
 	CachedParticleMaterials.Empty();
 }
 
-void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	// 0. 런타임 LOD 업데이트 (카메라 거리 기반)
 	if (View)
@@ -1207,34 +1334,22 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
 		UpdateLODLevels(View->ViewLocation);
 	}
 
-	// 1. 유효성 검사
-	if (!IsVisible() || EmitterRenderData.Num() == 0)
+	// 1. 유효성 검사 (풀에 반납된 컴포넌트는 그리지 않음)
+	if (!IsVisible() || bInPool || EmitterRenderData.Num() == 0)
 	{
 		return;
 	}
 
-	// 2. 스프라이트 파티클 수 계산 및 정렬
-	int32 TotalSpriteParticles = 0;
-
-	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
+	// 틱이 멈춰 렌더 데이터가 오래됐으면 (프레임 아레나가 이미 회수됨) 다시 만듦
+	if (!FFrameMemory::GetInstance().IsFrameDataValid(RenderDataFrame))
 	{
-		if (!EmitterData)
-			continue;
-
-		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
-
-		if (Source.eEmitterType == EDynamicEmitterType::Sprite)
-		{
-			TotalSpriteParticles += Source.ActiveParticleCount;
-
-			// 스프라이트 이미터에 대해 정렬 수행
-			auto* SpriteData = static_cast<FDynamicSpriteEmitterDataBase*>(EmitterData);
-			FVector ViewOrigin = View ? View->ViewLocation : FVector(0.0f, 0.0f, 0.0f);
-			FVector ViewDirection = View ? View->ViewRotation.GetForwardVector() : FVector(1.0f, 0.0f, 0.0f);
-			SpriteData->SortSpriteParticles(Source.SortMode, ViewOrigin, ViewDirection);
-		}
+		UpdateRenderData();
 	}
 
+	// 2. 스프라이트 정렬 및 그리기 순서 계산 (렌더 데이터와 뷰가 그대로면 지난 결과 재사용)
+	BuildSpriteDrawOrder(View);
+	const int32 TotalSpriteParticles = SpriteDrawOrder.Num();
+
 	// 3. 스프라이트 파티클 처리 (인스턴싱)
 	if (TotalSpriteParticles > 0)
 	{
@@ -1442,7 +1557,7 @@ void UParticleSystemComponent::FillMeshInstanceBuffer(uint32 TotalInstances)
 	Context->Unmap(MeshInstanceBuffer, 0);
 }
 
-void UParticleSystemComponent::CreateMeshParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UParticleSystemComponent::CreateMeshParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
 	if (!MeshInstanceBuffer)
 	{
@@ -1614,6 +1729,222 @@ void UParticleSystemComponent::CreateMeshParticleBatch(TArray<FMeshBatchElement>
 	}
 }
 
+namespace
+{
+	// Distance 정렬 이미터들을 병합했을 때 허용하는 최대 배치 수
+	// 깊이가 섞여 이미터가 자주 바뀌면 드로우 콜이 파티클 수만큼 늘어나므로 이미터별 순서로 되돌린다
+	constexpr int32 MaxMergedSpriteRuns = 64;
+
+	// 인접한 두 이미터의 인스턴스를 한 번의 드로우로 그릴 수 있는지 (머티리얼, SubUV 시트가 같아야 함)
+	bool CanShareSpriteBatch(const FDynamicEmitterDataBase* A, const FDynamicEmitterDataBase* B)
+	{
+		if (A == B)
+		{
+			return true;
+		}
+
+		const auto& SourceA = static_cast<const FDynamicSpriteEmitterReplayDataBase&>(A->GetSource());
+		const auto& SourceB = static_cast<const FDynamicSpriteEmitterReplayDataBase&>(B->GetSource());
+		if (SourceA.MaterialInterface != SourceB.MaterialInterface)
+		{
+			return false;
+		}
+
+		const int32 HA = SourceA.RequiredModule ? SourceA.RequiredModule->SubImages_Horizontal : 1;
+		const int32 VA = SourceA.RequiredModule ? SourceA.RequiredModule->SubImages_Vertical : 1;
+		const int32 HB = SourceB.RequiredModule ? SourceB.RequiredModule->SubImages_Horizontal : 1;
+		const int32 VB = SourceB.RequiredModule ? SourceB.RequiredModule->SubImages_Vertical : 1;
+		return HA == HB && VA == VB;
+	}
+
+	inline uint32 PackSpriteDrawEntry(int32 RenderDataIndex, uint32 ParticleIndex)
+	{
+		return (static_cast<uint32>(RenderDataIndex) << 16) | ParticleIndex;
+	}
+}
+
+void UParticleSystemComponent::BuildSpriteDrawOrder(const FSceneView* View)
+{
+	const FVector ViewOrigin = View ? View->ViewLocation : FVector(0.0f, 0.0f, 0.0f);
+	const FVector ViewDirection = View ? View->ViewRotation.GetForwardVector() : FVector(1.0f, 0.0f, 0.0f);
+	const FMatrix ComponentLocalToWorld = GetWorldTransform().ToMatrix();
+
+	// 틱이 멈춘 상태(일시정지, 에디터 뷰포트 여러 번 그리기)에서 같은 뷰면 정렬 결과가 같다
+	if (SpriteDrawOrderSerial == RenderDataSerial &&
+		SpriteDrawOrderViewOrigin == ViewOrigin &&
+		SpriteDrawOrderViewDirection == ViewDirection &&
+		SpriteDrawOrderLocalToWorld == ComponentLocalToWorld)
+	{
+		return;
+	}
+
+	SpriteDrawOrderSerial = RenderDataSerial;
+	SpriteDrawOrderViewOrigin = ViewOrigin;
+	SpriteDrawOrderViewDirection = ViewDirection;
+	SpriteDrawOrderLocalToWorld = ComponentLocalToWorld;
+
+	SpriteDrawOrder.Empty();
+	SpriteDrawRuns.Empty();
+
+	// 깊이 평면: 월드 깊이 = Dot(P - ViewOrigin, ViewDirection)
+	const FVector4 WorldDepthPlane(ViewDirection.X, ViewDirection.Y, ViewDirection.Z, -FVector::Dot(ViewOrigin, ViewDirection));
+
+	// 로컬 스페이스 이미터는 P_world = P_local * M 이므로 평면에 행렬을 접어 넣는다
+	// 깊이 = Σ_i P_i * Dot(M[i], D) + Dot(T - ViewOrigin, D)
+	const FMatrix& M = ComponentLocalToWorld;
+	const FVector Translation(M.M[3][0], M.M[3][1], M.M[3][2]);
+	const FVector4 LocalDepthPlane(
+		M.M[0][0] * ViewDirection.X + M.M[0][1] * ViewDirection.Y + M.M[0][2] * ViewDirection.Z,
+		M.M[1][0] * ViewDirection.X + M.M[1][1] * ViewDirection.Y + M.M[1][2] * ViewDirection.Z,
+		M.M[2][0] * ViewDirection.X + M.M[2][1] * ViewDirection.Y + M.M[2][2] * ViewDirection.Z,
+		FVector::Dot(Translation - ViewOrigin, ViewDirection));
+
+	// 1. 이미터별 정렬, Distance 정렬 이미터의 키는 병합용으로 모아 둔다
+	int32 TotalSprites = 0;
+	int32 NumMergedSprites = 0;
+	int32 NumMergedEmitters = 0;
+	int32 FirstMergedEmitter = -1;
+	for (int32 RenderIndex = 0; RenderIndex < EmitterRenderData.Num(); RenderIndex++)
+	{
+		FDynamicEmitterDataBase* EmitterData = EmitterRenderData[RenderIndex];
+		if (!EmitterData || EmitterData->GetSource().eEmitterType != EDynamicEmitterType::Sprite)
+			continue;
+
+		const int32 Count = EmitterData->GetSource().ActiveParticleCount;
+		TotalSprites += Count;
+		if (Count > 0 && EmitterData->GetSource().SortMode == 2)
+		{
+			NumMergedSprites += Count;
+			++NumMergedEmitters;
+			if (FirstMergedEmitter < 0)
+			{
+				FirstMergedEmitter = RenderIndex;
+			}
+		}
+	}
+
+	if (TotalSprites == 0)
+	{
+		return;
+	}
+
+	const bool bMergeDistanceSorted = NumMergedEmitters > 1;
+	FFrameArena& Arena = FFrameMemory::GetInstance().GetCurrentArena();
+	uint32* MergedKeys = nullptr;
+	uint32* MergedValues = nullptr;
+	int32* MergedRunStarts = nullptr;
+	if (bMergeDistanceSorted)
+	{
+		MergedKeys = static_cast<uint32*>(Arena.Allocate(static_cast<SIZE_T>(NumMergedSprites) * sizeof(uint32), 16));
+		MergedValues = static_cast<uint32*>(Arena.Allocate(static_cast<SIZE_T>(NumMergedSprites) * sizeof(uint32), 16));
+		MergedRunStarts = static_cast<int32*>(Arena.Allocate(static_cast<SIZE_T>(NumMergedEmitters) * sizeof(int32), alignof(int32)));
+	}
+
+	int32 MergedOffset = 0;
+	int32 MergedRun = 0;
+	for (int32 RenderIndex = 0; RenderIndex < EmitterRenderData.Num(); RenderIndex++)
+	{
+		FDynamicEmitterDataBase* EmitterData = EmitterRenderData[RenderIndex];
+		if (!EmitterData)
+			continue;
+
+		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
+		if (Source.eEmitterType != EDynamicEmitterType::Sprite || Source.ActiveParticleCount == 0 || Source.SortMode == 0)
+			continue;
+
+		const auto& SpriteSource = static_cast<const FDynamicSpriteEmitterReplayDataBase&>(Source);
+		const bool bLocalSpace = SpriteSource.RequiredModule && SpriteSource.RequiredModule->bUseLocalSpace;
+		const bool bMerged = bMergeDistanceSorted && Source.SortMode == 2;
+		uint32* SortedKeys = bMerged ? MergedKeys + MergedOffset : nullptr;
+
+		auto* SpriteData = static_cast<FDynamicSpriteEmitterDataBase*>(EmitterData);
+		SpriteData->SortSpriteParticles(Source.SortMode, bLocalSpace ? LocalDepthPlane : WorldDepthPlane, SortedKeys);
+
+		const uint16* SortedIndices = Source.DataContainer.ParticleIndices;
+		const int32 EmitterIndex = EmitterData->EmitterIndex;
+		if (EmitterIndex >= 0 && EmitterIndex < EmitterInstances.Num() && EmitterInstances[EmitterIndex])
+		{
+			EmitterInstances[EmitterIndex]->StoreSortedOrder(SortedIndices, Source.ActiveParticleCount);
+		}
+
+		if (bMerged)
+		{
+			MergedRunStarts[MergedRun++] = MergedOffset;
+			for (int32 i = 0; i < Source.ActiveParticleCount; i++)
+			{
+				MergedValues[MergedOffset + i] = PackSpriteDrawEntry(RenderIndex, SortedIndices[i]);
+			}
+			MergedOffset += Source.ActiveParticleCount;
+		}
+	}
+
+	// 2. Distance 정렬 이미터끼리 깊이 순으로 병합 (이미터 경계에서도 먼 것부터 그려진다)
+	bool bUseMergedOrder = false;
+	if (bMergeDistanceSorted)
+	{
+		ParticleSort::MergeSortedRuns(MergedKeys, MergedValues, MergedRunStarts, NumMergedEmitters, NumMergedSprites);
+
+		int32 NumRuns = 1;
+		int32 RunEmitter = static_cast<int32>(MergedValues[0] >> 16);
+		for (int32 i = 1; i < NumMergedSprites && NumRuns <= MaxMergedSpriteRuns; i++)
+		{
+			const int32 Emitter = static_cast<int32>(MergedValues[i] >> 16);
+			if (Emitter != RunEmitter && !CanShareSpriteBatch(EmitterRenderData[RunEmitter], EmitterRenderData[Emitter]))
+			{
+				++NumRuns;
+				RunEmitter = Emitter;
+			}
+		}
+		bUseMergedOrder = NumRuns <= MaxMergedSpriteRuns;
+	}
+
+	// 3. 최종 그리기 순서 (병합된 그룹은 첫 Distance 이미터 자리에 들어간다)
+	SpriteDrawOrder.SetNum(TotalSprites);
+	int32 NumDrawn = 0;
+	for (int32 RenderIndex = 0; RenderIndex < EmitterRenderData.Num(); RenderIndex++)
+	{
+		FDynamicEmitterDataBase* EmitterData = EmitterRenderData[RenderIndex];
+		if (!EmitterData)
+			continue;
+
+		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
+		if (Source.eEmitterType != EDynamicEmitterType::Sprite || Source.ActiveParticleCount == 0)
+			continue;
+
+		if (bUseMergedOrder && Source.SortMode == 2)
+		{
+			if (RenderIndex == FirstMergedEmitter)
+			{
+				memcpy(SpriteDrawOrder.GetData() + NumDrawn, MergedValues, static_cast<size_t>(NumMergedSprites) * sizeof(uint32));
+				NumDrawn += NumMergedSprites;
+			}
+			continue;
+		}
+
+		const uint16* ParticleIndices = Source.DataContainer.ParticleIndices;
+		for (int32 i = 0; i < Source.ActiveParticleCount; i++)
+		{
+			SpriteDrawOrder[NumDrawn++] = PackSpriteDrawEntry(RenderIndex, ParticleIndices ? ParticleIndices[i] : static_cast<uint32>(i));
+		}
+	}
+
+	// 4. 배치 상태가 같은 연속 구간을 하나의 드로우로 묶는다
+	for (int32 i = 0; i < NumDrawn; i++)
+	{
+		const int32 RenderIndex = static_cast<int32>(SpriteDrawOrder[i] >> 16);
+		if (SpriteDrawRuns.IsEmpty() ||
+			(SpriteDrawRuns.Last().RenderDataIndex != RenderIndex &&
+			 !CanShareSpriteBatch(EmitterRenderData[SpriteDrawRuns.Last().RenderDataIndex], EmitterRenderData[RenderIndex])))
+		{
+			FSpriteDrawRun Run;
+			Run.RenderDataIndex = RenderIndex;
+			Run.StartInstance = static_cast<uint32>(i);
+			SpriteDrawRuns.Add(Run);
+		}
+		++SpriteDrawRuns.Last().NumInstances;
+	}
+}
+
 void UParticleSystemComponent::FillSpriteInstanceBuffer(uint32 TotalInstances)
 {
 	if (TotalInstances == 0)
@@ -1660,89 +1991,80 @@ void UParticleSystemComponent::FillSpriteInstanceBuffer(uint32 TotalInstances)
 	}
 
 	FSpriteParticleInstanceVertex* Instances = static_cast<FSpriteParticleInstanceVertex*>(MappedData.pData);
-	uint32 InstanceOffset = 0;
 
-	// 스프라이트 이미터 순회
-	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
+	// 이미터별 설정은 이미터가 바뀔 때만 다시 읽는다 (병합 순서에서는 이미터가 섞여 나옴)
+	int32 CachedRenderIndex = -1;
+	const uint8* ParticleData = nullptr;
+	int32 ParticleStride = 0;
+	int32 TotalFrames = 1;
+	bool bUseLocalSpace = false;
+
+	// 그리기 순서대로 인스턴스 데이터 생성
+	for (uint32 InstanceOffset = 0; InstanceOffset < TotalInstances; InstanceOffset++)
 	{
-		if (!EmitterData)
-			continue;
+		const uint32 Entry = SpriteDrawOrder[InstanceOffset];
+		const int32 RenderIndex = static_cast<int32>(Entry >> 16);
+		const int32 ParticleIndex = static_cast<int32>(Entry & 0xFFFF);
 
-		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
-		if (Source.eEmitterType != EDynamicEmitterType::Sprite)
-			continue;
+		if (RenderIndex != CachedRenderIndex)
+		{
+			CachedRenderIndex = RenderIndex;
+			const auto& Source = static_cast<const FDynamicSpriteEmitterReplayDataBase&>(EmitterRenderData[RenderIndex]->GetSource());
+			ParticleData = Source.DataContainer.ParticleData;
+			ParticleStride = Source.ParticleStride;
 
-		const int32 ParticleCount = Source.ActiveParticleCount;
-		const int32 ParticleStride = Source.ParticleStride;
-		const uint8* ParticleData = Source.DataContainer.ParticleData;
-		const uint16* ParticleIndices = Source.DataContainer.ParticleIndices;
+			// Sub-UV 설정 가져오기
+			TotalFrames = 1;
+			bUseLocalSpace = false;
+			if (Source.RequiredModule)
+			{
+				const int32 SubImages_H = Source.RequiredModule->SubImages_Horizontal;
+				const int32 SubImages_V = Source.RequiredModule->SubImages_Vertical;
+				const int32 MaxElements = Source.RequiredModule->SubUV_MaxElements;
+				TotalFrames = (MaxElements > 0) ? MaxElements : (SubImages_H * SubImages_V);
+				bUseLocalSpace = Source.RequiredModule->bUseLocalSpace;
+			}
+		}
 
-		if (!ParticleData || ParticleCount == 0)
-			continue;
+		const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(
+			ParticleData + ParticleIndex * ParticleStride
+		);
 
-		// Sub-UV 설정 가져오기
-		const FDynamicSpriteEmitterData* SpriteEmitterData = static_cast<const FDynamicSpriteEmitterData*>(EmitterData);
-		int32 SubImages_H = 1;
-		int32 SubImages_V = 1;
-		int32 TotalFrames = 1;
+		FSpriteParticleInstanceVertex& Instance = Instances[InstanceOffset];
 
-		bool bUseLocalSpace = false;
-		if (SpriteEmitterData->Source.RequiredModule)
+		// 월드 위치
+		if (bUseLocalSpace)
 		{
-			SubImages_H = SpriteEmitterData->Source.RequiredModule->SubImages_Horizontal;
-			SubImages_V = SpriteEmitterData->Source.RequiredModule->SubImages_Vertical;
-			int32 MaxElements = SpriteEmitterData->Source.RequiredModule->SubUV_MaxElements;
-			TotalFrames = (MaxElements > 0) ? MaxElements : (SubImages_H * SubImages_V);
-			bUseLocalSpace = SpriteEmitterData->Source.RequiredModule->bUseLocalSpace;
+			// 로컬 스페이스: (0,0,0) 기준인 파티클 위치에 컴포넌트 행렬을 곱해 월드로 보냄
+			Instance.WorldPosition = ComponentLocalToWorld.TransformPosition(Particle->Location);
 		}
-
-		// 각 파티클의 인스턴스 데이터 생성
-		for (int32 ParticleIdx = 0; ParticleIdx < ParticleCount; ParticleIdx++)
+		else
 		{
-			const int32 ParticleIndex = ParticleIndices ? ParticleIndices[ParticleIdx] : ParticleIdx;
-			const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(
-				ParticleData + ParticleIndex * ParticleStride
-			);
-
-			FSpriteParticleInstanceVertex& Instance = Instances[InstanceOffset];
-
-			// 월드 위치
-			if (bUseLocalSpace)
-			{
-				// 로컬 스페이스: (0,0,0) 기준인 파티클 위치에 컴포넌트 행렬을 곱해 월드로 보냄
-				// FMatrix::TransformPosition(FVector) 가정
-				Instance.WorldPosition = ComponentLocalToWorld.TransformPosition(Particle->Location);
-			}
-			else
-			{
-				// 월드 스페이스: 이미 시뮬레이션 단계에서 월드 좌표로 계산됨
-				Instance.WorldPosition = Particle->Location;
-			}
-			
-			// 회전 (Z축만)
-			Instance.Rotation = Particle->Rotation;
+			// 월드 스페이스: 이미 시뮬레이션 단계에서 월드 좌표로 계산됨
+			Instance.WorldPosition = Particle->Location;
+		}
 
-			// 크기 (XY만)
-			Instance.Size = FVector2D(Particle->Size.X, Particle->Size.Y);
+		// 회전 (Z축만)
+		Instance.Rotation = Particle->Rotation;
 
-			// 색상
-			Instance.Color = Particle->Color;
+		// 크기 (XY만)
+		Instance.Size = FVector2D(Particle->Size.X, Particle->Size.Y);
 
-			// RelativeTime
-			Instance.RelativeTime = Particle->RelativeTime;
+		// 색상
+		Instance.Color = Particle->Color;
 
-			// Sub-UV 프레임 인덱스 계산
-			// RelativeTime (0~1)을 프레임 인덱스 (0~TotalFrames-1)로 변환
-			Instance.SubImageIndex = Particle->RelativeTime * (float)(TotalFrames - 1);
+		// RelativeTime
+		Instance.RelativeTime = Particle->RelativeTime;
 
-			InstanceOffset++;
-		}
+		// Sub-UV 프레임 인덱스 계산
+		// RelativeTime (0~1)을 프레임 인덱스 (0~TotalFrames-1)로 변환
+		Instance.SubImageIndex = Particle->RelativeTime * (float)(TotalFrames - 1);
 	}
 
 	Context->Unmap(SpriteInstanceBuffer, 0);
 }
 
-void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
+void UParticleSystemComponent::CreateSpriteParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements)
 {
 	if (!SpriteInstanceBuffer)
 	{
@@ -1757,25 +2079,14 @@ void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElemen
 		return;
 	}
 
-	// 인스턴스 버퍼 내 현재 오프셋 (각 이미터별로 증가)
-	uint32 InstanceOffset = 0;
-
-	// 각 스프라이트 이미터별로 별도의 배치 생성
-	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
+	// 그리기 순서의 구간마다 배치 생성 (같은 머티리얼의 연속 구간은 이미터가 달라도 한 배치)
+	for (const FSpriteDrawRun& Run : SpriteDrawRuns)
 	{
-		if (!EmitterData)
-			continue;
-
-		const FDynamicEmitterReplayDataBase& Source = EmitterData->GetSource();
-		if (Source.eEmitterType != EDynamicEmitterType::Sprite)
-			continue;
-
-		const auto& SpriteSource = static_cast<const FDynamicSpriteEmitterReplayDataBase&>(Source);
+		const auto& SpriteSource = static_cast<const FDynamicSpriteEmitterReplayDataBase&>(EmitterRenderData[Run.RenderDataIndex]->GetSource());
 		UMaterialInterface* Material = SpriteSource.MaterialInterface;
-		int32 EmitterInstanceCount = Source.ActiveParticleCount;
 
 		// Material이 없거나 파티클이 없으면 스킵
-		if (!Material || EmitterInstanceCount == 0)
+		if (!Material || Run.NumInstances == 0)
 		{
 			continue;
 		}
@@ -1806,11 +2117,11 @@ void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElemen
 		BatchElement.IndexBuffer = SpriteQuadIndexBuffer.Get();
 		BatchElement.VertexStride = sizeof(FSpriteQuadVertex);
 
-		// 이 이미터의 인스턴스 수와 시작 위치 설정
-		BatchElement.NumInstances = EmitterInstanceCount;
+		// 이 구간의 인스턴스 수와 시작 위치 설정
+		BatchElement.NumInstances = Run.NumInstances;
 		BatchElement.InstanceBuffer = SpriteInstanceBuffer;
 		BatchElement.InstanceStride = sizeof(FSpriteParticleInstanceVertex);
-		BatchElement.StartInstanceLocation = InstanceOffset;
+		BatchElement.StartInstanceLocation = Run.StartInstance;
 
 		BatchElement.IndexCount = 6;  // 2 triangles
 		BatchElement.StartIndex = 0;
@@ -1838,9 +2149,6 @@ void UParticleSystemComponent::CreateSpriteParticleBatch(TArray<FMeshBatchElemen
 		}
 
 		OutMeshBatchElements.Add(BatchElement);
-
-		// 다음 이미터를 위해 오프셋 증가
-		InstanceOffset += EmitterInstanceCount;
 	}
 }
 
@@ -1992,7 +2300,7 @@ void UParticleSystemComponent::FillBeamBuffers(const FSceneView* View)
 	Context->Unmap(BeamIndexBuffer, 0);
 }
 
-void UParticleSystemComponent::CreateBeamParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
+void UParticleSystemComponent::CreateBeamParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements)
 {
 	if (!BeamVertexBuffer || !BeamIndexBuffer)
 	{
@@ -2236,7 +2544,7 @@ void UParticleSystemComponent::FillRibbonBuffers(const FSceneView* View)
 	Context->Unmap(RibbonIndexBuffer, 0);
 }
 
-void UParticleSystemComponent::CreateRibbonParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements)
+void UParticleSystemComponent::CreateRibbonParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements)
 {
 	if (!RibbonVertexBuffer || !RibbonIndexBuffer)
 	{
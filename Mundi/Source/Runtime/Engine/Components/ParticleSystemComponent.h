@@ -9,6 +9,7 @@
 
 struct FMeshBatchElement;
 struct FSceneView;
+class FParticleSystemPool;
 
 // 디버그 파티클 타입 (Template이 없을 때 사용)
 UENUM()
@@ -48,7 +49,10 @@ public:
 	TArray<FParticleEmitterInstance*> EmitterInstances;
 
 	// 렌더 데이터 (렌더링 스레드용)
+	// 파티클 복사본은 프레임 아레나에 있으므로 RenderDataFrame 기준 2프레임까지만 유효
+	// 각 항목은 이미터 인스턴스의 CachedDynamicData를 가리킴 (소유하지 않음)
 	TArray<FDynamicEmitterDataBase*> EmitterRenderData;
+	uint64 RenderDataFrame = 0;
 
 	// 언리얼 엔진 호환: 인스턴스 파라미터 시스템
 	// 게임플레이에서 파티클 속성을 동적으로 제어 가능
@@ -80,6 +84,24 @@ public:
 	void AddDeathEvent(const FParticleEventData& Event);
 	void DispatchEventsToReceivers();  // EventReceiver 모듈에 이벤트 전달
 
+	// 월드 파티클 시뮬레이션 단계 (FParticleSimulation)
+	// 이번 프레임 대기 목록에서의 위치 (-1이면 대기 중 아님)
+	int32 PendingSimulationIndex = -1;
+	// 이미터 틱이 끝난 뒤 게임 스레드에서 호출: 이벤트 병합 → 렌더 데이터 → 디스패치/브로드캐스트
+	void FinishSimulation();
+
+	// 월드 파티클 풀 (FParticleSystemPool이 만든 컴포넌트만 설정됨)
+	// 반납된 동안에는 이미터 인스턴스와 파티클 버퍼를 유지한 채 틱/렌더를 건너뛰고, 다시 꺼낼 때 제자리에서 재초기화한다
+	FParticleSystemPool* OwningPool = nullptr;
+	UParticleSystem* PoolTemplate = nullptr;   // 풀 키 (Game 월드에서는 Template이 복제본이므로 원본 에셋을 따로 기억)
+	bool bInPool = false;
+
+	// 모든 이미터가 끝났고(Duration/Loops 만료 또는 비활성화) 살아있는 파티클이 없는지 (무한 루프 이미터가 있으면 false)
+	bool HasCompleted() const;
+
+	// 풀 반납 상태로 전환: 파티클/렌더 데이터/이벤트만 비우고 이미터 인스턴스는 남겨둔다 (ActivateSystem으로 복귀)
+	void EnterPooledState();
+
 	// Dynamic Instance Buffer (메시 파티클 인스턴싱용)
 	ID3D11Buffer* MeshInstanceBuffer = nullptr;
 	uint32 AllocatedMeshInstanceCount = 0;
@@ -88,6 +110,25 @@ public:
 	ID3D11Buffer* SpriteInstanceBuffer = nullptr;
 	uint32 AllocatedSpriteInstanceCount = 0;
 
+	// 스프라이트 그리기 순서 (BuildSpriteDrawOrder가 뷰마다 계산, 인스턴스 버퍼와 배치가 이 순서를 따른다)
+	// 값 = (EmitterRenderData 인덱스 << 16) | 렌더 데이터 안의 파티클 인덱스
+	// Distance 정렬 이미터들은 하나의 순서로 병합되고, 배치 상태(머티리얼, SubUV)가 같은 연속 구간이 배치 하나가 된다
+	struct FSpriteDrawRun
+	{
+		int32 RenderDataIndex = 0;   // 머티리얼/SubUV를 가져올 이미터
+		uint32 StartInstance = 0;
+		uint32 NumInstances = 0;
+	};
+	TArray<uint32> SpriteDrawOrder;
+	TArray<FSpriteDrawRun> SpriteDrawRuns;
+
+	// 뷰 캐시: 같은 렌더 데이터를 같은 뷰/트랜스폼으로 다시 그리면 정렬을 건너뛴다
+	uint64 RenderDataSerial = 0;          // UpdateRenderData마다 증가
+	uint64 SpriteDrawOrderSerial = 0;     // SpriteDrawOrder를 만든 렌더 데이터 (0이면 없음)
+	FVector SpriteDrawOrderViewOrigin = FVector(0.0f, 0.0f, 0.0f);
+	FVector SpriteDrawOrderViewDirection = FVector(0.0f, 0.0f, 0.0f);
+	FMatrix SpriteDrawOrderLocalToWorld = FMatrix::Identity();
+
 	// Dynamic Vertex / Index Buffer (빔 파티클용)
 	ID3D11Buffer* BeamVertexBuffer = nullptr;
 	ID3D11Buffer* BeamIndexBuffer = nullptr;
@@ -128,7 +169,7 @@ public:
 	void ResetParticles();
 
 	UFUNCTION(LuaBind, DisplayName="IsActive", Tooltip="Check if the particle system is active")
-	bool IsActive() const { return EmitterInstances.Num() > 0; }
+	bool IsActive() const { return EmitterInstances.Num() > 0 && !bInPool; }
 
 	// 시뮬레이션 속도 제어 (에디터용)
 	void SetSimulationSpeed(float Speed) { CustomTimeScale = Speed; }
@@ -167,28 +208,30 @@ public:
 	// PIE 복사 시 포인터 배열 초기화
 	virtual void DuplicateSubObjects() override;
 
-	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+	void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	// 메시 파티클 인스턴싱
 	void FillMeshInstanceBuffer(uint32 TotalInstances);
-	void CreateMeshParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
+	void CreateMeshParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View);
 
 	// 스프라이트 파티클 인스턴싱
+	void BuildSpriteDrawOrder(const FSceneView* View);
 	void FillSpriteInstanceBuffer(uint32 TotalInstances);
-	void CreateSpriteParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements);
+	void CreateSpriteParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements);
 
 	// 빔 파티클 렌더링
 	void FillBeamBuffers(const FSceneView* View);
-	void CreateBeamParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements);
+	void CreateBeamParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements);
 
 	// 리본 파티클 렌더링
 	void FillRibbonBuffers(const FSceneView* View);
-	void CreateRibbonParticleBatch(TArray<FMeshBatchElement>& OutMeshBatchElements);
+	void CreateRibbonParticleBatch(TFrameArray<FMeshBatchElement>& OutMeshBatchElements);
 
 private:
 	void InitializeEmitterInstances();
 	void ClearEmitterInstances();
 	void UpdateRenderData();
+	void MergeEmitterEvents();
 
 	// === 테스트용 리소스 (디버그 함수에서 생성, Component가 소유) ===
 	float TestTime = 0.0f;
@@ -30,7 +30,7 @@ public:
 
 	UPROPERTY(EditAnywhere, Category="ShadowMap", Range="0, 5")
 	uint32 OverrideCameraLightNum = 0;
-	void GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests) override;
+	void GetShadowRenderRequests(FSceneView* View, TFrameArray<FShadowRenderRequest>& OutRequests) override;
 
 	// Source Radius
 	void SetSourceRadius(float InRadius) { SourceRadius = InRadius; }
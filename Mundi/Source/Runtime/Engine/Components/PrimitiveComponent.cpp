@@ -18,15 +18,19 @@ void UPrimitiveComponent::ApplyPhysicsResult()
     {
         physx::PxTransform PhysicsTransform = BodyInstance.RigidActor->getGlobalPose();
 
-        FTransform Transform = PhysxConverter::ToFTransform(PhysicsTransform);
+        ApplyPhysicsPose(PhysxConverter::ToFTransform(PhysicsTransform));
+    }
+}
 
-        Transform.Scale3D = GetWorldScale();
+void UPrimitiveComponent::ApplyPhysicsPose(const FTransform& PhysicsTransform)
+{
+    FTransform Transform = PhysicsTransform;
 
-        bIsSyncingPhysics = true;
-        SetWorldTransform(Transform);
-        bIsSyncingPhysics = false;
-       
-    }
+    Transform.Scale3D = GetWorldScale();
+
+    bIsSyncingPhysics = true;
+    SetWorldTransform(Transform);
+    bIsSyncingPhysics = false;
 }
 
 void UPrimitiveComponent::CreatePhysicsState()
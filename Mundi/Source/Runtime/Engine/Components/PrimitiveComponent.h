@@ -75,6 +75,9 @@ public:
 
     virtual void ApplyPhysicsResult();
 
+    // 물리 포즈를 월드 트랜스폼으로 반영 (스케일은 유지, 바디로 다시 보내지 않음)
+    void ApplyPhysicsPose(const FTransform& PhysicsTransform);
+
     void CreatePhysicsState() override;
 
     bool ShouldWelding();
@@ -106,7 +109,7 @@ public:
     virtual FAABB GetWorldAABB() const { return FAABB(); }
 
     // 이 프리미티브를 렌더링하는 데 필요한 FMeshBatchElement를 수집합니다.
-    virtual void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
+    virtual void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
 
     virtual UMaterialInterface* GetMaterial(uint32 InElementIndex) const
     {
@@ -23,9 +23,15 @@ USceneComponent::USceneComponent()
 
 USceneComponent::~USceneComponent()
 {
+    // 일괄 갱신 대기열에서 제외
+    if (PendingTransformUpdate)
+    {
+        PendingTransformUpdate->Remove(this);
+    }
+
     // 자식 메모리 해제
     // 복사본을 만들어 부모 리스트 무효화 문제를 피함
-    TArray<USceneComponent*> ChildrenCopy = AttachChildren;
+    TInlineArray<USceneComponent*, 8> ChildrenCopy = AttachChildren;
     AttachChildren.clear();
     for (USceneComponent* Child : ChildrenCopy)
     {
@@ -121,6 +127,17 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
 // World API
 // ──────────────────────────────
 FTransform USceneComponent::GetWorldTransform() const
+{
+    if (bIsTransformDirty || IsTransformCacheBypassed())
+    {
+        CachedComponentToWorld = ComputeWorldTransform();
+        bIsTransformDirty = false;
+        bIsWorldMatrixDirty = true;
+    }
+    return CachedComponentToWorld;
+}
+
+FTransform USceneComponent::ComputeWorldTransform() const
 {
     // Dangling pointer 방지를 위한 체크 
     if (AttachParent && !AttachParent->IsPendingDestroy())
@@ -132,6 +149,127 @@ FTransform USceneComponent::GetWorldTransform() const
     return RelativeTransform;
 }
 
+void USceneComponent::MarkTransformDirty()
+{
+    if (bIsTransformDirty)
+    {
+        return;
+    }
+
+    bIsTransformDirty = true;
+    bIsWorldMatrixDirty = true;
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->MarkTransformDirty();
+        }
+    }
+
+    // 부모가 더티면 부모 쪽 서브트리에 이미 포함되어 있으므로 최상위만 등록
+    // 소켓 서브트리는 조회 시마다 다시 계산되므로 등록하지 않음
+    if (!PendingTransformUpdate && !bHasSocketInParentChain && (!AttachParent || !AttachParent->bIsTransformDirty))
+    {
+        UWorld* World = GetWorld();
+        if (World && World->bBatchUpdateWorldTransforms)
+        {
+            if (FWorldTransformUpdate* TransformUpdate = World->GetWorldTransformUpdate())
+            {
+                TransformUpdate->Enqueue(this);
+            }
+        }
+    }
+}
+
+void USceneComponent::UpdateSocketInParentChain()
+{
+    const bool bSocketAttached = AttachParent && AttachSocketName.IsValid() && !AttachSocketName.ToStringView().empty();
+    const bool bNewValue = AttachParent && (bSocketAttached || AttachParent->bHasSocketInParentChain);
+    if (bHasSocketInParentChain == bNewValue)
+    {
+        return;
+    }
+
+    bHasSocketInParentChain = bNewValue;
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->UpdateSocketInParentChain();
+        }
+    }
+}
+
+void FWorldTransformUpdate::Enqueue(USceneComponent* Root)
+{
+    DirtyRoots.Add(Root);
+    Root->PendingTransformUpdate = this;
+}
+
+void FWorldTransformUpdate::Remove(USceneComponent* Root)
+{
+    DirtyRoots.Remove(Root);
+    Root->PendingTransformUpdate = nullptr;
+}
+
+void FWorldTransformUpdate::Execute()
+{
+    Components.clear();
+    ParentIndices.clear();
+
+    for (USceneComponent* Root : DirtyRoots)
+    {
+        Root->PendingTransformUpdate = nullptr;
+        Components.Add(Root);
+        ParentIndices.Add(-1);
+    }
+    DirtyRoots.clear();
+
+    // 너비 우선 평탄화: 부모가 항상 자식보다 앞에 옴
+    // 소켓 서브트리는 조회 시 매번 다시 계산되므로 내려가지 않음
+    for (int32 i = 0; i < Components.Num(); ++i)
+    {
+        for (USceneComponent* Child : Components[i]->AttachChildren)
+        {
+            if (Child && !Child->bHasSocketInParentChain)
+            {
+                Components.Add(Child);
+                ParentIndices.Add(i);
+            }
+        }
+    }
+
+    const int32 NumComponents = Components.Num();
+    WorldTransforms.resize(NumComponents);
+
+    for (int32 i = 0; i < NumComponents; ++i)
+    {
+        USceneComponent* Component = Components[i];
+
+        // 등록 후 지연 조회로 이미 갱신된 컴포넌트 (더티면 자손도 더티이므로 깨끗한 노드는 부모 결과도 최신)
+        if (!Component->bIsTransformDirty)
+        {
+            WorldTransforms[i] = Component->CachedComponentToWorld;
+            continue;
+        }
+
+        const int32 ParentIndex = ParentIndices[i];
+        if (ParentIndex < 0 || Component->IsTransformCacheBypassed())
+        {
+            // 루트(다른 액터에 붙었을 수 있음) 또는 소켓 부착은 일반 경로로 계산
+            WorldTransforms[i] = Component->ComputeWorldTransform();
+        }
+        else
+        {
+            WorldTransforms[i] = WorldTransforms[ParentIndex].GetWorldTransform(Component->RelativeTransform);
+        }
+
+        Component->CachedComponentToWorld = WorldTransforms[i];
+        Component->bIsTransformDirty = false;
+        Component->bIsWorldMatrixDirty = true;
+    }
+}
+
 void USceneComponent::SetWorldTransform(const FTransform& W)
 {
     // Dangling pointer 방지를 위한 체크
@@ -144,6 +282,7 @@ void USceneComponent::SetWorldTransform(const FTransform& W)
     {
         RelativeTransform = W;
     }
+    MarkTransformDirty();
 
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
@@ -274,10 +413,11 @@ void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat&
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
-    if (bIsTransformDirty || AttachSocketName.IsValid())
+    const FTransform WorldTransform = GetWorldTransform();
+    if (bIsWorldMatrixDirty || IsTransformCacheBypassed())
     {
-        CachedWorldMatrix = GetWorldTransform().ToMatrix();
-        bIsTransformDirty = false;
+        CachedWorldMatrix = WorldTransform.ToMatrix();
+        bIsWorldMatrixDirty = false;
     }
     return CachedWorldMatrix;
 }
@@ -301,6 +441,7 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
     // 새 부모 설정
     AttachParent = InParent;
     AttachSocketName = SocketName;
+    UpdateSocketInParentChain();
 
     if(AttachParent)
     { 
@@ -317,6 +458,7 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
         if (Rule == EAttachmentRule::KeepWorld)
             RelativeTransform = OldWorld;
     }
+    MarkTransformDirty();
 
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
@@ -356,9 +498,11 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
         Siblings.erase(std::remove(Siblings.begin(), Siblings.end(), this), Siblings.end());
         AttachParent = nullptr;
     }
+    UpdateSocketInParentChain();
 
     if (bKeepWorld)
         RelativeTransform = OldWorld;
+    MarkTransformDirty();
 
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
@@ -375,6 +519,10 @@ void USceneComponent::DuplicateSubObjects()
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
     AttachChildren.clear(); // Actor에서 할당해줌
+    bHasSocketInParentChain = false; // 부모가 다시 붙을 때 갱신
+    PendingTransformUpdate = nullptr; // 원본의 대기열 등록은 복사본과 무관
+    bIsTransformDirty = true; // 원본의 월드 캐시를 복사해 왔으므로 무효화
+    bIsWorldMatrixDirty = true;
 }
 
 // ──────────────────────────────
@@ -383,6 +531,7 @@ void USceneComponent::DuplicateSubObjects()
 void USceneComponent::UpdateRelativeTransform()
 {
     RelativeTransform = FTransform(RelativeLocation, RelativeRotation, RelativeScale);
+    MarkTransformDirty();
 }
 
 void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -435,7 +584,7 @@ void USceneComponent::OnRegister(UWorld* InWorld)
 
 void USceneComponent::OnTransformUpdated()
 {
-    bIsTransformDirty = true;
+    MarkTransformDirty();
     for (USceneComponent* Child : GetAttachChildren())
     {
         Child->OnTransformUpdated();
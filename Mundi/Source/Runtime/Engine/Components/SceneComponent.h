@@ -14,6 +14,7 @@ enum class EAttachmentRule
 };
 
 class URenderer;
+class FWorldTransformUpdate;
 UCLASS(DisplayName="씬 컴포넌트", Description="트랜스폼을 가진 기본 컴포넌트입니다")
 class USceneComponent : public UActorComponent
 {
@@ -68,6 +69,13 @@ public:
     FTransform GetWorldTransform() const;
     void SetWorldTransform(const FTransform& W);
 
+    // 소켓(본)에 붙은 경우 부모 포즈가 알림 없이 바뀌므로 캐시를 믿을 수 없음
+    // (true면 GetWorldTransform()이 매번 캐시를 다시 쓰므로 워커 스레드에서 조회 금지)
+    bool IsTransformCacheBypassed() const
+    {
+        return bHasSocketInParentChain || (AttachParent && AttachParent->IsPendingDestroy());
+    }
+
     void SetWorldLocation(const FVector& L);
     UFUNCTION(LuaBind, DisplayName="GetWorldLocation")
     FVector GetWorldLocation() const;
@@ -88,6 +96,13 @@ public:
     void SetLocalLocationAndRotation(const FVector& L, const FQuat& R);
 
     FMatrix GetWorldMatrix() const; // ToMatrixWithScale
+
+    /**
+     * 월드 트랜스폼 캐시 무효화 (자신 + 모든 자손)
+     * 이미 더티면 자손도 더티이므로 바로 반환 (부모가 깨끗해야 자식이 계산될 수 있음)
+     * 부모가 깨끗한 최상위 더티 컴포넌트만 월드의 일괄 갱신 대기열에 등록
+     */
+    void MarkTransformDirty();
       
     // ──────────────────────────────
     // Attach/Detach
@@ -113,6 +128,8 @@ public:
     void SetParent(USceneComponent* InParent)
     {
         AttachParent = InParent;
+        UpdateSocketInParentChain();
+        MarkTransformDirty();
     }
 
     // Serialize
@@ -168,13 +185,27 @@ protected:
     // UI 편집용 Euler Angle (Degrees)
     // RelativeRotation과 항상 동기화됨
 
+    // 월드 트랜스폼 캐시 (부모 체인 합성 결과, 조회 시 지연 계산)
+    // NOTE: const 조회에서 갱신되므로 게임 스레드에서만 조회할 것
+    mutable FTransform CachedComponentToWorld;
     mutable FMatrix CachedWorldMatrix = FMatrix::Identity();
     mutable bool bIsTransformDirty = true;
+    mutable bool bIsWorldMatrixDirty = true;
+
+    FTransform ComputeWorldTransform() const;
     
     // Hierarchy
     USceneComponent* AttachParent = nullptr;
     FName AttachSocketName = FName();
 
+    // 자신 또는 조상이 소켓에 붙어 있는지 (부착/분리 시 갱신해 자손에게 전파, 조회마다 체인을 걷지 않기 위함)
+    bool bHasSocketInParentChain = false;
+    void UpdateSocketInParentChain();
+
+    // 등록된 일괄 갱신 대기열 (없으면 nullptr, 파괴 시 대기열에서 제거)
+    friend class FWorldTransformUpdate;
+    FWorldTransformUpdate* PendingTransformUpdate = nullptr;
+
     // 로컬(부모 기준) 트랜스폼
     FTransform RelativeTransform;
 
@@ -184,3 +215,32 @@ protected:
     uint32 ParentId;
     static TMap<uint32, USceneComponent*> SceneIdMap; // 부모를 찾기 위한 Map
 };
+
+/**
+ * FWorldTransformUpdate
+ * 월드 단위 트랜스폼 일괄 갱신 단계입니다. (UWorld 소유, 게임 스레드 전용)
+ *
+ * MarkTransformDirty가 새로 더티해진 최상위 컴포넌트만 등록하고, Tick 끝에서 Execute()가
+ * 그 서브트리만 계층 순서(부모 먼저)로 평탄화해 부모 결과를 배열 인덱스로 바로 참조하며 갱신합니다.
+ * 소켓에 붙은 서브트리는 조회 시마다 다시 계산되므로 건너뜁니다.
+ */
+class FWorldTransformUpdate
+{
+public:
+    void Enqueue(USceneComponent* Root);
+
+    // 컴포넌트 파괴 시 호출
+    void Remove(USceneComponent* Root);
+
+    void Execute();
+
+    bool IsEmpty() const { return DirtyRoots.IsEmpty(); }
+
+private:
+    TArray<USceneComponent*> DirtyRoots;
+
+    // 프레임마다 재사용
+    TArray<USceneComponent*> Components;
+    TArray<int32> ParentIndices;
+    TArray<FTransform> WorldTransforms;
+};
@@ -103,125 +103,27 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
         bGenerateOverlapEvents = false;
     }
 
-    if (!bGenerateOverlapEvents)
-    {
-        OverlapInfos.clear();
-    }
-
     UWorld* World = GetWorld();
     if (!World) return;
 
-    // 매 프레임 Bounds 업데이트 및 BVH dirty 마킹 (에디터에서 속성 직접 수정 시 반영)
+    // 매 프레임 Bounds 업데이트 (에디터에서 속성 직접 수정 시 반영)
+    // 트랜스폼/Setter 변경은 이미 dirty 마킹되므로 여기서는 Bounds가 실제로 바뀐 경우만 마킹
+    const FAABB OldBounds = GetWorldAABB();
     UpdateBounds();
-    if (UCollisionManager* Manager = World->GetCollisionManager())
-    {
-        Manager->MarkComponentDirty(this);
-    }
-    if (UWorldPartitionManager* Partition = World->GetPartitionManager())
-    {
-        Partition->MarkDirty(this);
-    }
-
-    //Test용 O(N^2) 
-    OverlapNow.clear();
-
-    for (AActor* Actor : World->GetActors())
-    {
-        if (!Actor || !Actor->IsActorActive())
-            continue;
-
-        for (USceneComponent* Comp : Actor->GetSceneComponents())
-        {
-            UShapeComponent* Other = Cast<UShapeComponent>(Comp);
-            if (!Other || Other == this) continue;
-            if (Other->GetOwner() == this->GetOwner()) continue;
-            if (!Other->bGenerateOverlapEvents) continue;
-
-            AActor* Owner = this->GetOwner();
-            AActor* OtherOwner = Other->GetOwner();
-
-            // Collision 모듈
-            if (!Collision::CheckOverlap(this, Other)) continue;
-
-            OverlapNow.Add(Other);
-            //UE_LOG("Collision!!");
-        }
-    }
-
-    // Publish current overlaps
-    OverlapInfos.clear();
-    for (UShapeComponent* Other : OverlapNow)
+    const FAABB NewBounds = GetWorldAABB();
+    if (!(OldBounds.Min == NewBounds.Min) || !(OldBounds.Max == NewBounds.Max))
     {
-        FOverlapInfo Info;
-        Info.OtherActor = Other->GetOwner();
-        Info.Other = Other;
-        OverlapInfos.Add(Info);
-    }
-
-    //Begin
-    for (UShapeComponent* Comp : OverlapNow)
-    {
-        if (!Comp || Comp->IsPendingDestroy())
-        {
-            continue;
-        }
-
-        if (!OverlapPrev.Contains(Comp))
-        {
-            AActor* Owner = this->GetOwner();
-            AActor* OtherOwner = Comp ? Comp->GetOwner() : nullptr;
-
-            // 이전에 호출된 적이 있는 이벤트 인지 확인
-            if (!(Owner && OtherOwner && World->TryMarkOverlapPair(Owner, OtherOwner)))
-            {
-                continue;
-            }
-
-            // 양방향 호출 
-            Owner->OnComponentBeginOverlap.Broadcast(this, Comp);
-            if (AActor* OtherOwner = Comp->GetOwner())
-            {
-                OtherOwner->OnComponentBeginOverlap.Broadcast(Comp, this);
-            }
-        }
-    }
-
-    //End
-    for (UShapeComponent* Comp : OverlapPrev)
-    {
-        if (!Comp || Comp->IsPendingDestroy())
+        if (UCollisionManager* Manager = World->GetCollisionManager())
         {
-            continue;
+            Manager->MarkComponentDirty(this);
         }
-
-        if (!OverlapNow.Contains(Comp))
+        if (UWorldPartitionManager* Partition = World->GetPartitionManager())
         {
-            AActor* Owner = this->GetOwner();
-            AActor* OtherOwner = Comp ? Comp->GetOwner() : nullptr;
-
-            // 이전에 호출된 적이 있는 이벤트 인지 확인
-            if (!(Owner && OtherOwner && World->TryMarkOverlapPair(Owner, OtherOwner)))
-            {
-                continue;
-            }
-
-            // 양방향 호출
-            Owner->OnComponentEndOverlap.Broadcast(this, Comp);
-            if (AActor* OtherOwner = Comp->GetOwner())
-            {
-                OtherOwner->OnComponentEndOverlap.Broadcast(Comp, this);
-            }
+            Partition->MarkDirty(this);
         }
     }
 
-    OverlapPrev.clear();
-    for (UShapeComponent* Comp : OverlapNow)
-    {
-            if (Comp && !Comp->IsPendingDestroy())
-            {
-                OverlapPrev.Add(Comp);
-            }
-    }
+    // 겹침 판정과 Begin/End 이벤트는 액터 틱 이후 월드 Overlap 단계에서 처리 (UCollisionManager::UpdateOverlaps)
 }
 
 FAABB UShapeComponent::GetWorldAABB() const
@@ -33,6 +33,9 @@ public:
 
 	GENERATED_REFLECTION_BODY();
 
+	// 월드 Overlap 단계가 OverlapInfos를 채운다
+	friend class UCollisionManager;
+
 public:
 
     // ===== Lua-Bindable Properties (Auto-moved from protected/private) =====
@@ -69,8 +72,6 @@ public:
  
 protected:
 	mutable FAABB WorldAABB; //브로드 페이즈 용
-	TSet<UShapeComponent*> OverlapNow; // 이번 프레임에서 overlap 된 Shap Comps
-	TSet<UShapeComponent*> OverlapPrev; // 지난 프레임에서 overlap 됐으면 Cache
 
 	bool bIsOverlapping = false;  // 충돌 상태 플래그 (Week09 호환)
 	 
@@ -79,7 +80,7 @@ protected:
 	bool bDrawOnlyIfSelected;
 
 
-	TArray<FOverlapInfo> OverlapInfos; 
+	TArray<FOverlapInfo> OverlapInfos; // 이번 프레임 겹침 (UCollisionManager::UpdateOverlaps가 갱신)
 	//TODO: float LineThickness;
 
 };
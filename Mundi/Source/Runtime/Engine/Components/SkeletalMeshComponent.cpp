@@ -7,6 +7,7 @@
 #include "AnimSingleNodeInstance.h"
 #include "AnimStateMachineInstance.h"
 #include "AnimBlendSpaceInstance.h"
+#include "AnimationUpdate.h"
 
 // AnimNotify Sound 자동 재생
 #include "FAudioDevice.h"
@@ -53,6 +54,14 @@ void USkeletalMeshComponent::DuplicateSubObjects()
     Super::DuplicateSubObjects();
 
     AnimInstance = nullptr;
+
+    // 애니메이션 대기 목록은 원본 월드 것이므로 복사본은 대기 중 아님
+    PendingAnimationIndex = -1;
+    UpdateRateState = FAnimUpdateRateState();
+    PrevEvaluatedPose.Empty();
+    RequiredBones.Empty();
+    RequiredBonesLODLevel = 0;
+
     // 래그돌 관련 데이터 초기화 (원본과 공유 방지)
     // 얕은 복사된 Bodies/Constraints 포인터들은 원본의 PhysX 객체를 가리키므로
     // 복제된 컴포넌트는 자신만의 Bodies를 새로 생성해야 함
@@ -104,6 +113,20 @@ void USkeletalMeshComponent::BeginPlay()
     bPrevSimulatePhysics = bSimulatePhysics;
 }
 
+void USkeletalMeshComponent::OnUnregister()
+{
+    // 이번 프레임 애니메이션 대기 목록에서 제외
+    if (UWorld* World = GetWorld())
+    {
+        if (FAnimationUpdate* AnimationUpdate = World->GetAnimationUpdate())
+        {
+            AnimationUpdate->Remove(this);
+        }
+    }
+
+    Super::OnUnregister();
+}
+
 void USkeletalMeshComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -115,13 +138,25 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
         bPrevSimulatePhysics = bSimulatePhysics;
     }
 
-    UpdateAnimation(DeltaTime);
+    // 월드 틱 중이면 애니메이션 단계에 등록 (액터 틱이 끝난 뒤 모든 메시를 한꺼번에 처리)
+    UWorld* World = GetWorld();
+    FAnimationUpdate* AnimationUpdate = World ? World->GetAnimationUpdate() : nullptr;
+    if (!AnimationUpdate || !AnimationUpdate->Enqueue(this, DeltaTime))
+    {
+        UpdateAnimation(DeltaTime);
+    }
 }
 
 void USkeletalMeshComponent::PrePhysicsUpdate(float DeltaTime)
 {
     Super::PrePhysicsUpdate(DeltaTime);
-    UpdateAnimation(DeltaTime);
+
+    // 월드 애니메이션 단계가 지난 틱 끝에서 키네마틱 바디를 이미 본 위치로 옮겨 두었다
+    UWorld* World = GetWorld();
+    if (!World || !World->GetAnimationUpdate())
+    {
+        UpdateAnimation(DeltaTime);
+    }
 }
 
 void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
@@ -165,6 +200,25 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
         RefPose = CurrentLocalSpacePose;
         ForceRecomputePose();
 
+        // 본 LOD용 높이 (부모가 자식보다 앞에 오므로 뒤에서부터 부모로 올려 보냄)
+        BoneHeights.SetNum(NumBones);
+        std::fill(BoneHeights.begin(), BoneHeights.end(), static_cast<uint8>(0));
+        for (int32 i = NumBones - 1; i >= 0; --i)
+        {
+            const int32 ParentIndex = Skeleton.Bones[i].ParentIndex;
+            if (ParentIndex >= 0 && BoneHeights[i] < 255)
+            {
+                BoneHeights[ParentIndex] = std::max(BoneHeights[ParentIndex], static_cast<uint8>(BoneHeights[i] + 1));
+            }
+        }
+
+        // 이전 메시 기준 포즈/마스크는 버림 (다음 평가에서 새로 채움)
+        PrevEvaluatedPose.Empty();
+        BaseAnimationPose.Empty();
+        RequiredBones.Empty();
+        RequiredBonesLODLevel = 0;
+        UpdateRateState.bHasEvaluatedPose = false;
+
         // Rebind anim instance to new skeleton
         if (AnimInstance)
         {
@@ -177,6 +231,9 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
         CurrentLocalSpacePose.Empty();
         CurrentComponentSpacePose.Empty();
         TempFinalSkinningMatrices.Empty();
+        BoneHeights.Empty();
+        RequiredBones.Empty();
+        RequiredBonesLODLevel = 0;
     }
 }
 
@@ -317,28 +374,77 @@ bool USkeletalMeshComponent::IsPlayingAnimation() const
 }
 
 void USkeletalMeshComponent::UpdateAnimation(float DeltaTime)
+{
+    // 월드 애니메이션 단계 밖에서는 업데이트 빈도 최적화 없이 매번 전체 평가
+    UpdateRateState.UpdateRate = 1;
+    UpdateRateState.BoneLODLevel = 0;
+
+    if (UpdateAnimationState(DeltaTime))
+    {
+        EvaluateAnimationPose(DeltaTime);
+        FinishAnimationUpdate();
+    }
+}
+
+bool USkeletalMeshComponent::UpdateAnimationState(float DeltaTime)
 {
     // PrePhysicsUpdate에서 이미 계산했는데 다시 계산하는 경우 예방
     uint64 CurrentFrameCounter = GEngine.GetFrameCounter();
     if (LastFrameCount == CurrentFrameCounter || bIsRagdoll)
     {
-        return;
+        return false;
     }
     LastFrameCount = CurrentFrameCounter;
 
-    if (!SkeletalMesh) { return; }
     // Drive animation instance if present
-    if (bUseAnimation && AnimInstance && SkeletalMesh && SkeletalMesh->GetSkeleton())
+    if (!bUseAnimation || !AnimInstance || !SkeletalMesh || !SkeletalMesh->GetSkeleton())
     {
-        AnimInstance->NativeUpdateAnimation(DeltaTime);
+        return false;
+    }
+
+    AnimInstance->NativeUpdateAnimation(DeltaTime);
+    return true;
+}
+
+void USkeletalMeshComponent::EvaluateAnimationPose(float DeltaTime)
+{
+    // Update 단계의 노티파이 콜백이 메시나 애님 인스턴스를 바꿨을 수 있으므로 다시 확인
+    if (!AnimInstance || !SkeletalMesh || !SkeletalMesh->GetSkeleton())
+    {
+        return;
+    }
+
+    const uint64 EvaluateStart = FWindowsPlatformTime::Cycles64();
+    FAnimUpdateRateState& State = UpdateRateState;
+
+    UpdateRequiredBones(State.BoneLODLevel);
 
-        FPoseContext OutputPose;
-        OutputPose.Initialize(this, SkeletalMesh->GetSkeleton(), DeltaTime);
-        AnimInstance->EvaluateAnimation(OutputPose);
+    FPoseContext OutputPose;
+    OutputPose.Initialize(this, SkeletalMesh->GetSkeleton(), DeltaTime);
+    OutputPose.RequiredBones = RequiredBones.IsEmpty() ? nullptr : &RequiredBones;
+    AnimInstance->EvaluateAnimation(OutputPose);
+    ResetMaskedBonesToRefPose(OutputPose.LocalSpacePose);
 
-        // Apply local-space pose to component and rebuild skinning
-        // 애니메이션 포즈를 BaseAnimationPose에 저장 (additive 적용 전 리셋용)
-        BaseAnimationPose = OutputPose.LocalSpacePose;
+    // 다음 평가까지 여러 프레임이 남으면 지금 보이는 포즈에서 새 포즈로 보간
+    const bool bInterpolate = State.UpdateRate > 1 && State.bHasEvaluatedPose
+        && CurrentLocalSpacePose.Num() == OutputPose.LocalSpacePose.Num();
+    if (bInterpolate)
+    {
+        PrevEvaluatedPose = CurrentLocalSpacePose;
+    }
+    State.EvaluateInterval = bInterpolate ? State.UpdateRate : 1;
+    State.FramesSinceEvaluate = 0;
+    State.bHasEvaluatedPose = true;
+
+    // Apply local-space pose to component and rebuild skinning
+    // 애니메이션 포즈를 BaseAnimationPose에 저장 (additive 적용 전 리셋용, 보간의 끝 포즈)
+    BaseAnimationPose = OutputPose.LocalSpacePose;
+    if (bInterpolate)
+    {
+        ApplyInterpolatedPose(1.0f / State.EvaluateInterval);
+    }
+    else
+    {
         CurrentLocalSpacePose = OutputPose.LocalSpacePose;
         if (bSimulatePhysics)
         {
@@ -346,15 +452,107 @@ void USkeletalMeshComponent::UpdateAnimation(float DeltaTime)
         }
         else
         {
+            bSkinMaskedBonesFromParent = !RequiredBones.IsEmpty();
             ForceRecomputePose();
+            bSkinMaskedBonesFromParent = false;
+        }
+    }
+
+    State.LastEvaluateTimeMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - EvaluateStart);
+}
+
+void USkeletalMeshComponent::InterpolateAnimationPose()
+{
+    FAnimUpdateRateState& State = UpdateRateState;
+    ++State.FramesSinceEvaluate;
 
-            // [추가됨] 애니메이션 포즈가 바뀌었으니, 
-            // 래그돌이 꺼져있을 때(Kinematic 상태) Body들을 본 위치로 옮겨야 함
-            UpdateBodiesFromBones(); 
+    // 보간 없이 평가했거나 이미 끝 포즈에 도달했으면 할 일 없음
+    if (State.EvaluateInterval <= 1 || State.FramesSinceEvaluate >= State.EvaluateInterval
+        || PrevEvaluatedPose.Num() != BaseAnimationPose.Num())
+    {
+        return;
+    }
+
+    ApplyInterpolatedPose(static_cast<float>(State.FramesSinceEvaluate + 1) / State.EvaluateInterval);
+}
+
+void USkeletalMeshComponent::ApplyInterpolatedPose(float Alpha)
+{
+    const int32 NumBones = BaseAnimationPose.Num();
+    const float ClampedAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
+
+    CurrentLocalSpacePose.SetNum(NumBones);
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        CurrentLocalSpacePose[BoneIndex] = FTransform::Lerp(PrevEvaluatedPose[BoneIndex], BaseAnimationPose[BoneIndex], ClampedAlpha);
+    }
+    ResetMaskedBonesToRefPose(CurrentLocalSpacePose);
+
+    if (!bSimulatePhysics)
+    {
+        bSkinMaskedBonesFromParent = !RequiredBones.IsEmpty();
+        ForceRecomputePose();
+        bSkinMaskedBonesFromParent = false;
+    }
+}
+
+void USkeletalMeshComponent::UpdateRequiredBones(int32 BoneLODLevel)
+{
+    const int32 NumBones = BoneHeights.Num();
+    if (BoneLODLevel == RequiredBonesLODLevel && (BoneLODLevel <= 0 || RequiredBones.Num() == NumBones))
+    {
+        return;
+    }
+
+    RequiredBonesLODLevel = BoneLODLevel;
+    UpdateRateState.NumSkippedBones = 0;
+
+    if (BoneLODLevel <= 0 || NumBones == 0)
+    {
+        RequiredBones.Empty();
+        return;
+    }
+
+    // 말단에서 BoneLODLevel 단계 안쪽 본은 뺀다 (루트는 항상 평가)
+    const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
+    RequiredBones.SetNum(NumBones);
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        const bool bRequired = Skeleton.Bones[BoneIndex].ParentIndex == -1 || BoneHeights[BoneIndex] >= BoneLODLevel;
+        RequiredBones[BoneIndex] = bRequired ? 1 : 0;
+        if (!bRequired)
+        {
+            ++UpdateRateState.NumSkippedBones;
+        }
+    }
+}
+
+void USkeletalMeshComponent::ResetMaskedBonesToRefPose(TArray<FTransform>& InOutLocalPose) const
+{
+    if (RequiredBones.Num() != InOutLocalPose.Num() || RefPose.Num() != InOutLocalPose.Num())
+    {
+        return;
+    }
+
+    for (int32 BoneIndex = 0; BoneIndex < RequiredBones.Num(); ++BoneIndex)
+    {
+        if (!RequiredBones[BoneIndex])
+        {
+            InOutLocalPose[BoneIndex] = RefPose[BoneIndex];
         }
     }
 }
 
+void USkeletalMeshComponent::FinishAnimationUpdate()
+{
+    if (!bSimulatePhysics)
+    {
+        // [추가됨] 애니메이션 포즈가 바뀌었으니, 
+        // 래그돌이 꺼져있을 때(Kinematic 상태) Body들을 본 위치로 옮겨야 함
+        UpdateBodiesFromBones(); 
+    }
+}
+
 void USkeletalMeshComponent::SetRagdollState(bool InState)
 {
     // bSimulatePhysics는 별도로 관리 - 여기서 강제로 true로 설정하지 않음
@@ -477,8 +675,18 @@ void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
     // 본 행렬 계산 시간 측정 시작
     uint64 BoneMatrixCalcStart = FWindowsPlatformTime::Cycles64();
 
+    const bool bUseMaskedBones = bSkinMaskedBonesFromParent && RequiredBones.Num() == NumBones;
+
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
+        // 바인드 로컬 포즈인 본: InvBind * (RefLocal * ParentCS) = InvBind * Bind * ParentInvBind * ParentCS = 부모 스키닝 행렬
+        const int32 ParentIndex = Skeleton.Bones[BoneIndex].ParentIndex;
+        if (bUseMaskedBones && !RequiredBones[BoneIndex] && ParentIndex >= 0)
+        {
+            TempFinalSkinningMatrices[BoneIndex] = TempFinalSkinningMatrices[ParentIndex];
+            continue;
+        }
+
         const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
         const FMatrix ComponentPoseMatrix = CurrentComponentSpacePose[BoneIndex].ToMatrix();
 
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "SkinnedMeshComponent.h"
 #include "PrePhysics.h"
+#include "AnimationUpdate.h"
 #include <functional>
 #include "USkeletalMeshComponent.generated.h"
 
@@ -27,6 +28,8 @@ public:
 
     void BeginPlay() override;
 
+    void OnUnregister() override;
+
     void TickComponent(float DeltaTime) override;
 
     void PrePhysicsUpdate(float DeltaTime) override;
@@ -47,6 +50,7 @@ public:
     float GetAnimationPosition();
     bool IsPlayingAnimation() const;
 
+    // Update → Evaluate → Write back을 즉시 수행 (월드 애니메이션 단계 밖에서 호출될 때)
     void UpdateAnimation(float DeltaTime);
 
     void SetRagdollState(bool InState);
@@ -69,6 +73,10 @@ public:
     
     UPROPERTY()
     bool bIsCar = false;
+
+    // 거리/화면 크기에 따라 포즈 평가 간격과 본 LOD를 낮춤 (플레이어 캐릭터처럼 항상 정밀해야 하면 끔)
+    UPROPERTY(EditAnywhere, Category = "Animation", DisplayName = "업데이트 빈도 최적화")
+    bool bEnableUpdateRateOptimizations = true;
 // Editor Section
 public:
     /**
@@ -122,6 +130,57 @@ public:
 private:
     FAnimNotifyCallback AnimNotifyCallback;
 
+    // 월드 애니메이션 단계 (FAnimationUpdate)
+    friend class FAnimationUpdate;
+
+    // 이번 프레임 대기 목록에서의 위치 (-1이면 대기 중 아님)
+    int32 PendingAnimationIndex = -1;
+
+    // 업데이트 빈도 최적화 상태 (FAnimationUpdate가 Evaluate 전에 결정)
+    FAnimUpdateRateState UpdateRateState;
+
+    // 보간 시작 포즈 (평가 직전에 보이던 로컬 포즈, 끝 포즈는 BaseAnimationPose)
+    TArray<FTransform> PrevEvaluatedPose;
+
+    // 본 LOD: 말단 본으로부터의 높이 (말단 = 0), 현재 LOD 단계의 평가 대상 마스크 (비어 있으면 모든 본)
+    TArray<uint8> BoneHeights;
+    TArray<uint8> RequiredBones;
+    int32 RequiredBonesLODLevel = 0;
+
+    // 본 LOD로 뺀 본이 바인드 로컬 포즈임이 보장될 때만 true (스키닝 행렬을 부모 것으로 대신함)
+    bool bSkinMaskedBonesFromParent = false;
+
+    /**
+     * @brief Update 단계 (게임 스레드): 애님 인스턴스 시간 전진, 노티파이 발생
+     * @return 이번 프레임에 포즈를 계산해야 하면 true
+     */
+    bool UpdateAnimationState(float DeltaTime);
+
+    /**
+     * @brief Evaluate 단계 (워커 스레드 가능): 포즈 추출 → 컴포넌트 공간 → 스키닝 행렬
+     * 이 컴포넌트의 포즈 버퍼만 쓰므로 다른 컴포넌트와 동시에 호출해도 안전
+     */
+    void EvaluateAnimationPose(float DeltaTime);
+
+    /**
+     * @brief Evaluate 단계 대신 (워커 스레드 가능): 평가 차례가 아닌 프레임에 마지막 두 평가 포즈 사이를 보간
+     */
+    void InterpolateAnimationPose();
+
+    /**
+     * @brief Write back 단계 (게임 스레드): 키네마틱 바디를 본 위치로 이동
+     */
+    void FinishAnimationUpdate();
+
+    // PrevEvaluatedPose → BaseAnimationPose 보간 결과를 CurrentLocalSpacePose에 쓰고 스키닝 행렬까지 재계산
+    void ApplyInterpolatedPose(float Alpha);
+
+    // 본 LOD 단계가 바뀌었으면 RequiredBones 재생성
+    void UpdateRequiredBones(int32 BoneLODLevel);
+
+    // 본 LOD로 뺀 본을 바인드 로컬 포즈로 되돌림
+    void ResetMaskedBonesToRefPose(TArray<FTransform>& InOutLocalPose) const;
+
 protected:
     /**
      * @brief CurrentLocalSpacePose의 변경사항을 ComponentSpace -> FinalMatrices 계산까지 모두 수행
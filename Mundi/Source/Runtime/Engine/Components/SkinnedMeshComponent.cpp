@@ -4,6 +4,7 @@
 #include "SceneView.h"
 #include "SkinningStats.h"
 #include "PlatformTime.h"
+#include "CPUSkinning.h"
 
 USkinnedMeshComponent::USkinnedMeshComponent() : SkeletalMesh(nullptr)
 {
@@ -96,10 +97,12 @@ void USkinnedMeshComponent::DuplicateSubObjects()
    bSkinningMatricesDirty = true;
 }
 
-void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkinnedMeshComponent::CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
 {
     if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
+   RecordRenderSignificance(View);
+
    // 전역 스키닝 모드 체크 (언리얼 엔진 방식)
    ESkinningMode GlobalMode = View->RenderSettings->GetGlobalSkinningMode();
    const bool bUseGPU = (GlobalMode == ESkinningMode::ForceGPU);
@@ -313,6 +316,49 @@ FAABB USkinnedMeshComponent::GetWorldAABB() const
    // return FAABB(WorldMin, WorldMax);
 }
 
+void USkinnedMeshComponent::GetRenderSignificance(float& OutScreenSize, float& OutViewDistance) const
+{
+   // 틱은 렌더링보다 먼저 돌므로 지난 프레임(또는 같은 프레임 이전 뷰)에 그려졌으면 화면 안으로 본다
+   const uint64 CurrentFrame = GEngine.GetFrameCounter();
+   if (LastRenderFrame == 0 || LastRenderFrame + 1 < CurrentFrame)
+   {
+      OutScreenSize = 0.0f;
+      OutViewDistance = LastRenderViewDistance;
+      return;
+   }
+
+   OutScreenSize = LastRenderScreenSize;
+   OutViewDistance = LastRenderViewDistance;
+}
+
+void USkinnedMeshComponent::RecordRenderSignificance(const FSceneView* View)
+{
+   // GetWorldAABB는 아직 스켈레탈 바운드를 계산하지 않으므로 메시의 바인드 포즈 바운드 구를 월드로 옮겨 쓴다
+   const FTransform WorldTransform = GetWorldTransform();
+   const FVector Center = WorldTransform.TransformPosition(SkeletalMesh->GetLocalBoundsCenter());
+   const FVector& Scale = WorldTransform.Scale3D;
+   const float MaxScale = std::max(std::fabs(Scale.X), std::max(std::fabs(Scale.Y), std::fabs(Scale.Z)));
+   const float Radius = SkeletalMesh->GetLocalBoundsRadius() * MaxScale;
+
+   // 반지름 / 거리 ≈ 화면에서 차지하는 크기
+   const float Distance = std::max((Center - View->ViewLocation).Size(), KINDA_SMALL_NUMBER);
+   const float ScreenSize = Radius / Distance;
+
+   // 같은 프레임에 여러 뷰/패스에서 그려지면 가장 크게 보인 값을 쓴다
+   const uint64 CurrentFrame = GEngine.GetFrameCounter();
+   if (LastRenderFrame != CurrentFrame)
+   {
+      LastRenderFrame = CurrentFrame;
+      LastRenderScreenSize = ScreenSize;
+      LastRenderViewDistance = Distance;
+   }
+   else
+   {
+      LastRenderScreenSize = std::max(LastRenderScreenSize, ScreenSize);
+      LastRenderViewDistance = std::min(LastRenderViewDistance, Distance);
+   }
+}
+
 void USkinnedMeshComponent::OnTransformUpdated()
 {
    Super::OnTransformUpdated();
@@ -423,35 +469,34 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
          SkeletalMesh->CreateVertexBuffer(&VertexBuffer);
       }
 
-      SkinnedVertices.SetNum(NumVertices);
+      const FCPUSkinningStreams& Streams = SkeletalMesh->GetCPUSkinningStreams();
 
-      // CPU 버텍스 스키닝 계산 시간 측정
-      uint64 VertexSkinningStart = FWindowsPlatformTime::Cycles64();
+      // 매핑된 버텍스 버퍼에 워커들이 바로 쓴다 (중간 배열 + memcpy 없음)
+      // 버퍼가 없거나 매핑에 실패하면 결과를 둘 곳이 없으므로 스키닝을 건너뛰고 다음 프레임에 다시 시도한다 (Dirty 유지)
+      ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
+      D3D11_MAPPED_SUBRESOURCE MappedResource = {};
 
-      for (int32 Idx = 0; Idx < NumVertices; ++Idx)
+      // 버텍스 버퍼 업로드 시간 측정 (Map + Unmap)
+      uint64 BufferMapStart = FWindowsPlatformTime::Cycles64();
+      if (!VertexBuffer || FAILED(Context->Map(VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource)))
       {
-         const FSkinnedVertex& SrcVert = SrcVertices[Idx];
-         FNormalVertex& DstVert = SkinnedVertices[Idx];
-
-         DstVert.pos = SkinVertexPosition(SrcVert);
-         DstVert.normal = SkinVertexNormal(SrcVert);
-         DstVert.Tangent = SkinVertexTangent(SrcVert);
-         DstVert.tex = SrcVert.UV;
+         return;
       }
+      FNormalVertex* DstVertices = static_cast<FNormalVertex*>(MappedResource.pData);
+      uint64 BufferMapEnd = FWindowsPlatformTime::Cycles64();
 
-      uint64 VertexSkinningEnd = FWindowsPlatformTime::Cycles64();
-      double VertexSkinningTimeMS = FWindowsPlatformTime::ToMilliseconds(VertexSkinningEnd - VertexSkinningStart);
+      // CPU 버텍스 스키닝 계산 시간 측정
+      uint64 VertexSkinningStart = FWindowsPlatformTime::Cycles64();
 
-      // 버텍스 버퍼 업로드 시간 측정
-      uint64 BufferUploadStart = FWindowsPlatformTime::Cycles64();
+      CPUSkinning::SkinVerticesParallel(Streams, FinalSkinningMatrices.GetData(), NumBones, DstVertices);
 
-      if (VertexBuffer)
-      {
-         SkeletalMesh->UpdateVertexBuffer(SkinnedVertices, VertexBuffer);
-      }
+      uint64 VertexSkinningEnd = FWindowsPlatformTime::Cycles64();
+      double VertexSkinningTimeMS = FWindowsPlatformTime::ToMilliseconds(VertexSkinningEnd - VertexSkinningStart);
 
-      uint64 BufferUploadEnd = FWindowsPlatformTime::Cycles64();
-      double BufferUploadTimeMS = FWindowsPlatformTime::ToMilliseconds(BufferUploadEnd - BufferUploadStart);
+      uint64 BufferUnmapStart = FWindowsPlatformTime::Cycles64();
+      Context->Unmap(VertexBuffer, 0);
+      uint64 BufferUnmapEnd = FWindowsPlatformTime::Cycles64();
+      double BufferUploadTimeMS = FWindowsPlatformTime::ToMilliseconds((BufferMapEnd - BufferMapStart) + (BufferUnmapEnd - BufferUnmapStart));
 
       // 통계에 추가 (버텍스 버퍼 크기 사용)
       const uint64 VertexBufferSize = sizeof(FNormalVertex) * NumVertices;
@@ -477,72 +522,6 @@ void USkinnedMeshComponent::UpdateSkinningMatrices(const TArray<FMatrix>& InSkin
    bSkinningMatricesDirty = true;
 }
 
-FVector USkinnedMeshComponent::SkinVertexPosition(const FSkinnedVertex& InVertex) const
-{
-   FVector BlendedPosition(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedPosition = SkinMatrix.TransformPosition(InVertex.Position);
-         BlendedPosition += TransformedPosition * Weight;
-      }
-   }
-
-   return BlendedPosition;
-}
-
-FVector USkinnedMeshComponent::SkinVertexNormal(const FSkinnedVertex& InVertex) const
-{
-   FVector BlendedNormal(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         // 노멀도 일반 스키닝 행렬로 변환 (비균등 스케일 무시)
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedNormal = SkinMatrix.TransformVector(InVertex.Normal);
-         BlendedNormal += TransformedNormal * Weight;
-      }
-   }
-
-   return BlendedNormal.GetSafeNormal();
-}
-
-FVector4 USkinnedMeshComponent::SkinVertexTangent(const FSkinnedVertex& InVertex) const
-{
-   const FVector OriginalTangentDir(InVertex.Tangent.X, InVertex.Tangent.Y, InVertex.Tangent.Z);
-   const float OriginalSignW = InVertex.Tangent.W;
-
-   FVector BlendedTangentDir(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         // 탄젠트도 일반 스키닝 행렬로 변환 (비균등 스케일 무시)
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedTangentDir = SkinMatrix.TransformVector(OriginalTangentDir);
-         BlendedTangentDir += TransformedTangentDir * Weight;
-      }
-   }
-
-   const FVector FinalTangentDir = BlendedTangentDir.GetSafeNormal();
-   return { FinalTangentDir.X, FinalTangentDir.Y, FinalTangentDir.Z, OriginalSignW };
-}
-
 void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
 {
    // 실제 본 개수 계산
@@ -25,7 +25,7 @@ public:
 
     UPROPERTY(EditAnywhere, Category = "Skeletal Mesh", Tooltip = "Skeletal mesh asset to render")
     USkeletalMesh* SkeletalMesh;
-    void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+    void CollectMeshBatches(TFrameArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
     
     FAABB GetWorldAABB() const override;
     void OnTransformUpdated() override;
@@ -42,6 +42,13 @@ public:
      */
     USkeletalMesh* GetSkeletalMesh() const { return SkeletalMesh; }
 
+    /**
+     * @brief 지난 프레임에 그려진 크기 (애니메이션 업데이트 빈도 결정용)
+     * @param OutScreenSize 바운드 반지름 / 거리 (여러 뷰 중 최댓값, 지난 프레임에 그려지지 않았으면 0)
+     * @param OutViewDistance 가장 가까운 뷰까지의 거리
+     */
+    void GetRenderSignificance(float& OutScreenSize, float& OutViewDistance) const;
+
 protected:
     /**
      * @brief GPU/CPU 스키닝을 수행 (전역 모드 적용)
@@ -59,18 +66,8 @@ protected:
      * @brief GPU 스키닝을 위해 본 행렬을 GPU 버퍼로 업로드
      */
     void UpdateBoneMatrixBuffer();
-    
-
-    /**
-     * @brief CPU 스키닝 최종 결과물. 렌더러가 이 데이터를 사용합니다.
-     */
-    TArray<FNormalVertex> SkinnedVertices;
 
 private:
-    FVector SkinVertexPosition(const FSkinnedVertex& InVertex) const;
-    FVector SkinVertexNormal(const FSkinnedVertex& InVertex) const;
-    FVector4 SkinVertexTangent(const FSkinnedVertex& InVertex) const;
-
     /**
      * @brief 자식이 계산해 준, 현재 프레임의 최종 스키닝 행렬
     */
@@ -86,6 +83,14 @@ private:
      * @brief 본 행렬 계산 시간 (밀리초) - 자식 컴포넌트에서 전달받음
      */
     double LastBoneMatrixCalcTimeMS = 0.0;
+
+    /**
+     * @brief CollectMeshBatches에서 기록하는 마지막으로 그려진 프레임과 그때의 화면 크기/거리 (그림자 패스 포함)
+     */
+    void RecordRenderSignificance(const FSceneView* View);
+    uint64 LastRenderFrame = 0;
+    float LastRenderScreenSize = 0.0f;
+    float LastRenderViewDistance = 0.0f;
     
     /**
      * @brief CPU 스키닝에서 진행하기 때문에, Component별로 VertexBuffer를 가지고 스키닝 업데이트를 진행해야함
@@ -10,6 +10,7 @@
 #include "SkeletalMeshComponent.h"
 #include "ClothSystem.h"
 #include "SceneRenderer.h"
+#include "JobSystem.h"
 #include <ObjManager.h>
 
 float UEditorEngine::ClientWidth = 1024.0f;
@@ -183,6 +184,15 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
 
+    // 잡 시스템 워커 생성 (editor.ini의 JobWorkerThreads, 없으면 논리 코어 수 - 1)
+    // 엔진 잡, PhysX 태스크, 천 시뮬레이션이 모두 이 워커를 같이 쓰므로 게임 스레드를 뺀 전체 작업 스레드 예산
+    int32 NumJobWorkers = -1;
+    if (EditorINI.count("JobWorkerThreads"))
+    {
+        try { NumJobWorkers = stoi(EditorINI["JobWorkerThreads"]); } catch (...) {}
+    }
+    FJobSystem::GetInstance().Initialize(NumJobWorkers);
+
     if (!CreateMainWindow(hInstance))
         return false;
 
@@ -359,11 +369,17 @@ void UEditorEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 프레임 전환: 2프레임 전 프레임 아레나 회수
+        FFrameMemory::GetInstance().EndFrame();
     }
 }
 
 void UEditorEngine::Shutdown()
 {
+    // 남은 잡을 모두 끝내고 워커 종료 (월드 삭제 전에 처리)
+    FJobSystem::GetInstance().Shutdown();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
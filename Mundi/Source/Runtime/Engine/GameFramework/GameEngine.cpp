@@ -13,6 +13,7 @@
 #include "PhysicsSystem.h"
 #include "SkeletalMeshComponent.h"
 #include "GameHUD.h"
+#include "JobSystem.h"
 
 float UGameEngine::ClientWidth = 1024.0f;
 float UGameEngine::ClientHeight = 1024.0f;
@@ -179,6 +180,15 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
 
+    // 잡 시스템 워커 생성 (editor.ini의 JobWorkerThreads, 없으면 논리 코어 수 - 1)
+    // 엔진 잡, PhysX 태스크, 천 시뮬레이션이 모두 이 워커를 같이 쓰므로 게임 스레드를 뺀 전체 작업 스레드 예산
+    int32 NumJobWorkers = -1;
+    if (EditorINI.count("JobWorkerThreads"))
+    {
+        try { NumJobWorkers = stoi(EditorINI["JobWorkerThreads"]); } catch (...) {}
+    }
+    FJobSystem::GetInstance().Initialize(NumJobWorkers);
+
     if (!CreateMainWindow(hInstance))
         return false;
 
@@ -329,11 +339,17 @@ void UGameEngine::MainLoop()
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+
+        // 프레임 전환: 2프레임 전 프레임 아레나 회수
+        FFrameMemory::GetInstance().EndFrame();
     }
 }
 
 void UGameEngine::Shutdown()
 {
+    // 남은 잡을 모두 끝내고 워커 종료 (월드 삭제 전에 처리)
+    FJobSystem::GetInstance().Shutdown();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
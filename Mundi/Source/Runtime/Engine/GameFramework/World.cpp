@@ -33,6 +33,9 @@
 #include "PlayerCameraManager.h"
 #include "Hash.h"
 #include "ParticleEventManager.h"
+#include "ParticleSimulation.h"
+#include "ParticleSystemPool.h"
+#include "AnimationUpdate.h"
 #include "PhysicsSystem.h"
 #include "PhysicsScene.h"
 #include "RagdollStats.h"
@@ -51,6 +54,10 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
 	LuaManager = std::make_unique<FLuaManager>();
+	ParticleSimulation = std::make_unique<FParticleSimulation>();
+	ParticleSystemPool = std::make_unique<FParticleSystemPool>(this);
+	AnimationUpdate = std::make_unique<FAnimationUpdate>();
+	WorldTransformUpdate = std::make_unique<FWorldTransformUpdate>();
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -67,6 +74,12 @@ UWorld::~UWorld()
 {
 	bIsTearingDown = true;	// 월드 삭제 중에는 새로운 액터 생성을 방지하기 위해
 
+	// 아직 실행되지 않은 배치 씬 쿼리 콜백(Lua 함수, 액터 캡처)은 액터보다 먼저 버린다 (PIE 종료 포함)
+	if (PhysicsScene)
+	{
+		PhysicsScene->GetSceneQueries().Reset();
+	}
+
 	// 래그돌은 이제 USkeletalMeshComponent에서 자동 정리됨
 
 	if (Level)
@@ -217,6 +230,7 @@ void UWorld::Tick(float DeltaSeconds)
 	{
 		// 래그돌 통계 초기화 (시뮬레이션 전에 리셋)
 		FRagdollStatManager::GetInstance().ResetFrameStats();
+		// Async 계열 모드에서는 마지막 스텝을 시작만 하고 돌아옴 → 아래 액터 틱/애니메이션/Lua와 겹쳐서 계산
 		PhysicsScene->Simulate(DeltaSeconds);
 	}
 
@@ -248,15 +262,18 @@ void UWorld::Tick(float DeltaSeconds)
         }
 	} 
 	 
-	// 중복충돌 방지 pair clear
-    FrameOverlapPairs.clear();
-
     // Skip partition update for preview worlds (no spatial partitioning needed)
     if (Partition)
     {
         Partition->Update(DeltaSeconds, /*budget*/256);
     }
 
+	// 액터 틱 동안 스켈레탈 메시 컴포넌트의 애니메이션 등록을 받는다
+	if (AnimationUpdate)
+	{
+		AnimationUpdate->BeginGather();
+	}
+
 	if (Level)
 	{
 		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
@@ -286,6 +303,26 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
+	// 스켈레탈 애니메이션 (노티파이는 등록 순서대로 게임 스레드에서, 포즈/스키닝 행렬은 워커 스레드에서 병렬 계산)
+	// 소켓에 붙은 파티클/컴포넌트가 이번 프레임 포즈를 읽도록 파티클보다 먼저 처리
+	if (AnimationUpdate)
+	{
+		AnimationUpdate->Execute();
+	}
+
+	// 파티클 시뮬레이션 (액터 틱 중 등록된 컴포넌트들의 이미터를 워커 스레드에서 한꺼번에 틱)
+	if (ParticleSimulation)
+	{
+		ParticleSimulation->Execute();
+	}
+
+	// 셰이프 겹침 (이번 프레임 이동이 끝난 뒤 Sweep and Prune으로 쌍을 한 번에 만들고 지난 프레임과 비교해 Begin/End 발생)
+	// 겹침 델리게이트가 게임플레이/Lua로 이어지므로 예전 액터 틱 경로처럼 PIE에서만
+	if (CollisionManager && bPie)
+	{
+		CollisionManager->UpdateOverlaps();
+	}
+
 	// Lua 코루틴 전용 Tick
 	if (LuaManager && bPie)
 	{
@@ -294,11 +331,12 @@ void UWorld::Tick(float DeltaSeconds)
 
 	if (bPie)
 	{
-		// ProcessCommandQueue를 먼저 실행해야 함
-		// (FetchAndUpdate 내부의 PendingDestroyInDeathNote에서 Actor가 삭제되기 전에
-		// CommandQueue의 명령들을 처리해야 삭제된 Actor에 접근하는 크래시 방지)
-		PhysicsScene->ProcessCommandQueue();
-		PhysicsScene->FetchAndUpdate();
+		// 물리 동기화 지점: 틱 초반에 시작한 스텝 결과 반영 → 이번 틱에 쌓인 명령 → 데스노트 정리
+		// (지연 모드는 다음 틱 Simulate에서 처리)
+		PhysicsScene->SyncSimulation();
+
+		// 이번 틱에 모인 배치 씬 쿼리 실행 (워커 병렬) → 결과 콜백 (등록 순서)
+		PhysicsScene->ExecuteSceneQueries();
 	}
 
 	// Cloth 시뮬레이션 업데이트 (PIE와 에디터 모두에서 실행)
@@ -307,14 +345,22 @@ void UWorld::Tick(float DeltaSeconds)
 	// 지연 삭제 처리
 	ProcessPendingKillActors();
 
+	// 이번 프레임에 바뀐 트랜스폼을 한 번에 갱신 (컬링/피킹/렌더에서 부모 체인을 반복 합성하지 않도록)
+	// 더티해진 최상위 컴포넌트의 서브트리만 방문
+	if (WorldTransformUpdate && !WorldTransformUpdate->IsEmpty())
+	{
+		WorldTransformUpdate->Execute();
+	}
+
 	// 래그돌은 이제 BeginPlay에서 자동으로 활성화됨
 	// (bSimulatePhysics && PhysicsAsset 조건)
 	// G키/H키 수동 활성화 코드 제거됨
 
-	// 충돌 BVH 업데이트 (에디터/PIE 모두에서 호출 - Partition과 동일)
-	if (CollisionManager)
+	// 충돌 BVH 업데이트 (트리를 쓰는 곳은 디버그 표시뿐이라 SF_CollisionBVH가 켜져 있을 때만)
+	// 꺼져 있는 동안의 Dirty 마킹은 쌓여 있다가 다시 켜지면 한 번에 반영됨
+	if (CollisionManager && RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_CollisionBVH))
 	{
-		// CollisionManager->UpdateCollisions(GetDeltaTime(EDeltaTime::Game));
+		CollisionManager->UpdateCollisions(GetDeltaTime(EDeltaTime::Game));
 	}
 }
 
@@ -342,6 +388,7 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	PIEWorld->CollisionManager->SetWorld(PIEWorld);
 
 	PIEWorld->PhysicsScene = FPhysicsSystem::GetInstance().CreateScene();
+	PIEWorld->PhysicsScene->ApplySimulationModeFromConfig();
 
 	// PIE 월드에 파티클 이벤트 매니저 생성
 
@@ -796,29 +843,3 @@ AActor* UWorld::SpawnPrefabActor(const FWideString& PrefabPath)
 
 	return NewActor;
 }
-
-bool UWorld::TryMarkOverlapPair(const AActor* Actor, const AActor* B)
-{
-	if (!Actor || !B) return false;
-	// Canonicalize by pointer value to ensure consistent ordering
-	uintptr_t Pa = reinterpret_cast<uintptr_t>(Actor);
-	uintptr_t Pb = reinterpret_cast<uintptr_t>(B);
-
-	if (Pa > Pb)
-	{
-		auto Tmp = Pa;
-		Pa = Pb;
-		Pb = Tmp;
-	}
-	uint64 Key1 = (uint64)Pa;
-	uint64 Key2 = (uint64)Pb;
-
-
-	uint64 Key = HashCombine(Key1, Key2);
-
-	if (FrameOverlapPairs.Contains(Key))
-		return false;
-
-	FrameOverlapPairs.Add(Key);
-	return true;
-}
@@ -31,6 +31,10 @@ class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
 class AParticleEventManager;
 class UCollisionManager;
+class FParticleSimulation;
+class FParticleSystemPool;
+class FAnimationUpdate;
+class FWorldTransformUpdate;
 
 struct FTransform;
 struct FSceneCompData;
@@ -87,6 +91,9 @@ public:
 
     bool bPie = false;
 
+    // Tick 끝에서 더티 월드 트랜스폼을 계층 순서로 일괄 갱신할지 (끄면 조회 시 지연 계산만 사용)
+    bool bBatchUpdateWorldTransforms = true;
+
     // World type management
     void SetWorldType(EWorldType InWorldType) { WorldType = InWorldType; }
     EWorldType GetWorldType() const { return WorldType; }
@@ -155,8 +162,6 @@ public:
 
     /** === 타임 / 틱 === */
     virtual void Tick(float DeltaSeconds);
-    // Overlap pair de-duplication (per-frame)
-    bool TryMarkOverlapPair(const AActor* A, const AActor* B);
 
     TMap<TWeakObjectPtr<AActor>, FActorTimeState> ActorTimingMap;
 
@@ -168,6 +173,10 @@ public:
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
     AParticleEventManager* GetParticleEventManager() { return ParticleEventManager; }
     UCollisionManager* GetCollisionManager() { return CollisionManager.get(); }
+    FParticleSimulation* GetParticleSimulation() { return ParticleSimulation.get(); }
+    FParticleSystemPool* GetParticleSystemPool() { return ParticleSystemPool.get(); }
+    FAnimationUpdate* GetAnimationUpdate() { return AnimationUpdate.get(); }
+    FWorldTransformUpdate* GetWorldTransformUpdate() { return WorldTransformUpdate.get(); }
 
     // PIE용 World 생성
     static UWorld* DuplicateWorldForPIE(UWorld* InEditorWorld);
@@ -194,6 +203,22 @@ private:
     APlayerCameraManager* PlayerCameraManager;
     AParticleEventManager* ParticleEventManager = nullptr;
 
+    /** === 파티클 시뮬레이션 (액터 틱 이후 이미터 병렬 틱) ===*/
+    // 레벨보다 먼저 선언: 레벨 정리 중 컴포넌트 해제(OnUnregister)가 접근하므로 더 늦게 파괴되어야 함
+    std::unique_ptr<FParticleSimulation> ParticleSimulation;
+
+    /** === 일회성 파티클 이펙트 풀 (템플릿별 컴포넌트 재사용) ===*/
+    // 시뮬레이션과 같은 이유로 레벨보다 먼저 선언 (풀 컴포넌트의 OnUnregister가 접근)
+    std::unique_ptr<FParticleSystemPool> ParticleSystemPool;
+
+    /** === 스켈레탈 애니메이션 단계 (액터 틱 이후 포즈 병렬 계산) ===*/
+    // 시뮬레이션과 같은 이유로 레벨보다 먼저 선언 (스켈레탈 메시 컴포넌트의 OnUnregister가 접근)
+    std::unique_ptr<FAnimationUpdate> AnimationUpdate;
+
+    /** === 트랜스폼 일괄 갱신 (Tick 끝에서 더티 서브트리만 갱신) ===*/
+    // 시뮬레이션과 같은 이유로 레벨보다 먼저 선언 (씬 컴포넌트 소멸자가 접근)
+    std::unique_ptr<FWorldTransformUpdate> WorldTransformUpdate;
+
     /** === 레벨 컨테이너 === */
     std::unique_ptr<ULevel> Level;
     TArray<AActor*> PendingKillActors;  // 지연 삭제 예정 액터 목록
@@ -222,9 +247,6 @@ private:
 
     std::unique_ptr<FPhysicsScene> PhysicsScene = nullptr;
 
-    // Per-frame processed overlap pairs (A,B) keyed canonically
-    TSet<uint64> FrameOverlapPairs;
-
     //Timinig
     float UnscaledDelta;
     float SlomoOnlyDelta;
@@ -22,6 +22,13 @@ UWorldPartitionManager::UWorldPartitionManager()
 	//BVH = new FBVHierachy(FBound(), 0, 5, 1); 
 	BVH = new FBVHierarchy(FAABB(), 0, 8, 1); 
 	//BVH = new FBVHierachy(FBound(), 0, 10, 3);
+
+	// editor.ini의 BVHBuildMode=SAH면 정적 콘텐츠용 binned SAH 빌더 사용 (기본 LBVH)
+	auto BuildModeIt = EditorINI.find("BVHBuildMode");
+	if (BuildModeIt != EditorINI.end() && BuildModeIt->second == "SAH")
+	{
+		BVH->SetBuildMode(EBVHBuildMode::BinnedSAH);
+	}
 }
 
 UWorldPartitionManager::~UWorldPartitionManager()
@@ -68,7 +75,7 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 		if (it != EditorActors.end())
 			continue; // 에디터 액터는 포함하지 않는다.
 
-		const TArray<USceneComponent*> Components = Actor->GetSceneComponents();
+		const TInlineArray<USceneComponent*, 16> Components = Actor->GetSceneComponents();
 		for (USceneComponent* Component : Components)
 		{
 			if (UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component))
@@ -102,7 +109,7 @@ void UWorldPartitionManager::MarkDirty(AActor* Actor)
 	if (Cast<AGizmoActor>(Actor))
 		return;
 
-	const TArray<USceneComponent*> Components = Actor->GetSceneComponents();
+	const TInlineArray<USceneComponent*, 16> Components = Actor->GetSceneComponents();
 	for (USceneComponent* Component : Components)
 	{
 		if (UPrimitiveComponent* Smc = Cast<UPrimitiveComponent>(Component))
@@ -2,6 +2,121 @@
 #include "Distribution.h"
 #include "Source/Runtime/Engine/Components/ParticleSystemComponent.h"
 
+namespace
+{
+	// 룩업 테이블 오차/값 범위 계산 (Vector는 축별 최대값)
+	inline float CurveValueError(float A, float B)
+	{
+		return FMath::Abs(A - B);
+	}
+
+	inline float CurveValueError(const FVector& A, const FVector& B)
+	{
+		return FMath::Max(FMath::Abs(A.X - B.X), FMath::Abs(A.Y - B.Y), FMath::Abs(A.Z - B.Z));
+	}
+
+	inline void ExpandCurveRange(float Value, float& InOutMin, float& InOutMax)
+	{
+		InOutMin = FMath::Min(InOutMin, Value);
+		InOutMax = FMath::Max(InOutMax, Value);
+	}
+
+	inline void ExpandCurveRange(const FVector& Value, FVector& InOutMin, FVector& InOutMax)
+	{
+		InOutMin = FVector(FMath::Min(InOutMin.X, Value.X), FMath::Min(InOutMin.Y, Value.Y), FMath::Min(InOutMin.Z, Value.Z));
+		InOutMax = FVector(FMath::Max(InOutMax.X, Value.X), FMath::Max(InOutMax.Y, Value.Y), FMath::Max(InOutMax.Z, Value.Z));
+	}
+
+	inline float CurveRangeSize(float Min, float Max)
+	{
+		return Max - Min;
+	}
+
+	inline float CurveRangeSize(const FVector& Min, const FVector& Max)
+	{
+		return FMath::Max(Max.X - Min.X, Max.Y - Min.Y, Max.Z - Min.Z);
+	}
+
+	/**
+	 * FInterpCurveFloat/Vector 공용 베이크
+	 * 세그먼트 수를 MinSegments부터 두 배씩 늘리며, 모든 셀 중점과 키 시간에서
+	 * EvalLUT와 EvalKeys의 차이가 (값 범위 × MaxErrorRatio) 이내인 첫 해상도를 채택한다.
+	 */
+	template<typename CurveType, typename ValueType>
+	bool BakeCurveLUT(CurveType& Curve, float MaxErrorRatio)
+	{
+		Curve.InvalidateBake();
+
+		// 키 0~1개는 키 탐색도 상수 시간이다
+		const int32 NumPoints = Curve.Points.Num();
+		if (NumPoints < 2)
+		{
+			return false;
+		}
+
+		const float MinTime = Curve.Points[0].InVal;
+		const float MaxTime = Curve.Points[NumPoints - 1].InVal;
+		const float Span = MaxTime - MinTime;
+		if (!(Span > KINDA_SMALL_NUMBER))
+		{
+			return false;
+		}
+
+		TArray<ValueType> Samples;
+		for (int32 NumSegments = CurveLUT::MinSegments; NumSegments <= CurveLUT::MaxSegments; NumSegments *= 2)
+		{
+			const float SegmentTime = Span / static_cast<float>(NumSegments);
+
+			// 균일 샘플 + 마지막 칸 보간용 패딩 (Position == NumSegments일 때 Index + 1)
+			Samples.SetNum(NumSegments + 2);
+			ValueType RangeMin = Curve.Points[0].OutVal;
+			ValueType RangeMax = Curve.Points[0].OutVal;
+			for (int32 i = 0; i < NumSegments; ++i)
+			{
+				Samples[i] = Curve.EvalKeys(MinTime + SegmentTime * static_cast<float>(i));
+				ExpandCurveRange(Samples[i], RangeMin, RangeMax);
+			}
+			Samples[NumSegments] = Curve.EvalKeys(MaxTime);
+			Samples[NumSegments + 1] = Samples[NumSegments];
+			ExpandCurveRange(Samples[NumSegments], RangeMin, RangeMax);
+
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				ExpandCurveRange(Curve.Points[i].OutVal, RangeMin, RangeMax);
+			}
+
+			const float Tolerance = CurveRangeSize(RangeMin, RangeMax) * MaxErrorRatio + KINDA_SMALL_NUMBER;
+
+			// 검사도 EvalLUT로 해야 실제 평가식의 오차를 본다
+			Curve.LUT = Samples;
+			Curve.LUTMinTime = MinTime;
+			Curve.LUTTimeToIndex = static_cast<float>(NumSegments) / Span;
+			Curve.LUTMaxIndex = static_cast<float>(NumSegments);
+
+			bool bWithinTolerance = true;
+			for (int32 i = 0; i < NumSegments && bWithinTolerance; ++i)
+			{
+				const float Time = MinTime + SegmentTime * (static_cast<float>(i) + 0.5f);
+				bWithinTolerance = CurveValueError(Curve.EvalLUT(Time), Curve.EvalKeys(Time)) <= Tolerance;
+			}
+			for (int32 i = 0; i < NumPoints && bWithinTolerance; ++i)
+			{
+				const float Time = Curve.Points[i].InVal;
+				bWithinTolerance = CurveValueError(Curve.EvalLUT(Time), Curve.EvalKeys(Time)) <= Tolerance;
+			}
+
+			if (bWithinTolerance)
+			{
+				return true;
+			}
+		}
+
+		// Constant 계단처럼 해상도를 올려도 수렴하지 않는 커브는 키 탐색 유지
+		Curve.InvalidateBake();
+		return false;
+	}
+}
+
 // ============================================================
 // FDistributionFloat::GetValue() 구현
 // ============================================================
@@ -90,6 +205,33 @@ FVector FDistributionVector::GetValue(
 	}
 }
 
+// ============================================================
+// 룩업 테이블 베이크
+// ============================================================
+bool FInterpCurveFloat::Bake(float MaxErrorRatio)
+{
+	return BakeCurveLUT<FInterpCurveFloat, float>(*this, MaxErrorRatio);
+}
+
+bool FInterpCurveVector::Bake(float MaxErrorRatio)
+{
+	return BakeCurveLUT<FInterpCurveVector, FVector>(*this, MaxErrorRatio);
+}
+
+void FDistributionFloat::Bake()
+{
+	ConstantCurve.Bake();
+	MinCurve.Bake();
+	MaxCurve.Bake();
+}
+
+void FDistributionVector::Bake()
+{
+	ConstantCurve.Bake();
+	MinCurve.Bake();
+	MaxCurve.Bake();
+}
+
 // ============================================================
 // FInterpCurvePointFloat::Serialize() 구현
 // ============================================================
@@ -162,6 +304,8 @@ void FInterpCurveFloat::Serialize(bool bIsLoading, JSON& InOutHandle)
 				Points.Add(Point);
 			}
 		}
+
+		Bake();
 	}
 	else
 	{
@@ -201,6 +345,8 @@ void FInterpCurveVector::Serialize(bool bIsLoading, JSON& InOutHandle)
 				Points.Add(Point);
 			}
 		}
+
+		Bake();
 	}
 	else
 	{
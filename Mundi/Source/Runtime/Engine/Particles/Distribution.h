@@ -24,6 +24,18 @@ enum class EInterpCurveMode : uint8
 	CurveAutoClamped // 클램핑된 자동 접선 - 추후 구현
 };
 
+// ============================================================
+// 커브 룩업 테이블 (FInterpCurve*::Bake)
+// ============================================================
+// 키 구간을 균일한 샘플로 구워 Eval을 구간 탐색 없는 선형 보간 한 번으로 바꾼다.
+// 해상도는 커브마다 MinSegments부터 두 배씩 늘려, 오차가 값 범위의 MaxErrorRatio 이내가 되는 가장 작은 값을 쓴다.
+namespace CurveLUT
+{
+	constexpr int32 MinSegments = 16;
+	constexpr int32 MaxSegments = 1024;
+	constexpr float DefaultMaxErrorRatio = 0.001f;  // 값 범위의 0.1%
+}
+
 // ============================================================
 // InterpCurve 키프레임 (Float 버전)
 // ============================================================
@@ -99,14 +111,53 @@ struct FInterpCurveFloat
 	bool bIsLooped;
 	float LoopKeyOffset;
 
+	// 베이크된 룩업 테이블 (직렬화하지 않음, 비어 있으면 키 탐색으로 평가)
+	// Points를 직접 수정했다면 Bake()를 다시 호출해야 한다
+	TArray<float> LUT;            // 샘플 (세그먼트 수 + 1)개 + 마지막 칸 보간용 패딩 1개
+	float LUTMinTime = 0.0f;      // 첫 샘플 시간 (첫 키 시간)
+	float LUTTimeToIndex = 0.0f;  // 시간 → 테이블 위치 배율
+	float LUTMaxIndex = 0.0f;     // 테이블 위치 상한 (= 세그먼트 수)
+
 	FInterpCurveFloat()
 		: bIsLooped(false)
 		, LoopKeyOffset(0.0f)
 	{
 	}
 
-	// 시간에 따른 값 계산 (Linear, Constant, Curve 보간 지원)
+	// 시간에 따른 값 계산 (베이크되어 있으면 룩업 테이블, 아니면 키 탐색)
 	float Eval(float Time) const
+	{
+		if (!LUT.IsEmpty())
+		{
+			return EvalLUT(Time);
+		}
+		return EvalKeys(Time);
+	}
+
+	// 룩업 테이블 평가: 위치 클램프 → 인접 두 샘플 선형 보간 (분기 없음)
+	float EvalLUT(float Time) const
+	{
+		// Max(0, x) 순서라 Time이 NaN이어도 0번 샘플로 떨어진다
+		const float Position = FMath::Min(FMath::Max(0.0f, (Time - LUTMinTime) * LUTTimeToIndex), LUTMaxIndex);
+		const int32 Index = static_cast<int32>(Position);
+		const float Alpha = Position - static_cast<float>(Index);
+		const float* Samples = LUT.GetData();
+		return Samples[Index] + (Samples[Index + 1] - Samples[Index]) * Alpha;
+	}
+
+	/**
+	 * 키를 룩업 테이블로 굽는다 (게임 스레드, 키를 바꾼 뒤 호출)
+	 * 오차가 MaxSegments에서도 허용치를 넘으면(Constant 계단 등) 굽지 않고 키 탐색을 유지한다
+	 * @return 룩업 테이블 사용 여부
+	 */
+	bool Bake(float MaxErrorRatio = CurveLUT::DefaultMaxErrorRatio);
+
+	void InvalidateBake() { LUT.Empty(); }
+
+	bool IsBaked() const { return !LUT.IsEmpty(); }
+
+	// 키 구간 탐색 평가 (Linear, Constant, Curve 보간 지원)
+	float EvalKeys(float Time) const
 	{
 		if (Points.IsEmpty())
 		{
@@ -182,6 +233,7 @@ struct FInterpCurveFloat
 	void AddPoint(float Time, float Value, EInterpCurveMode Mode = EInterpCurveMode::Linear)
 	{
 		Points.Add(FInterpCurvePointFloat(Time, Value, Mode));
+		InvalidateBake();
 	}
 
 	// CurveAuto/CurveAutoClamped 모드용 탄젠트 자동 계산
@@ -268,14 +320,59 @@ struct FInterpCurveVector
 	bool bIsLooped;
 	float LoopKeyOffset;
 
+	// 베이크된 룩업 테이블 (직렬화하지 않음, 비어 있으면 키 탐색으로 평가)
+	// Points를 직접 수정했다면 Bake()를 다시 호출해야 한다
+	TArray<FVector> LUT;          // 샘플 (세그먼트 수 + 1)개 + 마지막 칸 보간용 패딩 1개
+	float LUTMinTime = 0.0f;      // 첫 샘플 시간 (첫 키 시간)
+	float LUTTimeToIndex = 0.0f;  // 시간 → 테이블 위치 배율
+	float LUTMaxIndex = 0.0f;     // 테이블 위치 상한 (= 세그먼트 수)
+
 	FInterpCurveVector()
 		: bIsLooped(false)
 		, LoopKeyOffset(0.0f)
 	{
 	}
 
-	// 시간에 따른 값 계산 (Linear, Constant, Curve 보간 지원)
+	// 시간에 따른 값 계산 (베이크되어 있으면 룩업 테이블, 아니면 키 탐색)
 	FVector Eval(float Time) const
+	{
+		if (!LUT.IsEmpty())
+		{
+			return EvalLUT(Time);
+		}
+		return EvalKeys(Time);
+	}
+
+	// 룩업 테이블 평가: 위치 클램프 → 인접 두 샘플 선형 보간 (분기 없음)
+	FVector EvalLUT(float Time) const
+	{
+		// Max(0, x) 순서라 Time이 NaN이어도 0번 샘플로 떨어진다
+		const float Position = FMath::Min(FMath::Max(0.0f, (Time - LUTMinTime) * LUTTimeToIndex), LUTMaxIndex);
+		const int32 Index = static_cast<int32>(Position);
+		const float Alpha = Position - static_cast<float>(Index);
+		const FVector* Samples = LUT.GetData();
+		const FVector& A = Samples[Index];
+		const FVector& B = Samples[Index + 1];
+		return FVector(
+			A.X + (B.X - A.X) * Alpha,
+			A.Y + (B.Y - A.Y) * Alpha,
+			A.Z + (B.Z - A.Z) * Alpha
+		);
+	}
+
+	/**
+	 * 키를 룩업 테이블로 굽는다 (게임 스레드, 키를 바꾼 뒤 호출)
+	 * 오차가 MaxSegments에서도 허용치를 넘으면(Constant 계단 등) 굽지 않고 키 탐색을 유지한다
+	 * @return 룩업 테이블 사용 여부
+	 */
+	bool Bake(float MaxErrorRatio = CurveLUT::DefaultMaxErrorRatio);
+
+	void InvalidateBake() { LUT.Empty(); }
+
+	bool IsBaked() const { return !LUT.IsEmpty(); }
+
+	// 키 구간 탐색 평가 (Linear, Constant, Curve 보간 지원)
+	FVector EvalKeys(float Time) const
 	{
 		if (Points.IsEmpty())
 		{
@@ -359,6 +456,7 @@ struct FInterpCurveVector
 	void AddPoint(float Time, const FVector& Value, EInterpCurveMode Mode = EInterpCurveMode::Linear)
 	{
 		Points.Add(FInterpCurvePointVector(Time, Value, Mode));
+		InvalidateBake();
 	}
 
 	// CurveAuto/CurveAutoClamped 모드용 탄젠트 자동 계산
@@ -557,6 +655,9 @@ struct FDistributionFloat
 	// 직렬화
 	void Serialize(bool bIsLoading, JSON& InOutHandle);
 
+	// 커브들을 룩업 테이블로 굽는다 (커브 키를 바꾼 뒤 게임 스레드에서 호출)
+	void Bake();
+
 	// LOD 스케일링: 모든 값을 Multiplier로 곱함
 	void ScaleValues(float Multiplier)
 	{
@@ -578,6 +679,8 @@ struct FDistributionFloat
 		{
 			Point.OutVal *= Multiplier;
 		}
+
+		Bake();
 	}
 };
 
@@ -670,6 +773,9 @@ struct FDistributionVector
 
 	// 직렬화
 	void Serialize(bool bIsLoading, JSON& InOutHandle);
+
+	// 커브들을 룩업 테이블로 굽는다 (커브 키를 바꾼 뒤 게임 스레드에서 호출)
+	void Bake();
 };
 
 // ============================================================
@@ -739,4 +845,10 @@ struct FDistributionColor
 
 	// 직렬화
 	void Serialize(bool bIsLoading, JSON& InOutHandle);
+
+	void Bake()
+	{
+		RGB.Bake();
+		Alpha.Bake();
+	}
 };
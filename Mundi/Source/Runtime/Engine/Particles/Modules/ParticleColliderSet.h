@@ -0,0 +1,290 @@
+#pragma once
+
+#include <immintrin.h>
+
+class UPrimitiveComponent;
+
+/**
+ * UParticleModuleCollision의 정밀 검사용 컬라이더 집합
+ *
+ * 이미터당 광역 쿼리 한 번으로 얻은 후보를 종류별로 4개씩 레인에 묶어 두고,
+ * 파티클 구체 하나를 묶음 4개와 SSE로 동시에 검사한다.
+ * 묶음의 남는 레인은 먼 좌표의 빈 컬라이더(Collider = -1)로 채워 거리 검사와 선택 양쪽에서 걸러진다.
+ */
+
+enum class EParticleColliderKind : uint8
+{
+	Box,          // ShapeComponent 박스 (OBB)
+	Sphere,
+	Capsule,
+	MeshBounds,   // StaticMeshComponent 월드 AABB (축 정렬 박스)
+};
+
+// 후보 컬라이더 (이미터당 한 번 만들어 모든 파티클이 공유, 법선 계산과 이벤트용)
+struct FParticleCollider
+{
+	UPrimitiveComponent* Component = nullptr;
+	EParticleColliderKind Kind = EParticleColliderKind::Box;
+	FVector Center;          // Box/MeshBounds/Sphere 중심, Capsule은 P0
+	FVector Axes[3];         // Box/MeshBounds 축, Capsule은 Axes[0]이 P0→P1 방향
+	float HalfExtent[3];     // Box/MeshBounds 반크기, Capsule은 HalfExtent[0]이 길이
+	float Radius = 0.0f;     // Sphere/Capsule 반지름
+};
+
+// 같은 종류 컬라이더 4개를 레인별로 모은 묶음 (파티클 하나를 4개와 동시에 검사)
+struct FParticleBoxPacket
+{
+	float CenterX[4], CenterY[4], CenterZ[4];
+	float AxisX[3][4], AxisY[3][4], AxisZ[3][4];
+	float Extent[3][4];
+	int32 Collider[4];
+};
+
+struct FParticleSpherePacket
+{
+	float CenterX[4], CenterY[4], CenterZ[4];
+	float Radius[4];         // 구 반지름 (표면까지 거리 계산용)
+	float RadiusSq[4];       // (구 반지름 + 파티클 반지름)^2
+	int32 Collider[4];
+};
+
+struct FParticleCapsulePacket
+{
+	float P0X[4], P0Y[4], P0Z[4];
+	float DirX[4], DirY[4], DirZ[4];
+	float Length[4];
+	float Radius[4];         // 캡슐 반지름 (표면까지 거리 계산용)
+	float RadiusSq[4];       // (캡슐 반지름 + 파티클 반지름)^2
+	int32 Collider[4];
+};
+
+// 이미터 하나의 후보 컬라이더 집합 (프레임 아레나, 종류별 SoA 묶음)
+struct FParticleColliderSet
+{
+	// 빈 레인 좌표: 제곱해도 float 범위 안이고 어떤 반지름보다도 멀다
+	static constexpr float EmptyLaneCoord = 1.0e18f;
+
+	TFrameArray<FParticleCollider> Colliders;
+	TFrameArray<FParticleBoxPacket> Boxes;
+	TFrameArray<FParticleSpherePacket> Spheres;
+	TFrameArray<FParticleCapsulePacket> Capsules;
+	int32 NumBoxes = 0;
+	int32 NumSpheres = 0;
+	int32 NumCapsules = 0;
+
+	// 다음 레인 (꽉 찼으면 빈 레인으로 채운 새 묶음을 추가)
+	template<typename PacketType>
+	static PacketType& NextLane(TFrameArray<PacketType>& Packets, int32& Count, int32& OutLane)
+	{
+		OutLane = Count & 3;
+		if (OutLane == 0)
+		{
+			PacketType Packet = {};
+			InitEmptyPacket(Packet);
+			Packets.Add(Packet);
+		}
+		++Count;
+		return Packets.Last();
+	}
+
+	// 축이 0이면 투영/클램프/차이가 모두 0이 되어 항상 맞으므로 단위 축으로 채워 먼 중심까지의 거리가 그대로 남게 한다
+	static void InitEmptyPacket(FParticleBoxPacket& Packet)
+	{
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			Packet.CenterX[Lane] = Packet.CenterY[Lane] = Packet.CenterZ[Lane] = EmptyLaneCoord;
+			Packet.AxisX[0][Lane] = 1.0f;
+			Packet.AxisY[1][Lane] = 1.0f;
+			Packet.AxisZ[2][Lane] = 1.0f;
+			Packet.Collider[Lane] = -1;
+		}
+	}
+
+	static void InitEmptyPacket(FParticleSpherePacket& Packet)
+	{
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			Packet.CenterX[Lane] = Packet.CenterY[Lane] = Packet.CenterZ[Lane] = EmptyLaneCoord;
+			Packet.Collider[Lane] = -1;
+		}
+	}
+
+	static void InitEmptyPacket(FParticleCapsulePacket& Packet)
+	{
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			Packet.P0X[Lane] = Packet.P0Y[Lane] = Packet.P0Z[Lane] = EmptyLaneCoord;
+			Packet.Collider[Lane] = -1;
+		}
+	}
+
+	void AddBox(const FParticleCollider& Collider)
+	{
+		const int32 Index = Colliders.Num();
+		Colliders.Add(Collider);
+
+		int32 Lane;
+		FParticleBoxPacket& Packet = NextLane(Boxes, NumBoxes, Lane);
+		Packet.CenterX[Lane] = Collider.Center.X;
+		Packet.CenterY[Lane] = Collider.Center.Y;
+		Packet.CenterZ[Lane] = Collider.Center.Z;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Packet.AxisX[Axis][Lane] = Collider.Axes[Axis].X;
+			Packet.AxisY[Axis][Lane] = Collider.Axes[Axis].Y;
+			Packet.AxisZ[Axis][Lane] = Collider.Axes[Axis].Z;
+			Packet.Extent[Axis][Lane] = Collider.HalfExtent[Axis];
+		}
+		Packet.Collider[Lane] = Index;
+	}
+
+	void AddSphere(const FParticleCollider& Collider, float ParticleRadius)
+	{
+		const int32 Index = Colliders.Num();
+		Colliders.Add(Collider);
+
+		int32 Lane;
+		FParticleSpherePacket& Packet = NextLane(Spheres, NumSpheres, Lane);
+		Packet.CenterX[Lane] = Collider.Center.X;
+		Packet.CenterY[Lane] = Collider.Center.Y;
+		Packet.CenterZ[Lane] = Collider.Center.Z;
+		Packet.Radius[Lane] = Collider.Radius;
+		const float CombinedRadius = Collider.Radius + ParticleRadius;
+		Packet.RadiusSq[Lane] = CombinedRadius * CombinedRadius;
+		Packet.Collider[Lane] = Index;
+	}
+
+	void AddCapsule(const FParticleCollider& Collider, float ParticleRadius)
+	{
+		const int32 Index = Colliders.Num();
+		Colliders.Add(Collider);
+
+		int32 Lane;
+		FParticleCapsulePacket& Packet = NextLane(Capsules, NumCapsules, Lane);
+		Packet.P0X[Lane] = Collider.Center.X;
+		Packet.P0Y[Lane] = Collider.Center.Y;
+		Packet.P0Z[Lane] = Collider.Center.Z;
+		Packet.DirX[Lane] = Collider.Axes[0].X;
+		Packet.DirY[Lane] = Collider.Axes[0].Y;
+		Packet.DirZ[Lane] = Collider.Axes[0].Z;
+		Packet.Length[Lane] = Collider.HalfExtent[0];
+		Packet.Radius[Lane] = Collider.Radius;
+		const float CombinedRadius = Collider.Radius + ParticleRadius;
+		Packet.RadiusSq[Lane] = CombinedRadius * CombinedRadius;
+		Packet.Collider[Lane] = Index;
+	}
+
+	// 구-OBB: 박스 축으로 투영 → 반크기로 클램프 → 차이의 제곱합 (박스 표면까지 거리^2, 내부면 0)
+	static __m128 BoxDistanceSq(const FParticleBoxPacket& Packet, __m128 PX, __m128 PY, __m128 PZ)
+	{
+		const __m128 Zero = _mm_setzero_ps();
+		const __m128 DX = _mm_sub_ps(PX, _mm_loadu_ps(Packet.CenterX));
+		const __m128 DY = _mm_sub_ps(PY, _mm_loadu_ps(Packet.CenterY));
+		const __m128 DZ = _mm_sub_ps(PZ, _mm_loadu_ps(Packet.CenterZ));
+		__m128 DistSq = Zero;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const __m128 Local = _mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(DX, _mm_loadu_ps(Packet.AxisX[Axis])),
+				_mm_mul_ps(DY, _mm_loadu_ps(Packet.AxisY[Axis]))),
+				_mm_mul_ps(DZ, _mm_loadu_ps(Packet.AxisZ[Axis])));
+			const __m128 Extent = _mm_loadu_ps(Packet.Extent[Axis]);
+			const __m128 Clamped = _mm_min_ps(_mm_max_ps(Local, _mm_sub_ps(Zero, Extent)), Extent);
+			const __m128 Diff = _mm_sub_ps(Local, Clamped);
+			DistSq = _mm_add_ps(DistSq, _mm_mul_ps(Diff, Diff));
+		}
+		return DistSq;
+	}
+
+	// 구-구: 중심 사이 거리^2
+	static __m128 SphereCenterDistanceSq(const FParticleSpherePacket& Packet, __m128 PX, __m128 PY, __m128 PZ)
+	{
+		const __m128 DX = _mm_sub_ps(PX, _mm_loadu_ps(Packet.CenterX));
+		const __m128 DY = _mm_sub_ps(PY, _mm_loadu_ps(Packet.CenterY));
+		const __m128 DZ = _mm_sub_ps(PZ, _mm_loadu_ps(Packet.CenterZ));
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, DX), _mm_mul_ps(DY, DY)), _mm_mul_ps(DZ, DZ));
+	}
+
+	// 구-캡슐: 중심선 위 최근접점까지의 거리^2
+	static __m128 CapsuleAxisDistanceSq(const FParticleCapsulePacket& Packet, __m128 PX, __m128 PY, __m128 PZ)
+	{
+		const __m128 Zero = _mm_setzero_ps();
+		const __m128 DX = _mm_sub_ps(PX, _mm_loadu_ps(Packet.P0X));
+		const __m128 DY = _mm_sub_ps(PY, _mm_loadu_ps(Packet.P0Y));
+		const __m128 DZ = _mm_sub_ps(PZ, _mm_loadu_ps(Packet.P0Z));
+		const __m128 DirX = _mm_loadu_ps(Packet.DirX);
+		const __m128 DirY = _mm_loadu_ps(Packet.DirY);
+		const __m128 DirZ = _mm_loadu_ps(Packet.DirZ);
+		const __m128 Projection = _mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, DirX), _mm_mul_ps(DY, DirY)), _mm_mul_ps(DZ, DirZ));
+		const __m128 T = _mm_min_ps(_mm_max_ps(Projection, Zero), _mm_loadu_ps(Packet.Length));
+		const __m128 EX = _mm_sub_ps(DX, _mm_mul_ps(DirX, T));
+		const __m128 EY = _mm_sub_ps(DY, _mm_mul_ps(DirY, T));
+		const __m128 EZ = _mm_sub_ps(DZ, _mm_mul_ps(DirZ, T));
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(EX, EX), _mm_mul_ps(EY, EY)), _mm_mul_ps(EZ, EZ));
+	}
+
+	// 맞은 레인 중 파티클 중심에서 표면까지 가장 가까운 컬라이더로 갱신 (같으면 후보 순서가 앞선 쪽)
+	// 빈 레인(-1)은 거리 검사와 무관하게 제외
+	static void SelectNearestHit(int32 Mask, const int32* LaneColliders, __m128 LaneSurfaceDistance, int32& InOutBest, float& InOutBestDistance)
+	{
+		alignas(16) float SurfaceDistance[4];
+		_mm_store_ps(SurfaceDistance, LaneSurfaceDistance);
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const int32 Collider = LaneColliders[Lane];
+			if (!(Mask & (1 << Lane)) || Collider < 0)
+			{
+				continue;
+			}
+
+			if (SurfaceDistance[Lane] < InOutBestDistance || (SurfaceDistance[Lane] == InOutBestDistance && Collider < InOutBest))
+			{
+				InOutBest = Collider;
+				InOutBestDistance = SurfaceDistance[Lane];
+			}
+		}
+	}
+
+	// 파티클 구체(Location, ParticleRadius)와 겹치는 컬라이더 중 표면이 가장 가까운 것의 인덱스, 없으면 -1
+	// (박스 내부는 거리 0, 구/캡슐에 파고든 경우는 음수라 더 깊이 파고든 쪽이 우선)
+	int32 FindNearestHit(const FVector& Location, float ParticleRadius) const
+	{
+		const __m128 PX = _mm_set1_ps(Location.X);
+		const __m128 PY = _mm_set1_ps(Location.Y);
+		const __m128 PZ = _mm_set1_ps(Location.Z);
+		int32 Best = INT32_MAX;
+		float BestDistance = FLT_MAX;
+
+		// 표면 거리(sqrt)는 맞은 레인이 있는 묶음에서만 계산
+		const __m128 ParticleRadiusSq = _mm_set1_ps(ParticleRadius * ParticleRadius);
+		for (const FParticleBoxPacket& Packet : Boxes)
+		{
+			const __m128 DistSq = BoxDistanceSq(Packet, PX, PY, PZ);
+			if (const int32 Mask = _mm_movemask_ps(_mm_cmple_ps(DistSq, ParticleRadiusSq)))
+			{
+				SelectNearestHit(Mask, Packet.Collider, _mm_sqrt_ps(DistSq), Best, BestDistance);
+			}
+		}
+
+		for (const FParticleSpherePacket& Packet : Spheres)
+		{
+			const __m128 DistSq = SphereCenterDistanceSq(Packet, PX, PY, PZ);
+			if (const int32 Mask = _mm_movemask_ps(_mm_cmplt_ps(DistSq, _mm_loadu_ps(Packet.RadiusSq))))
+			{
+				SelectNearestHit(Mask, Packet.Collider, _mm_sub_ps(_mm_sqrt_ps(DistSq), _mm_loadu_ps(Packet.Radius)), Best, BestDistance);
+			}
+		}
+
+		for (const FParticleCapsulePacket& Packet : Capsules)
+		{
+			const __m128 DistSq = CapsuleAxisDistanceSq(Packet, PX, PY, PZ);
+			if (const int32 Mask = _mm_movemask_ps(_mm_cmplt_ps(DistSq, _mm_loadu_ps(Packet.RadiusSq))))
+			{
+				SelectNearestHit(Mask, Packet.Collider, _mm_sub_ps(_mm_sqrt_ps(DistSq), _mm_loadu_ps(Packet.Radius)), Best, BestDistance);
+			}
+		}
+
+		return (Best == INT32_MAX) ? -1 : Best;
+	}
+};
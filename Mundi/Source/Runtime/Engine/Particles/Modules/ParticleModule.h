@@ -71,4 +71,18 @@ public:
 	// LOD 스케일링: 하위 LOD 생성 시 값들을 Multiplier로 스케일
 	// 파생 클래스에서 오버라이드하여 SpawnRate, BurstCount 등을 조정
 	virtual void ScaleForLOD(float Multiplier) {}
+
+	// 파티클 시뮬레이션 단계에서 다른 이미터와 동시에(워커 스레드) Update해도 되는지
+	// 월드나 다른 컴포넌트를 조회하거나, 모듈 자체에 상태를 쌓는 모듈은 false로 두어 게임 스레드에서 순서대로 돈다
+	virtual bool CanUpdateOnWorkerThread() const { return true; }
+
+	// SoA 레이아웃(UParticleModuleRequired::bUseSoALayout)에서 동작할 수 있는지
+	// 이미터의 모든 모듈이 true여야 SoA로 저장된다 (Spawn은 AoS 임시 파티클에 그대로 수행)
+	virtual bool SupportsSoALayout() const { return false; }
+
+	// SoA 레이아웃용 Update (bUpdateModule인 모듈만 호출됨)
+	virtual void UpdateSoA(FModuleSoAUpdateContext& Context)
+	{
+		// 파생 클래스에서 오버라이드
+	}
 };
@@ -78,6 +78,77 @@ void UParticleModuleAcceleration::Update(FModuleUpdateContext& Context)
 	END_UPDATE_LOOP;
 }
 
+// SoA 레이아웃: 가속도 계산(커브 평가 제외)과 속도 적분을 4개씩 처리
+void UParticleModuleAcceleration::UpdateSoA(FModuleSoAUpdateContext& Context)
+{
+	const EDistributionType DistType = AccelerationOverLife.Type;
+
+	FParticleSoAData& Particles = Context.Particles;
+	const int32 Capacity = Particles.Capacity;
+	float* VelX = PARTICLE_SOA_STREAM(Particles, Velocity);
+	const float* RelativeTime = PARTICLE_SOA_STREAM(Particles, RelativeTime);
+	const float* RandX = Particles.GetStream(Context.Offset + static_cast<int32>(offsetof(FParticleAccelerationPayload, RandomFactor)));
+	const float* GravityZ = Particles.GetStream(Context.Offset + static_cast<int32>(offsetof(FParticleAccelerationPayload, GravityZ)));
+
+	const __m128 Dt = _mm_set1_ps(Context.DeltaTime);
+
+	// 시간과 무관한 타입은 루프 밖에서 레인으로 펼쳐둔다
+	const FVector& ConstantSource = AccelerationOverLife.ConstantValue;
+	const __m128 ConstX = _mm_set1_ps(ConstantSource.X);
+	const __m128 ConstY = _mm_set1_ps(ConstantSource.Y);
+	const __m128 ConstZ = _mm_set1_ps(ConstantSource.Z);
+	const __m128 MinX = _mm_set1_ps(AccelerationOverLife.MinValue.X);
+	const __m128 MinY = _mm_set1_ps(AccelerationOverLife.MinValue.Y);
+	const __m128 MinZ = _mm_set1_ps(AccelerationOverLife.MinValue.Z);
+	const __m128 MaxX = _mm_set1_ps(AccelerationOverLife.MaxValue.X);
+	const __m128 MaxY = _mm_set1_ps(AccelerationOverLife.MaxValue.Y);
+	const __m128 MaxZ = _mm_set1_ps(AccelerationOverLife.MaxValue.Z);
+
+	const int32 Packed = ParticleSoA::PackedCount(Context.NumParticles);
+	for (int32 i = 0; i < Packed; i += 4)
+	{
+		__m128 AX, AY, AZ;
+
+		switch (DistType)
+		{
+		case EDistributionType::ConstantCurve:
+			ParticleSoA::EvalVectorCurve4(AccelerationOverLife.ConstantCurve, RelativeTime + i, AX, AY, AZ);
+			break;
+
+		case EDistributionType::UniformCurve:
+			{
+				__m128 CurveMinX, CurveMinY, CurveMinZ, CurveMaxX, CurveMaxY, CurveMaxZ;
+				ParticleSoA::EvalVectorCurve4(AccelerationOverLife.MinCurve, RelativeTime + i, CurveMinX, CurveMinY, CurveMinZ);
+				ParticleSoA::EvalVectorCurve4(AccelerationOverLife.MaxCurve, RelativeTime + i, CurveMaxX, CurveMaxY, CurveMaxZ);
+				AX = ParticleSoA::Lerp(CurveMinX, CurveMaxX, _mm_load_ps(RandX + i));
+				AY = ParticleSoA::Lerp(CurveMinY, CurveMaxY, _mm_load_ps(RandX + Capacity + i));
+				AZ = ParticleSoA::Lerp(CurveMinZ, CurveMaxZ, _mm_load_ps(RandX + 2 * Capacity + i));
+			}
+			break;
+
+		case EDistributionType::Uniform:
+			AX = ParticleSoA::Lerp(MinX, MaxX, _mm_load_ps(RandX + i));
+			AY = ParticleSoA::Lerp(MinY, MaxY, _mm_load_ps(RandX + Capacity + i));
+			AZ = ParticleSoA::Lerp(MinZ, MaxZ, _mm_load_ps(RandX + 2 * Capacity + i));
+			break;
+
+		default:
+			AX = ConstX;
+			AY = ConstY;
+			AZ = ConstZ;
+			break;
+		}
+
+		// 중력 추가
+		AZ = _mm_add_ps(AZ, _mm_load_ps(GravityZ + i));
+
+		// 속도에 가속도 적용
+		_mm_store_ps(VelX + i, _mm_add_ps(_mm_load_ps(VelX + i), _mm_mul_ps(AX, Dt)));
+		_mm_store_ps(VelX + Capacity + i, _mm_add_ps(_mm_load_ps(VelX + Capacity + i), _mm_mul_ps(AY, Dt)));
+		_mm_store_ps(VelX + 2 * Capacity + i, _mm_add_ps(_mm_load_ps(VelX + 2 * Capacity + i), _mm_mul_ps(AZ, Dt)));
+	}
+}
+
 void UParticleModuleAcceleration::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	UParticleModule::Serialize(bInIsLoading, InOutHandle);
@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "ParticleModuleCollision.h"
+#include "ParticleColliderSet.h"
 #include "ParticleEmitterInstance.h"
 #include "ParticleSystemComponent.h"
 #include "World.h"
@@ -12,6 +13,163 @@
 #include "AABB.h"
 #include "OBB.h"
 
+namespace
+{
+	// 후보 컴포넌트 → 컬라이더 (트랜스폼, OBB/캡슐 구성은 이미터당 한 번만)
+	void BuildColliderSet(const TFrameArray<UPrimitiveComponent*>& Candidates, float ParticleRadius, FParticleColliderSet& OutSet)
+	{
+		OutSet.Colliders.reserve(Candidates.Num());
+
+		for (UPrimitiveComponent* PrimComp : Candidates)
+		{
+			if (!PrimComp)
+			{
+				continue;
+			}
+
+			FParticleCollider Collider;
+			Collider.Component = PrimComp;
+
+			// 1. ShapeComponent인 경우 - 정밀 충돌 형상
+			if (UShapeComponent* ShapeComp = Cast<UShapeComponent>(PrimComp))
+			{
+				FShape Shape;
+				ShapeComp->GetShape(Shape);
+				const FTransform ShapeTransform = ShapeComp->GetWorldTransform();
+
+				switch (Shape.Kind)
+				{
+				case EShapeKind::Box:
+					{
+						FOBB BoxOBB;
+						Collision::BuildOBB(Shape, ShapeTransform, BoxOBB);
+						Collider.Kind = EParticleColliderKind::Box;
+						Collider.Center = BoxOBB.Center;
+						for (int32 Axis = 0; Axis < 3; ++Axis)
+						{
+							Collider.Axes[Axis] = BoxOBB.Axes[Axis];
+							Collider.HalfExtent[Axis] = BoxOBB.HalfExtent[Axis];
+						}
+						OutSet.AddBox(Collider);
+					}
+					break;
+
+				case EShapeKind::Sphere:
+					{
+						Collider.Kind = EParticleColliderKind::Sphere;
+						Collider.Center = ShapeTransform.Translation;
+						Collider.Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(ShapeTransform.Scale3D);
+						OutSet.AddSphere(Collider, ParticleRadius);
+					}
+					break;
+
+				case EShapeKind::Capsule:
+					{
+						FVector P0, P1;
+						float CapsuleRadius;
+						Collision::BuildCapsule(Shape, ShapeTransform, P0, P1, CapsuleRadius);
+
+						FVector CapsuleDir = P1 - P0;
+						const float CapsuleLen = CapsuleDir.Size();
+						if (CapsuleLen > KINDA_SMALL_NUMBER)
+						{
+							CapsuleDir /= CapsuleLen;
+						}
+
+						Collider.Kind = EParticleColliderKind::Capsule;
+						Collider.Center = P0;
+						Collider.Axes[0] = CapsuleDir;
+						Collider.HalfExtent[0] = CapsuleLen;
+						Collider.Radius = CapsuleRadius;
+						OutSet.AddCapsule(Collider, ParticleRadius);
+					}
+					break;
+				}
+			}
+			// 2. StaticMeshComponent인 경우 - 월드 AABB를 축 정렬 박스로
+			else if (UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(PrimComp))
+			{
+				const FAABB MeshAABB = MeshComp->GetWorldAABB();
+				Collider.Kind = EParticleColliderKind::MeshBounds;
+				Collider.Center = (MeshAABB.Min + MeshAABB.Max) * 0.5f;
+				Collider.Axes[0] = FVector(1.0f, 0.0f, 0.0f);
+				Collider.Axes[1] = FVector(0.0f, 1.0f, 0.0f);
+				Collider.Axes[2] = FVector(0.0f, 0.0f, 1.0f);
+				Collider.HalfExtent[0] = (MeshAABB.Max.X - MeshAABB.Min.X) * 0.5f;
+				Collider.HalfExtent[1] = (MeshAABB.Max.Y - MeshAABB.Min.Y) * 0.5f;
+				Collider.HalfExtent[2] = (MeshAABB.Max.Z - MeshAABB.Min.Z) * 0.5f;
+				OutSet.AddBox(Collider);
+			}
+		}
+	}
+
+	// 충돌한 컬라이더의 표면 법선 (충돌 판정이 난 파티클에 대해서만 스칼라로 계산)
+	FVector ComputeHitNormal(const FParticleCollider& Collider, const FVector& Location)
+	{
+		FVector HitNormal = FVector(0.0f, 0.0f, 0.0f);
+
+		switch (Collider.Kind)
+		{
+		case EParticleColliderKind::Box:
+			{
+				// 박스 로컬 좌표에서 가장 가까운 면의 축
+				const FVector ToParticle = Location - Collider.Center;
+				float MinDist = FLT_MAX;
+				for (int32 Axis = 0; Axis < 3; Axis++)
+				{
+					const float LocalPos = FVector::Dot(ToParticle, Collider.Axes[Axis]);
+					const float Dist = FMath::Abs(FMath::Abs(LocalPos) - Collider.HalfExtent[Axis]);
+					if (Dist < MinDist)
+					{
+						MinDist = Dist;
+						HitNormal = Collider.Axes[Axis] * ((LocalPos > 0) ? 1.0f : -1.0f);
+					}
+				}
+			}
+			break;
+
+		case EParticleColliderKind::Sphere:
+			{
+				HitNormal = Location - Collider.Center;
+				HitNormal.Normalize();
+			}
+			break;
+
+		case EParticleColliderKind::Capsule:
+			{
+				const float Projection = FMath::Clamp(FVector::Dot(Location - Collider.Center, Collider.Axes[0]), 0.0f, Collider.HalfExtent[0]);
+				const FVector ClosestPoint = Collider.Center + Collider.Axes[0] * Projection;
+				HitNormal = Location - ClosestPoint;
+				HitNormal.Normalize();
+			}
+			break;
+
+		case EParticleColliderKind::MeshBounds:
+			{
+				// AABB 표면 법선 계산
+				FVector ClosestPoint;
+				ClosestPoint.X = FMath::Clamp(Location.X, Collider.Center.X - Collider.HalfExtent[0], Collider.Center.X + Collider.HalfExtent[0]);
+				ClosestPoint.Y = FMath::Clamp(Location.Y, Collider.Center.Y - Collider.HalfExtent[1], Collider.Center.Y + Collider.HalfExtent[1]);
+				ClosestPoint.Z = FMath::Clamp(Location.Z, Collider.Center.Z - Collider.HalfExtent[2], Collider.Center.Z + Collider.HalfExtent[2]);
+
+				HitNormal = Location - ClosestPoint;
+				if (HitNormal.SizeSquared() > KINDA_SMALL_NUMBER)
+				{
+					HitNormal.Normalize();
+				}
+				else
+				{
+					// 파티클이 AABB 내부에 있는 경우 - 위쪽으로 밀어냄
+					HitNormal = FVector(0.0f, 0.0f, 1.0f);
+				}
+			}
+			break;
+		}
+
+		return HitNormal;
+	}
+}
+
 void UParticleModuleCollision::Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase)
 {
 	if (!ParticleBase || !Owner || !Owner->Component)
@@ -58,8 +216,11 @@ void UParticleModuleCollision::Update(FModuleUpdateContext& Context)
 	}
 	FBVHierarchy* BVH = Partition->GetBVH();
 
-	float DeltaTime = Context.DeltaTime;
-	int32 Offset = Context.Offset;
+	// 1. 검사할 파티클 수집 + 이동 경로(터널링 방지) 전체를 덮는 이미터 단위 바운드
+	TFrameArray<int32> TestParticles;
+	TestParticles.reserve(Context.Owner.ActiveParticles);
+	FVector SweepMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector SweepMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
 
 	BEGIN_UPDATE_LOOP
 		PARTICLE_ELEMENT(FParticleCollisionPayload, CollPayload);
@@ -80,201 +241,101 @@ void UParticleModuleCollision::Update(FModuleUpdateContext& Context)
 			continue;
 		}
 
-		// 이동 경로 계산 (터널링 방지)
-		FVector Start = Particle.OldLocation;
-		FVector End = Particle.Location;
-
-		// 1. 광역 검사 (CollisionManager AABB 쿼리) - 경로 전체를 포함하는 바운드
-		FAABB PathBounds;
-		// Component-wise min/max
-		PathBounds.Min = FVector(
-			FMath::Min(Start.X, End.X) - ParticleRadius,
-			FMath::Min(Start.Y, End.Y) - ParticleRadius,
-			FMath::Min(Start.Z, End.Z) - ParticleRadius
-		);
-		PathBounds.Max = FVector(
-			FMath::Max(Start.X, End.X) + ParticleRadius,
-			FMath::Max(Start.Y, End.Y) + ParticleRadius,
-			FMath::Max(Start.Z, End.Z) + ParticleRadius
-		);
-
-		// BVH에서 PrimitiveComponent 쿼리 (ShapeComponent + StaticMeshComponent 포함)
-		TArray<UPrimitiveComponent*> Candidates = BVH->QueryIntersectedComponents(PathBounds);
-
-		// 2. 정밀 검사
-		for (UPrimitiveComponent* PrimComp : Candidates)
-		{
-			if (!PrimComp)
-			{
-				continue;
-			}
-
-			// 충돌 검사: 파티클 현재 위치를 구체로 취급
-			FBoundingSphere ParticleSphere;
-			ParticleSphere.Center = Particle.Location;
-			ParticleSphere.Radius = ParticleRadius;
-
-			// 충돌 여부 검사
-			bool bCollided = false;
-			FVector HitNormal = FVector(0.0f, 0.0f, 0.0f);
-
-			// 1. ShapeComponent인 경우 - 기존 정밀 충돌 검사
-			if (UShapeComponent* ShapeComp = Cast<UShapeComponent>(PrimComp))
-			{
-				FShape Shape;
-				ShapeComp->GetShape(Shape);
-				FTransform ShapeTransform = ShapeComp->GetWorldTransform();
+		const FVector& Start = Particle.OldLocation;
+		const FVector& End = Particle.Location;
+		SweepMin.X = FMath::Min(SweepMin.X, FMath::Min(Start.X, End.X));
+		SweepMin.Y = FMath::Min(SweepMin.Y, FMath::Min(Start.Y, End.Y));
+		SweepMin.Z = FMath::Min(SweepMin.Z, FMath::Min(Start.Z, End.Z));
+		SweepMax.X = FMath::Max(SweepMax.X, FMath::Max(Start.X, End.X));
+		SweepMax.Y = FMath::Max(SweepMax.Y, FMath::Max(Start.Y, End.Y));
+		SweepMax.Z = FMath::Max(SweepMax.Z, FMath::Max(Start.Z, End.Z));
+		TestParticles.Add(CurrentIndex);
+	END_UPDATE_LOOP
 
-				switch (Shape.Kind)
-				{
-				case EShapeKind::Box:
-					{
-						FOBB BoxOBB;
-						Collision::BuildOBB(Shape, ShapeTransform, BoxOBB);
-						bCollided = Collision::Overlap_Sphere_OBB(ParticleSphere.Center, ParticleSphere.Radius, BoxOBB);
-						if (bCollided)
-						{
-							// 박스의 가장 가까운 표면 법선 계산 (단순화)
-							FMatrix InvMatrix = ShapeTransform.ToMatrix().Inverse();
-							FVector LocalPos = InvMatrix.TransformPosition(Particle.Location);
-							FVector Extent = Shape.Box.BoxExtent;
-
-							// 각 축에서 가장 가까운 면 찾기
-							float MinDist = FLT_MAX;
-							for (int32 Axis = 0; Axis < 3; Axis++)
-							{
-								float Dist = FMath::Abs(FMath::Abs(LocalPos[Axis]) - Extent[Axis]);
-								if (Dist < MinDist)
-								{
-									MinDist = Dist;
-									HitNormal = FVector(0.0f, 0.0f, 0.0f);
-									HitNormal[Axis] = (LocalPos[Axis] > 0) ? 1.0f : -1.0f;
-								}
-							}
-							// 월드 공간으로 변환
-							HitNormal = ShapeTransform.ToMatrix().TransformVector(HitNormal);
-							HitNormal.Normalize();
-						}
-					}
-					break;
+	if (TestParticles.IsEmpty())
+	{
+		return;
+	}
 
-				case EShapeKind::Sphere:
-					{
-						FVector SphereCenter = ShapeTransform.Translation;
-						float SphereRadius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(ShapeTransform.Scale3D);
-						float Dist = FVector::Distance(ParticleSphere.Center, SphereCenter);
-						bCollided = (Dist < (ParticleSphere.Radius + SphereRadius));
-						if (bCollided)
-						{
-							HitNormal = (ParticleSphere.Center - SphereCenter);
-							HitNormal.Normalize();
-						}
-					}
-					break;
+	// 2. 광역 검사: 이미터당 BVH 쿼리 한 번 (ShapeComponent + StaticMeshComponent 포함)
+	FAABB SweepBounds;
+	SweepBounds.Min = SweepMin - FVector(ParticleRadius, ParticleRadius, ParticleRadius);
+	SweepBounds.Max = SweepMax + FVector(ParticleRadius, ParticleRadius, ParticleRadius);
 
-				case EShapeKind::Capsule:
-					{
-						// 캡슐 충돌 검사
-						FVector P0, P1;
-						float CapsuleRadius;
-						Collision::BuildCapsule(Shape, ShapeTransform, P0, P1, CapsuleRadius);
+	TFrameArray<UPrimitiveComponent*> Candidates;
+	BVH->QueryIntersectedComponents(SweepBounds, Candidates);
+	if (Candidates.IsEmpty())
+	{
+		return;
+	}
 
-						// 파티클 위치에서 캡슐 중심선까지의 최단 거리
-						FVector CapsuleDir = P1 - P0;
-						float CapsuleLen = CapsuleDir.Size();
-						if (CapsuleLen > KINDA_SMALL_NUMBER)
-						{
-							CapsuleDir /= CapsuleLen;
-						}
+	FParticleColliderSet ColliderSet;
+	BuildColliderSet(Candidates, ParticleRadius, ColliderSet);
+	if (ColliderSet.Colliders.IsEmpty())
+	{
+		return;
+	}
 
-						FVector ToParticle = ParticleSphere.Center - P0;
-						float Projection = FMath::Clamp(FVector::Dot(ToParticle, CapsuleDir), 0.0f, CapsuleLen);
-						FVector ClosestPoint = P0 + CapsuleDir * Projection;
+	// 3. 정밀 검사: 파티클 구체(현재 위치)를 후보 4개씩 SIMD로 검사, 한 프레임에 표면이 가장 가까운 충돌 하나만 처리
+	const uint8* ParticleData = Context.Owner.ParticleData;
+	const uint32 ParticleStride = Context.Owner.ParticleStride;
+	const int32 Offset = Context.Offset;
 
-						float Dist = FVector::Distance(ParticleSphere.Center, ClosestPoint);
-						bCollided = (Dist < (ParticleSphere.Radius + CapsuleRadius));
-						if (bCollided)
-						{
-							HitNormal = (ParticleSphere.Center - ClosestPoint);
-							HitNormal.Normalize();
-						}
-					}
-					break;
-				}
-			}
-			// 2. StaticMeshComponent인 경우 - AABB 기반 충돌
-			else if (UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(PrimComp))
-			{
-				FAABB MeshAABB = MeshComp->GetWorldAABB();
+	for (const int32 ParticleIndex : TestParticles)
+	{
+		const uint8* ParticleBase = ParticleData + ParticleIndex * ParticleStride;
+		FBaseParticle& Particle = *((FBaseParticle*)ParticleBase);
 
-				// 파티클 구체와 AABB 충돌 검사
-				FVector ClosestPoint;
-				ClosestPoint.X = FMath::Clamp(ParticleSphere.Center.X, MeshAABB.Min.X, MeshAABB.Max.X);
-				ClosestPoint.Y = FMath::Clamp(ParticleSphere.Center.Y, MeshAABB.Min.Y, MeshAABB.Max.Y);
-				ClosestPoint.Z = FMath::Clamp(ParticleSphere.Center.Z, MeshAABB.Min.Z, MeshAABB.Max.Z);
+		const int32 HitIndex = ColliderSet.FindNearestHit(Particle.Location, ParticleRadius);
+		if (HitIndex < 0)
+		{
+			continue;
+		}
 
-				float DistSq = FVector::DistSquared(ParticleSphere.Center, ClosestPoint);
-				bCollided = (DistSq < ParticleSphere.Radius * ParticleSphere.Radius);
+		uint32 CurrentOffset = Offset;
+		PARTICLE_ELEMENT(FParticleCollisionPayload, CollPayload);
 
-				if (bCollided)
-				{
-					// AABB 표면 법선 계산
-					HitNormal = ParticleSphere.Center - ClosestPoint;
-					if (HitNormal.SizeSquared() > KINDA_SMALL_NUMBER)
-					{
-						HitNormal.Normalize();
-					}
-					else
-					{
-						// 파티클이 AABB 내부에 있는 경우 - 위쪽으로 밀어냄
-						HitNormal = FVector(0.0f, 0.0f, 1.0f);
-					}
-				}
-			}
+		const FParticleCollider& Collider = ColliderSet.Colliders[HitIndex];
+		UPrimitiveComponent* PrimComp = Collider.Component;
+		const FVector HitNormal = ComputeHitNormal(Collider, Particle.Location);
 
-			if (bCollided)
+		// 충돌 이벤트 생성
+		if (bGenerateCollisionEvents)
+		{
+			// 컴포넌트 유효성 검사 (언리얼 방식)
+			if (PrimComp && !PrimComp->IsPendingDestroy())
 			{
-				// 충돌 이벤트 생성
-				if (bGenerateCollisionEvents && PSC)
+				AActor* Owner = PrimComp->GetOwner();
+				// 파괴 예정인 Actor는 null로 처리
+				if (Owner && Owner->IsPendingDestroy())
 				{
-					// 컴포넌트 유효성 검사 (언리얼 방식)
-					if (PrimComp && !PrimComp->IsPendingDestroy())
-					{
-						AActor* Owner = PrimComp->GetOwner();
-						// 파괴 예정인 Actor는 null로 처리
-						if (Owner && Owner->IsPendingDestroy())
-						{
-							Owner = nullptr;
-						}
-
-						FParticleEventCollideData Event;
-						Event.Type = EParticleEventType::Collision;
-						Event.EventName = CollisionEventName;  // 이벤트 이름 설정
-						Event.Position = Particle.Location;
-						Event.Velocity = Particle.Velocity;
-						Event.Normal = HitNormal;
-						Event.HitComponent = PrimComp;
-						Event.HitActor = Owner;
-						Event.EmitterTime = Context.Owner.EmitterTime;
-
-						PSC->AddCollisionEvent(Event);
-					}
+					Owner = nullptr;
 				}
 
-				// 충돌 위치 보정 (표면에서 약간 띄움)
-				Particle.Location += HitNormal * ParticleRadius * 0.1f;
+				FParticleEventCollideData Event;
+				Event.Type = EParticleEventType::Collision;
+				Event.EventName = CollisionEventName;  // 이벤트 이름 설정
+				Event.Position = Particle.Location;
+				Event.Velocity = Particle.Velocity;
+				Event.Normal = HitNormal;
+				Event.HitComponent = PrimComp;
+				Event.HitActor = Owner;
+				Event.EmitterTime = Context.Owner.EmitterTime;
+
+				Context.Owner.AddCollisionEvent(Event);
+			}
+		}
 
-				// 바운스 처리
-				ApplyDamping(Particle, CollPayload, HitNormal);
-				CollPayload.UsedCollisionCount++;
+		// 충돌 위치 보정 (표면에서 약간 띄움)
+		Particle.Location += HitNormal * ParticleRadius * 0.1f;
 
-				// 충돌 발생 플래그 설정
-				Particle.Flags |= STATE_Particle_CollisionHasOccurred;
+		// 바운스 처리
+		ApplyDamping(Particle, CollPayload, HitNormal);
+		CollPayload.UsedCollisionCount++;
 
-				break;  // 한 프레임에 하나의 충돌만 처리
-			}
-		}
-	END_UPDATE_LOOP
+		// 충돌 발생 플래그 설정
+		Particle.Flags |= STATE_Particle_CollisionHasOccurred;
+	}
 }
 
 void UParticleModuleCollision::HandleCollisionComplete(FBaseParticle& Particle, FParticleCollisionPayload& Payload)
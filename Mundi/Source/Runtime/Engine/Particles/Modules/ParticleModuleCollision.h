@@ -74,6 +74,9 @@ public:
 	// 매 프레임 충돌 검사
 	virtual void Update(FModuleUpdateContext& Context) override;
 
+	// 월드 BVH와 다른 컴포넌트의 트랜스폼을 조회하므로 게임 스레드 전용
+	virtual bool CanUpdateOnWorkerThread() const override { return false; }
+
 	// 직렬화
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
@@ -119,6 +119,105 @@ void UParticleModuleColor::Update(FModuleUpdateContext& Context)
 	END_UPDATE_LOOP
 }
 
+// SoA 레이아웃: RGB/Alpha 보간을 4개씩 처리 (커브는 레인별 평가)
+void UParticleModuleColor::UpdateSoA(FModuleSoAUpdateContext& Context)
+{
+	const EDistributionType RGBDistType = ColorOverLife.RGB.Type;
+	const EDistributionType AlphaDistType = ColorOverLife.Alpha.Type;
+	const FDistributionVector& RGBDist = ColorOverLife.RGB;
+	const FDistributionFloat& AlphaDist = ColorOverLife.Alpha;
+
+	FParticleSoAData& Particles = Context.Particles;
+	const int32 Capacity = Particles.Capacity;
+	float* ColorR = PARTICLE_SOA_STREAM(Particles, Color);
+	float* ColorG = ColorR + Capacity;
+	float* ColorB = ColorG + Capacity;
+	float* ColorA = ColorB + Capacity;
+	const float* RelativeTime = PARTICLE_SOA_STREAM(Particles, RelativeTime);
+	const float* RandR = Particles.GetStream(Context.Offset + static_cast<int32>(offsetof(FParticleColorPayload, RGBRandomFactor)));
+	const float* RandG = RandR + Capacity;
+	const float* RandB = RandG + Capacity;
+	const float* RandA = Particles.GetStream(Context.Offset + static_cast<int32>(offsetof(FParticleColorPayload, AlphaRandomFactor)));
+
+	const __m128 ConstR = _mm_set1_ps(RGBDist.ConstantValue.X);
+	const __m128 ConstG = _mm_set1_ps(RGBDist.ConstantValue.Y);
+	const __m128 ConstB = _mm_set1_ps(RGBDist.ConstantValue.Z);
+	const __m128 MinR = _mm_set1_ps(RGBDist.MinValue.X);
+	const __m128 MinG = _mm_set1_ps(RGBDist.MinValue.Y);
+	const __m128 MinB = _mm_set1_ps(RGBDist.MinValue.Z);
+	const __m128 MaxR = _mm_set1_ps(RGBDist.MaxValue.X);
+	const __m128 MaxG = _mm_set1_ps(RGBDist.MaxValue.Y);
+	const __m128 MaxB = _mm_set1_ps(RGBDist.MaxValue.Z);
+	const __m128 ConstA = _mm_set1_ps(AlphaDist.ConstantValue);
+	const __m128 MinA = _mm_set1_ps(AlphaDist.MinValue);
+	const __m128 MaxA = _mm_set1_ps(AlphaDist.MaxValue);
+
+	const int32 Packed = ParticleSoA::PackedCount(Context.NumParticles);
+	for (int32 i = 0; i < Packed; i += 4)
+	{
+		__m128 R, G, B, A;
+
+		// RGB 처리
+		switch (RGBDistType)
+		{
+		case EDistributionType::ConstantCurve:
+			ParticleSoA::EvalVectorCurve4(RGBDist.ConstantCurve, RelativeTime + i, R, G, B);
+			break;
+
+		case EDistributionType::UniformCurve:
+			{
+				__m128 CurveMinR, CurveMinG, CurveMinB, CurveMaxR, CurveMaxG, CurveMaxB;
+				ParticleSoA::EvalVectorCurve4(RGBDist.MinCurve, RelativeTime + i, CurveMinR, CurveMinG, CurveMinB);
+				ParticleSoA::EvalVectorCurve4(RGBDist.MaxCurve, RelativeTime + i, CurveMaxR, CurveMaxG, CurveMaxB);
+				R = ParticleSoA::Lerp(CurveMinR, CurveMaxR, _mm_load_ps(RandR + i));
+				G = ParticleSoA::Lerp(CurveMinG, CurveMaxG, _mm_load_ps(RandG + i));
+				B = ParticleSoA::Lerp(CurveMinB, CurveMaxB, _mm_load_ps(RandB + i));
+			}
+			break;
+
+		case EDistributionType::Uniform:
+			R = ParticleSoA::Lerp(MinR, MaxR, _mm_load_ps(RandR + i));
+			G = ParticleSoA::Lerp(MinG, MaxG, _mm_load_ps(RandG + i));
+			B = ParticleSoA::Lerp(MinB, MaxB, _mm_load_ps(RandB + i));
+			break;
+
+		default:
+			R = ConstR;
+			G = ConstG;
+			B = ConstB;
+			break;
+		}
+
+		// Alpha 처리
+		switch (AlphaDistType)
+		{
+		case EDistributionType::ConstantCurve:
+			A = ParticleSoA::EvalFloatCurve4(AlphaDist.ConstantCurve, RelativeTime + i);
+			break;
+
+		case EDistributionType::UniformCurve:
+			A = ParticleSoA::Lerp(
+				ParticleSoA::EvalFloatCurve4(AlphaDist.MinCurve, RelativeTime + i),
+				ParticleSoA::EvalFloatCurve4(AlphaDist.MaxCurve, RelativeTime + i),
+				_mm_load_ps(RandA + i));
+			break;
+
+		case EDistributionType::Uniform:
+			A = ParticleSoA::Lerp(MinA, MaxA, _mm_load_ps(RandA + i));
+			break;
+
+		default:
+			A = ConstA;
+			break;
+		}
+
+		_mm_store_ps(ColorR + i, R);
+		_mm_store_ps(ColorG + i, G);
+		_mm_store_ps(ColorB + i, B);
+		_mm_store_ps(ColorA + i, A);
+	}
+}
+
 void UParticleModuleColor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	UParticleModule::Serialize(bInIsLoading, InOutHandle);
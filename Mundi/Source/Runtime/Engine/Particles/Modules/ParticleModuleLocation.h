@@ -68,6 +68,9 @@ public:
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
+	// 스폰 전용 모듈
+	virtual bool SupportsSoALayout() const override { return true; }
+
 private:
 	// 분포 형태별 랜덤 위치 생성 (RandomStream 사용)
 	FVector GenerateRandomLocationBox(FParticleRandomStream& RandomStream, const FVector& Extent);
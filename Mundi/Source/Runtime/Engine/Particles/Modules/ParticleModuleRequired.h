@@ -32,6 +32,12 @@ public:
 	UPROPERTY(EditAnywhere, Category="Required")
 	int32 SortMode = 0;
 
+	// 파티클을 필드별 스트림(SoA)으로 저장하고 SIMD 커널로 업데이트합니다.
+	// 이미터의 모든 모듈이 SoA를 지원할 때만 적용되고, 아니면 기존 AoS 경로로 동작합니다.
+	// 다른 이미터의 TrailSource가 이 이미터를 추적하는 경우에도 AoS로 남습니다.
+	UPROPERTY(EditAnywhere, Category="Required")
+	bool bUseSoALayout = false;
+
 	// 언리얼 엔진 호환: 이미터 원점 (파티클 스폰 위치 오프셋)
 	UPROPERTY(EditAnywhere, Category="Emitter")
 	FVector EmitterOrigin = FVector(0.0f, 0.0f, 0.0f);
@@ -103,4 +109,6 @@ public:
 
 	// Required는 두 번째로 표시 (우선순위 1)
 	virtual int32 GetDisplayPriority() const override { return 1; }
+
+	virtual bool SupportsSoALayout() const override { return true; }
 };
@@ -100,6 +100,72 @@ void UParticleModuleSize::Update(FModuleUpdateContext& Context)
 	END_UPDATE_LOOP
 }
 
+// SoA 레이아웃: 크기 보간/스케일/최소값 클램프를 4개씩 처리 (커브는 레인별 평가)
+void UParticleModuleSize::UpdateSoA(FModuleSoAUpdateContext& Context)
+{
+	const EDistributionType DistType = SizeOverLife.Type;
+	const float ComponentScaleX = Context.Owner.Component->GetWorldScale().X;
+
+	FParticleSoAData& Particles = Context.Particles;
+	const int32 Capacity = Particles.Capacity;
+	float* SizeX = PARTICLE_SOA_STREAM(Particles, Size);
+	const float* RelativeTime = PARTICLE_SOA_STREAM(Particles, RelativeTime);
+	const float* RandX = Particles.GetStream(Context.Offset + static_cast<int32>(offsetof(FParticleSizePayload, RandomFactor)));
+
+	const __m128 Scale = _mm_set1_ps(ComponentScaleX);
+	const __m128 MinSize = _mm_set1_ps(0.01f);
+	const __m128 ConstX = _mm_set1_ps(SizeOverLife.ConstantValue.X);
+	const __m128 ConstY = _mm_set1_ps(SizeOverLife.ConstantValue.Y);
+	const __m128 ConstZ = _mm_set1_ps(SizeOverLife.ConstantValue.Z);
+	const __m128 MinX = _mm_set1_ps(SizeOverLife.MinValue.X);
+	const __m128 MinY = _mm_set1_ps(SizeOverLife.MinValue.Y);
+	const __m128 MinZ = _mm_set1_ps(SizeOverLife.MinValue.Z);
+	const __m128 MaxX = _mm_set1_ps(SizeOverLife.MaxValue.X);
+	const __m128 MaxY = _mm_set1_ps(SizeOverLife.MaxValue.Y);
+	const __m128 MaxZ = _mm_set1_ps(SizeOverLife.MaxValue.Z);
+
+	const int32 Packed = ParticleSoA::PackedCount(Context.NumParticles);
+	for (int32 i = 0; i < Packed; i += 4)
+	{
+		__m128 X, Y, Z;
+
+		switch (DistType)
+		{
+		case EDistributionType::ConstantCurve:
+			ParticleSoA::EvalVectorCurve4(SizeOverLife.ConstantCurve, RelativeTime + i, X, Y, Z);
+			break;
+
+		case EDistributionType::UniformCurve:
+			{
+				__m128 CurveMinX, CurveMinY, CurveMinZ, CurveMaxX, CurveMaxY, CurveMaxZ;
+				ParticleSoA::EvalVectorCurve4(SizeOverLife.MinCurve, RelativeTime + i, CurveMinX, CurveMinY, CurveMinZ);
+				ParticleSoA::EvalVectorCurve4(SizeOverLife.MaxCurve, RelativeTime + i, CurveMaxX, CurveMaxY, CurveMaxZ);
+				X = ParticleSoA::Lerp(CurveMinX, CurveMaxX, _mm_load_ps(RandX + i));
+				Y = ParticleSoA::Lerp(CurveMinY, CurveMaxY, _mm_load_ps(RandX + Capacity + i));
+				Z = ParticleSoA::Lerp(CurveMinZ, CurveMaxZ, _mm_load_ps(RandX + 2 * Capacity + i));
+			}
+			break;
+
+		case EDistributionType::Uniform:
+			X = ParticleSoA::Lerp(MinX, MaxX, _mm_load_ps(RandX + i));
+			Y = ParticleSoA::Lerp(MinY, MaxY, _mm_load_ps(RandX + Capacity + i));
+			Z = ParticleSoA::Lerp(MinZ, MaxZ, _mm_load_ps(RandX + 2 * Capacity + i));
+			break;
+
+		default:
+			X = ConstX;
+			Y = ConstY;
+			Z = ConstZ;
+			break;
+		}
+
+		// 컴포넌트 스케일 적용 후 음수 크기 방지
+		_mm_store_ps(SizeX + i, _mm_max_ps(_mm_mul_ps(X, Scale), MinSize));
+		_mm_store_ps(SizeX + Capacity + i, _mm_max_ps(_mm_mul_ps(Y, Scale), MinSize));
+		_mm_store_ps(SizeX + 2 * Capacity + i, _mm_max_ps(_mm_mul_ps(Z, Scale), MinSize));
+	}
+}
+
 void UParticleModuleSize::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	UParticleModule::Serialize(bInIsLoading, InOutHandle);
@@ -36,5 +36,8 @@ public:
 
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void Update(FModuleUpdateContext& Context) override;
+
+	virtual bool SupportsSoALayout() const override { return true; }
+	virtual void UpdateSoA(FModuleSoAUpdateContext& Context) override;
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 };
@@ -46,6 +46,8 @@ public:
 	// Spawn은 세 번째로 표시 (우선순위 2)
 	virtual int32 GetDisplayPriority() const override { return 2; }
 
+	virtual bool SupportsSoALayout() const override { return true; }
+
 	// LOD 스케일링: SpawnRate와 BurstCount를 Multiplier로 스케일
 	virtual void ScaleForLOD(float Multiplier) override
 	{
@@ -52,6 +52,9 @@ public:
 	// 표시 우선순위 (Spawn 다음)
 	virtual int32 GetDisplayPriority() const override { return 10; }
 
+	// 같은 컴포넌트의 소스 이미터 파티클을 읽고 LastSpawnPositions(템플릿 공유)를 갱신하므로 게임 스레드 전용
+	virtual bool CanUpdateOnWorkerThread() const override { return false; }
+
 private:
 	// 마지막으로 Trail 파티클을 생성한 위치 (소스 파티클별로 추적)
 	// Key: 소스 파티클 포인터, Value: 마지막 생성 위치
@@ -14,4 +14,6 @@ public:
 	virtual ~UParticleModuleTypeDataSprite() = default;
 
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+
+	virtual bool SupportsSoALayout() const override { return true; }
 };
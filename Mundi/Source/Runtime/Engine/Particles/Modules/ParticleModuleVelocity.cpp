@@ -73,6 +73,47 @@ void UParticleModuleVelocity::Update(FModuleUpdateContext& Context)
 	END_UPDATE_LOOP
 }
 
+// SoA 레이아웃: 감쇠 계수가 파티클과 무관하므로 그대로 4개씩 곱한다
+void UParticleModuleVelocity::UpdateSoA(FModuleSoAUpdateContext& Context)
+{
+	if (VelocityDamping <= 0.0f)
+	{
+		return;
+	}
+
+	float DampingFactor = 1.0f - (VelocityDamping * Context.DeltaTime);
+	if (DampingFactor < 0.0f)
+	{
+		DampingFactor = 0.0f;
+	}
+
+	FParticleSoAData& Particles = Context.Particles;
+	const int32 Capacity = Particles.Capacity;
+	float* VelX = PARTICLE_SOA_STREAM(Particles, Velocity);
+	float* BaseVelX = PARTICLE_SOA_STREAM(Particles, BaseVelocity);
+	float* Magnitude = Particles.GetStream(Context.Offset + static_cast<int32>(offsetof(FParticleVelocityPayload, VelocityMagnitude)));
+
+	const __m128 Damping = _mm_set1_ps(DampingFactor);
+	const int32 Packed = ParticleSoA::PackedCount(Context.NumParticles);
+	for (int32 i = 0; i < Packed; i += 4)
+	{
+		const __m128 VX = _mm_mul_ps(_mm_load_ps(VelX + i), Damping);
+		const __m128 VY = _mm_mul_ps(_mm_load_ps(VelX + Capacity + i), Damping);
+		const __m128 VZ = _mm_mul_ps(_mm_load_ps(VelX + 2 * Capacity + i), Damping);
+		_mm_store_ps(VelX + i, VX);
+		_mm_store_ps(VelX + Capacity + i, VY);
+		_mm_store_ps(VelX + 2 * Capacity + i, VZ);
+
+		_mm_store_ps(BaseVelX + i, _mm_mul_ps(_mm_load_ps(BaseVelX + i), Damping));
+		_mm_store_ps(BaseVelX + Capacity + i, _mm_mul_ps(_mm_load_ps(BaseVelX + Capacity + i), Damping));
+		_mm_store_ps(BaseVelX + 2 * Capacity + i, _mm_mul_ps(_mm_load_ps(BaseVelX + 2 * Capacity + i), Damping));
+
+		// 페이로드에 현재 속도 크기 업데이트
+		const __m128 LengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(VX, VX), _mm_mul_ps(VY, VY)), _mm_mul_ps(VZ, VZ));
+		_mm_store_ps(Magnitude + i, _mm_sqrt_ps(LengthSquared));
+	}
+}
+
 void UParticleModuleVelocity::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	UParticleModule::Serialize(bInIsLoading, InOutHandle);
@@ -31,4 +31,7 @@ public:
     virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
     virtual uint32 RequiredBytes(FParticleEmitterInstance* Owner) override;
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+
+    // 스폰 전용 모듈
+    virtual bool SupportsSoALayout() const override { return true; }
 };
@@ -0,0 +1,434 @@
+﻿#include "pch.h"
+#include "Benchmark.h"
+#include "ParticleSystem.h"
+#include "ParticleEmitter.h"
+#include "ParticleLODLevel.h"
+#include "ParticleEmitterInstance.h"
+#include "ParticleSystemComponent.h"
+#include "ObjectFactory.h"
+#include "Modules/ParticleModuleRequired.h"
+#include "Modules/ParticleModuleSpawn.h"
+#include "Modules/ParticleModuleLifetime.h"
+#include "Modules/ParticleModuleVelocity.h"
+#include "Modules/ParticleModuleAcceleration.h"
+#include "Modules/ParticleModuleColor.h"
+#include "Modules/ParticleModuleSize.h"
+#include "Modules/ParticleModuleTrailSource.h"
+#include "Modules/ParticleColliderSet.h"
+
+// 파티클 레이아웃 벤치마크 (콘솔: BENCH PARTICLESOA)
+// 같은 모듈 구성의 이미터를 AoS/SoA로 각각 만들어 실제 FParticleEmitterInstance::UpdateParticles 경로를 잰다.
+// 이미터당 파티클은 Resize 하드 리밋(1000)으로 묶여 있으므로 10K 이상은 1000개짜리 인스턴스를 여러 개 돌린다.
+// 측정 전에 SoA를 요청한 이미터를 TrailSource가 추적해도 트레일이 생성되는지 확인한다.
+//
+// 파티클 충돌 컬라이더 검사 (콘솔: BENCH PARTICLECOLLISION)
+// FParticleColliderSet의 빈 레인이 맞지 않는지, 여러 컬라이더가 겹칠 때 표면이 가장 가까운 것을 고르는지 확인하고 쿼리 속도를 잰다.
+
+namespace
+{
+	constexpr int32 ParticlesPerInstance = 1000;
+	constexpr int32 NumFrames = 60;
+	constexpr float FrameDeltaTime = 1.0f / 60.0f;
+
+	// 벤치마크 전용 컴포넌트 스코프
+	// Template(bOwnsTemplate)과 EmitterInstances의 소유권을 컴포넌트에 넘겨, 스코프를 벗어나면
+	// 컴포넌트 소멸자가 인스턴스와 시스템(이미터 → LOD → 모듈)을 함께 해제한다
+	class FScopedBenchmarkComponent
+	{
+	public:
+		explicit FScopedBenchmarkComponent(UParticleSystem* System)
+			: Component(NewObject<UParticleSystemComponent>())
+		{
+			Component->Template = System;
+			Component->bOwnsTemplate = true;
+		}
+
+		~FScopedBenchmarkComponent()
+		{
+			DeleteObject(Component);
+		}
+
+		FScopedBenchmarkComponent(const FScopedBenchmarkComponent&) = delete;
+		FScopedBenchmarkComponent& operator=(const FScopedBenchmarkComponent&) = delete;
+
+		FParticleEmitterInstance* AddInstance(int32 EmitterIndex)
+		{
+			FParticleEmitterInstance* Instance = new FParticleEmitterInstance();
+			Component->EmitterInstances.Add(Instance);
+			Instance->Init(Component, Component->Template->Emitters[EmitterIndex]);
+			return Instance;
+		}
+
+		UParticleSystemComponent* Get() const { return Component; }
+		const TArray<FParticleEmitterInstance*>& GetInstances() const { return Component->EmitterInstances; }
+
+	private:
+		UParticleSystemComponent* Component;
+	};
+
+	// Velocity 감쇠 + 중력 가속도 + 균등 분포 색/크기 (수명 0.5~2초라 60프레임 동안 일부가 죽는다)
+	UParticleSystem* CreateBenchmarkSystem(bool bUseSoALayout)
+	{
+		UParticleSystem* System = NewObject<UParticleSystem>();
+		UParticleEmitter* Emitter = NewObject<UParticleEmitter>();
+		UParticleLODLevel* LODLevel = NewObject<UParticleLODLevel>();
+		LODLevel->bEnabled = true;
+
+		UParticleModuleRequired* RequiredModule = NewObject<UParticleModuleRequired>();
+		RequiredModule->bUseSoALayout = bUseSoALayout;
+		LODLevel->Modules.Add(RequiredModule);
+
+		// 스폰은 직접 하므로 연속 스폰 없음
+		UParticleModuleSpawn* SpawnModule = NewObject<UParticleModuleSpawn>();
+		SpawnModule->SpawnRate = FDistributionFloat(0.0f);
+		LODLevel->Modules.Add(SpawnModule);
+
+		UParticleModuleLifetime* LifetimeModule = NewObject<UParticleModuleLifetime>();
+		LifetimeModule->Lifetime = FDistributionFloat(0.5f, 2.0f);
+		LODLevel->Modules.Add(LifetimeModule);
+
+		UParticleModuleVelocity* VelocityModule = NewObject<UParticleModuleVelocity>();
+		VelocityModule->StartVelocity = FDistributionVector(FVector(-5.0f, -5.0f, 10.0f), FVector(5.0f, 5.0f, 20.0f));
+		VelocityModule->VelocityDamping = 0.3f;
+		LODLevel->Modules.Add(VelocityModule);
+
+		UParticleModuleAcceleration* AccelerationModule = NewObject<UParticleModuleAcceleration>();
+		AccelerationModule->AccelerationOverLife = FDistributionVector(FVector(1.0f, 0.0f, 0.0f));
+		AccelerationModule->bApplyGravity = true;
+		LODLevel->Modules.Add(AccelerationModule);
+
+		UParticleModuleColor* ColorModule = NewObject<UParticleModuleColor>();
+		ColorModule->ColorOverLife = FDistributionColor(FLinearColor(0.2f, 0.2f, 0.2f, 1.0f), FLinearColor(1.0f, 1.0f, 1.0f, 1.0f));
+		LODLevel->Modules.Add(ColorModule);
+
+		UParticleModuleSize* SizeModule = NewObject<UParticleModuleSize>();
+		SizeModule->SizeOverLife = FDistributionVector(FVector(0.5f, 0.5f, 0.5f), FVector(2.0f, 2.0f, 2.0f));
+		LODLevel->Modules.Add(SizeModule);
+
+		LODLevel->CacheModuleInfo();
+		Emitter->LODLevels.Add(LODLevel);
+		Emitter->CacheEmitterModuleInfo();
+		System->Emitters.Add(Emitter);
+		return System;
+	}
+
+	// 소스 이미터(SoA 요청) + 그 파티클을 따라가는 TrailSource 이미터
+	UParticleSystem* CreateTrailCheckSystem()
+	{
+		UParticleSystem* System = NewObject<UParticleSystem>();
+
+		auto AddEmitter = [System](std::initializer_list<UParticleModule*> Modules)
+		{
+			UParticleEmitter* Emitter = NewObject<UParticleEmitter>();
+			UParticleLODLevel* LODLevel = NewObject<UParticleLODLevel>();
+			LODLevel->bEnabled = true;
+			for (UParticleModule* Module : Modules)
+			{
+				LODLevel->Modules.Add(Module);
+			}
+			LODLevel->CacheModuleInfo();
+			Emitter->LODLevels.Add(LODLevel);
+			Emitter->CacheEmitterModuleInfo();
+			System->Emitters.Add(Emitter);
+		};
+
+		auto CreateSpawnModule = []()
+		{
+			UParticleModuleSpawn* SpawnModule = NewObject<UParticleModuleSpawn>();
+			SpawnModule->SpawnRate = FDistributionFloat(0.0f);
+			return SpawnModule;
+		};
+
+		auto CreateLifetimeModule = []()
+		{
+			UParticleModuleLifetime* LifetimeModule = NewObject<UParticleModuleLifetime>();
+			LifetimeModule->Lifetime = FDistributionFloat(10.0f);
+			return LifetimeModule;
+		};
+
+		UParticleModuleRequired* SourceRequired = NewObject<UParticleModuleRequired>();
+		SourceRequired->EmitterName = "TrailCheckSource";
+		SourceRequired->bUseSoALayout = true;
+		UParticleModuleVelocity* SourceVelocity = NewObject<UParticleModuleVelocity>();
+		SourceVelocity->StartVelocity = FDistributionVector(FVector(10.0f, 0.0f, 0.0f));
+		AddEmitter({ SourceRequired, CreateSpawnModule(), CreateLifetimeModule(), SourceVelocity });
+
+		UParticleModuleRequired* TrailRequired = NewObject<UParticleModuleRequired>();
+		TrailRequired->EmitterName = "TrailCheckTrail";
+		UParticleModuleTrailSource* TrailSource = NewObject<UParticleModuleTrailSource>();
+		TrailSource->SourceName = "TrailCheckSource";
+		TrailSource->bInheritSourceVelocity = true;
+		AddEmitter({ TrailRequired, CreateSpawnModule(), CreateLifetimeModule(), TrailSource });
+
+		return System;
+	}
+
+	// 트레일은 처음 보는 소스 파티클마다 하나씩 바로 생성되어야 한다
+	void RunTrailFromSoASourceCheck()
+	{
+		constexpr int32 NumSourceParticles = 16;
+
+		FScopedBenchmarkComponent Scope(CreateTrailCheckSystem());
+		FParticleEmitterInstance* Source = Scope.AddInstance(0);
+		FParticleEmitterInstance* Trail = Scope.AddInstance(1);
+
+		Source->SpawnParticles(NumSourceParticles, 0.0f, 0.0f, FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 0.0f));
+		// 업데이트 모듈은 살아있는 파티클이 있어야 돌므로 트레일 이미터에 시드 파티클 하나를 둔다
+		Trail->SpawnParticles(1, 0.0f, 0.0f, FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 0.0f));
+
+		Source->UpdateParticles(FrameDeltaTime);
+		Trail->UpdateParticles(FrameDeltaTime);
+
+		const int32 NumTrailSpawned = Trail->ActiveParticles - 1;
+		UE_LOG("[Benchmark] trail from a SoA-requested source: source layout %s, %d/%d trail particles spawned%s",
+			Source->bUseSoALayout ? "SoA" : "AoS", NumTrailSpawned, NumSourceParticles,
+			NumTrailSpawned == NumSourceParticles ? "" : " FAILED");
+	}
+
+	struct FLayoutResult
+	{
+		double FrameMS = 0.0;	// 프레임당 (모든 인스턴스 UpdateParticles 합)
+		int32 NumAlive = 0;
+		double LocationSum = 0.0;
+		bool bUsedSoA = false;
+	};
+
+	FLayoutResult RunLayout(bool bUseSoALayout, int32 NumParticles, int32 Repeats)
+	{
+		FLayoutResult Result;
+		FScopedBenchmarkComponent Scope(CreateBenchmarkSystem(bUseSoALayout));
+		UParticleEmitter* Emitter = Scope.Get()->Template->Emitters[0];
+
+		const int32 NumInstances = FMath::Max(1, NumParticles / ParticlesPerInstance);
+		for (int32 i = 0; i < NumInstances; ++i)
+		{
+			Scope.AddInstance(0);
+		}
+		const TArray<FParticleEmitterInstance*>& Instances = Scope.GetInstances();
+
+		double BestMS = std::numeric_limits<double>::max();
+		for (int32 Repeat = 0; Repeat < Repeats; ++Repeat)
+		{
+			// 매 반복 같은 시드로 재초기화 (Init이 버퍼는 유지하고 파티클만 비운다)
+			for (FParticleEmitterInstance* Instance : Instances)
+			{
+				Instance->Init(Scope.Get(), Emitter);
+				Instance->RandomStream.Initialize(0);
+				Instance->SpawnParticles(FMath::Min(NumParticles, ParticlesPerInstance), 0.0f, 0.0f, FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 0.0f));
+			}
+
+			const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				for (FParticleEmitterInstance* Instance : Instances)
+				{
+					Instance->UpdateParticles(FrameDeltaTime);
+				}
+			}
+			const double ElapsedMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - StartCycles);
+			BestMS = FMath::Min(BestMS, ElapsedMS);
+		}
+		Result.FrameMS = BestMS / NumFrames;
+
+		// 두 레이아웃 결과 비교용 (살아남은 순서까지 같으면 합도 비트 단위로 같다)
+		for (FParticleEmitterInstance* Instance : Instances)
+		{
+			Result.bUsedSoA = Instance->bUseSoALayout;
+			Result.NumAlive += Instance->ActiveParticles;
+			for (int32 i = 0; i < Instance->ActiveParticles; ++i)
+			{
+				const FVector Location = Instance->GetParticleLocation(i);
+				Result.LocationSum += static_cast<double>(Location.X) + Location.Y + Location.Z;
+			}
+		}
+		return Result;
+	}
+
+	void RunParticleSoABenchmark()
+	{
+		RunTrailFromSoASourceCheck();
+
+		UE_LOG("[Benchmark] %d frames, ms per frame, %d particles per emitter instance", NumFrames, ParticlesPerInstance);
+		for (int32 NumParticles : { 1000, 10000, 100000, 1000000 })
+		{
+			const int32 Repeats = NumParticles >= 1000000 ? 1 : 3;
+			const FLayoutResult AoS = RunLayout(false, NumParticles, Repeats);
+			const FLayoutResult SoA = RunLayout(true, NumParticles, Repeats);
+
+			UE_LOG("[Benchmark] %8d particles: AoS %9.3f  SoA %9.3f  (%.1fx), alive %d/%d%s%s",
+				NumParticles, AoS.FrameMS, SoA.FrameMS, AoS.FrameMS / SoA.FrameMS, AoS.NumAlive, SoA.NumAlive,
+				SoA.bUsedSoA ? "" : " (SoA layout was not enabled)",
+				(AoS.NumAlive == SoA.NumAlive && AoS.LocationSum == SoA.LocationSum) ? "" : " RESULT MISMATCH");
+		}
+	}
+}
+
+REGISTER_BENCHMARK("PARTICLESOA", "AoS vs SoA particle update (Velocity, Acceleration, Color, Size) at 1K-1M particles", RunParticleSoABenchmark)
+
+namespace
+{
+	constexpr float CollisionParticleRadius = 0.5f;
+
+	FParticleCollider MakeBoxCollider(const FVector& Center, float HalfExtent)
+	{
+		FParticleCollider Box;
+		Box.Kind = EParticleColliderKind::Box;
+		Box.Center = Center;
+		Box.Axes[0] = FVector(1.0f, 0.0f, 0.0f);
+		Box.Axes[1] = FVector(0.0f, 1.0f, 0.0f);
+		Box.Axes[2] = FVector(0.0f, 0.0f, 1.0f);
+		Box.HalfExtent[0] = Box.HalfExtent[1] = Box.HalfExtent[2] = HalfExtent;
+		return Box;
+	}
+
+	FParticleCollider MakeSphereCollider(const FVector& Center, float Radius)
+	{
+		FParticleCollider Sphere;
+		Sphere.Kind = EParticleColliderKind::Sphere;
+		Sphere.Center = Center;
+		Sphere.Radius = Radius;
+		return Sphere;
+	}
+
+	FParticleCollider MakeCapsuleCollider(const FVector& P0, const FVector& Direction, float Length, float Radius)
+	{
+		FParticleCollider Capsule;
+		Capsule.Kind = EParticleColliderKind::Capsule;
+		Capsule.Center = P0;
+		Capsule.Axes[0] = Direction;
+		Capsule.HalfExtent[0] = Length;
+		Capsule.Radius = Radius;
+		return Capsule;
+	}
+
+	struct FColliderCheck
+	{
+		int32 NumFailures = 0;
+
+		void Expect(const FParticleColliderSet& Set, const FVector& Location, int32 Expected, const char* What)
+		{
+			const int32 Hit = Set.FindNearestHit(Location, CollisionParticleRadius);
+			if (Hit != Expected)
+			{
+				UE_LOG("[Benchmark] FAILED: %s: expected %d, got %d", What, Expected, Hit);
+				++NumFailures;
+			}
+		}
+	};
+
+	// 박스 1~3개면 첫 묶음에 빈 레인이 3~1개 남는다
+	// 거리 검사만으로도 빈 레인은 어떤 현실적인 반지름에도 닿지 않아야 하고, 빈 레인 좌표에 놓인 파티클도 맞으면 안 된다
+	void CheckEmptyBoxLanes(FColliderCheck& Check)
+	{
+		for (int32 NumBoxes = 1; NumBoxes <= 3; ++NumBoxes)
+		{
+			FParticleColliderSet Set;
+			for (int32 i = 0; i < NumBoxes; ++i)
+			{
+				Set.AddBox(MakeBoxCollider(FVector(10.0f * (i + 1), 0.0f, 0.0f), 1.0f));
+			}
+
+			const FParticleBoxPacket& Packet = Set.Boxes[0];
+			for (const FVector& Location : { FVector(0.0f, 0.0f, 0.0f), FVector(10.0f, 0.0f, 0.0f), FVector(-1.0e6f, 1.0e6f, 0.0f) })
+			{
+				alignas(16) float DistSq[4];
+				_mm_store_ps(DistSq, FParticleColliderSet::BoxDistanceSq(Packet,
+					_mm_set1_ps(Location.X), _mm_set1_ps(Location.Y), _mm_set1_ps(Location.Z)));
+				for (int32 Lane = NumBoxes; Lane < 4; ++Lane)
+				{
+					if (Packet.Collider[Lane] != -1 || !(DistSq[Lane] > 1.0e30f))
+					{
+						UE_LOG("[Benchmark] FAILED: %d boxes, empty lane %d is %.3g from (%.0f, %.0f, %.0f)",
+							NumBoxes, Lane, std::sqrt(DistSq[Lane]), Location.X, Location.Y, Location.Z);
+						++Check.NumFailures;
+					}
+				}
+			}
+
+			const float Far = FParticleColliderSet::EmptyLaneCoord;
+			Check.Expect(Set, FVector(Far, Far, Far), -1, "particle at the empty lane coordinate");
+			Check.Expect(Set, FVector(0.0f, 0.0f, 0.0f), -1, "particle away from every box");
+			for (int32 i = 0; i < NumBoxes; ++i)
+			{
+				Check.Expect(Set, FVector(10.0f * (i + 1), 0.0f, 0.0f), i, "particle in a box");
+			}
+		}
+
+		// 거리 마스크에 빈 레인이 섞여 더 가까워 보여도 실제 컬라이더를 고른다
+		const int32 LaneColliders[4] = { -1, 2, -1, -1 };
+		int32 Best = INT32_MAX;
+		float BestDistance = FLT_MAX;
+		FParticleColliderSet::SelectNearestHit(0xF, LaneColliders, _mm_setr_ps(-5.0f, 1.0f, -5.0f, -5.0f), Best, BestDistance);
+		if (Best != 2)
+		{
+			UE_LOG("[Benchmark] FAILED: SelectNearestHit picked %d instead of the only real lane (2)", Best);
+			++Check.NumFailures;
+		}
+	}
+
+	// 여러 컬라이더와 동시에 겹치면 후보 순서가 아니라 표면이 가장 가까운 컬라이더를 고른다
+	void CheckNearestHit(FColliderCheck& Check)
+	{
+		// 박스(0, 반크기 1) 옆에 구(1, 반지름 1): 두 표면 사이 간격 0.5
+		FParticleColliderSet BoxSphere;
+		BoxSphere.AddBox(MakeBoxCollider(FVector(0.0f, 0.0f, 0.0f), 1.0f));
+		BoxSphere.AddSphere(MakeSphereCollider(FVector(2.5f, 0.0f, 0.0f), 1.0f), CollisionParticleRadius);
+		Check.Expect(BoxSphere, FVector(1.1f, 0.0f, 0.0f), 0, "box surface 0.1, sphere surface 0.4");
+		Check.Expect(BoxSphere, FVector(1.4f, 0.0f, 0.0f), 1, "box surface 0.4, sphere surface 0.1");
+		Check.Expect(BoxSphere, FVector(0.0f, 0.0f, 0.0f), 0, "inside the box only");
+
+		// 같은 묶음 안의 박스 두 개 (간격 0.6)
+		FParticleColliderSet TwoBoxes;
+		TwoBoxes.AddBox(MakeBoxCollider(FVector(0.0f, 0.0f, 0.0f), 1.0f));
+		TwoBoxes.AddBox(MakeBoxCollider(FVector(2.6f, 0.0f, 0.0f), 1.0f));
+		Check.Expect(TwoBoxes, FVector(1.2f, 0.0f, 0.0f), 0, "first box 0.2, second box 0.4");
+		Check.Expect(TwoBoxes, FVector(1.4f, 0.0f, 0.0f), 1, "first box 0.4, second box 0.2");
+
+		// 같은 거리면 후보 순서가 앞선 쪽
+		FParticleColliderSet SameBoxes;
+		SameBoxes.AddBox(MakeBoxCollider(FVector(0.0f, 0.0f, 0.0f), 1.0f));
+		SameBoxes.AddBox(MakeBoxCollider(FVector(0.0f, 0.0f, 0.0f), 1.0f));
+		Check.Expect(SameBoxes, FVector(0.5f, 0.0f, 0.0f), 0, "two identical boxes");
+
+		// 구 두 개 묶음 + 캡슐: 다른 묶음, 다른 종류 사이에서도 가장 가까운 것
+		FParticleColliderSet Mixed;
+		Mixed.AddSphere(MakeSphereCollider(FVector(0.0f, 0.0f, 0.0f), 1.0f), CollisionParticleRadius);
+		Mixed.AddSphere(MakeSphereCollider(FVector(0.0f, 10.0f, 0.0f), 1.0f), CollisionParticleRadius);
+		Mixed.AddCapsule(MakeCapsuleCollider(FVector(2.1f, -1.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f), 2.0f, 0.5f), CollisionParticleRadius);
+		Check.Expect(Mixed, FVector(1.2f, 0.0f, 0.0f), 0, "sphere surface 0.2, capsule surface 0.4");
+		Check.Expect(Mixed, FVector(1.45f, 0.0f, 0.0f), 2, "sphere surface 0.45, capsule surface 0.15");
+		Check.Expect(Mixed, FVector(0.0f, 10.0f, 0.0f), 1, "inside the second sphere");
+	}
+
+	void RunParticleCollisionBenchmark()
+	{
+		FColliderCheck Check;
+		CheckEmptyBoxLanes(Check);
+		CheckNearestHit(Check);
+
+		// 박스 3개(빈 레인 하나) + 구 하나에 맞는/안 맞는 위치를 섞어 조회
+		FParticleColliderSet TimingSet;
+		for (int32 i = 0; i < 3; ++i)
+		{
+			TimingSet.AddBox(MakeBoxCollider(FVector(10.0f * (i + 1), 0.0f, 0.0f), 1.0f));
+		}
+		TimingSet.AddSphere(MakeSphereCollider(FVector(0.0f, 0.0f, 0.0f), 1.0f), CollisionParticleRadius);
+
+		constexpr int32 NumQueries = 1000000;
+		int32 NumHits = 0;
+		const double QueryMS = Benchmark::MeasureBestMS(3, [&]()
+		{
+			NumHits = 0;
+			for (int32 i = 0; i < NumQueries; ++i)
+			{
+				const FVector Location(static_cast<float>(i % 41) - 5.0f, static_cast<float>(i % 7) * 0.25f, 0.0f);
+				NumHits += TimingSet.FindNearestHit(Location, CollisionParticleRadius) >= 0 ? 1 : 0;
+			}
+		});
+
+		UE_LOG("[Benchmark] collider checks %s (%d failures), %d FindNearestHit queries (3 boxes + sphere): %.2f ms, %d hits",
+			Check.NumFailures == 0 ? "passed" : "FAILED", Check.NumFailures, NumQueries, QueryMS, NumHits);
+	}
+}
+
+REGISTER_BENCHMARK("PARTICLECOLLISION", "Particle collider checks (empty box lanes, nearest hit) and FindNearestHit throughput", RunParticleCollisionBenchmark)
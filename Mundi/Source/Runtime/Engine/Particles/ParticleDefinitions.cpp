@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include "ParticleDefinitions.h"
+#include "ParticleSort.h"
 
 // 언리얼 엔진 호환: 16바이트 정렬 메모리 할당
 // FMemory::Malloc(Size, 16) 방식과 동일하게 캐시 라인 최적화
@@ -10,7 +11,7 @@
 //   MemBlockSize = 20,000 + (100 * 2) = 20,200바이트
 //
 // 반환값: 할당 성공 시 true, 실패 시 false
-bool FParticleDataContainer::Alloc(int32 InParticleDataNumBytes, int32 InParticleIndicesNumShorts)
+bool FParticleDataContainer::Alloc(int32 InParticleDataNumBytes, int32 InParticleIndicesNumShorts, bool bFromFrameArena)
 {
 	// 기존 메모리 해제
 	Free();
@@ -23,6 +24,15 @@ bool FParticleDataContainer::Alloc(int32 InParticleDataNumBytes, int32 InParticl
 	// sizeof(uint16) = 2바이트
 	MemBlockSize = ParticleDataNumBytes + (ParticleIndicesNumShorts * sizeof(uint16));
 
+	if (MemBlockSize > 0 && bFromFrameArena)
+	{
+		// 프레임 아레나: 호출자가 전체를 덮어쓰므로 0 초기화 생략
+		ParticleData = static_cast<uint8*>(FFrameMemory::GetInstance().GetCurrentArena().Allocate(MemBlockSize, 16));
+		ParticleIndices = (uint16*)(ParticleData + ParticleDataNumBytes);
+		bFrameAllocated = true;
+		return true;
+	}
+
 	if (MemBlockSize > 0)
 	{
 		/**
@@ -67,8 +77,11 @@ void FParticleDataContainer::Free()
 {
 	if (ParticleData)
 	{
-		// 정렬된 메모리는 _aligned_free로 해제
-		_aligned_free(ParticleData);
+		// 정렬된 메모리는 _aligned_free로 해제 (프레임 아레나 메모리는 아레나 Reset에서 회수)
+		if (!bFrameAllocated)
+		{
+			_aligned_free(ParticleData);
+		}
 		ParticleData = nullptr;
 		ParticleIndices = nullptr;
 	}
@@ -76,4 +89,54 @@ void FParticleDataContainer::Free()
 	MemBlockSize = 0;
 	ParticleDataNumBytes = 0;
 	ParticleIndicesNumShorts = 0;
+	bFrameAllocated = false;
+}
+
+void FDynamicSpriteEmitterDataBase::SortSpriteParticles(int32 SortMode, const FVector4& DepthPlane, uint32* OutSortedKeys)
+{
+	const FDynamicEmitterReplayDataBase& SourceData = GetSource();
+	const int32 Count = SourceData.ActiveParticleCount;
+
+	uint16* Indices = SourceData.DataContainer.ParticleIndices;
+	const uint8* ParticleData = SourceData.DataContainer.ParticleData;
+	const int32 ParticleStride = SourceData.ParticleStride;
+
+	if (SortMode == 0 || Count <= 0 || !Indices || !ParticleData)
+	{
+		return;  // 정렬 불필요
+	}
+
+	// 키는 파티클당 한 번만 계산 (비교 함수 안에서 거리/모드 분기를 반복하지 않는다)
+	FFrameArena& Arena = FFrameMemory::GetInstance().GetCurrentArena();
+	uint32* Keys = OutSortedKeys ? OutSortedKeys : static_cast<uint32*>(Arena.Allocate(static_cast<SIZE_T>(Count) * sizeof(uint32), 16));
+	uint32* Values = static_cast<uint32*>(Arena.Allocate(static_cast<SIZE_T>(Count) * sizeof(uint32), 16));
+
+	if (SortMode == 1)  // Age 정렬 (오래된 것부터)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(ParticleData + Indices[i] * ParticleStride);
+			Keys[i] = ParticleSort::FloatToDescendingSortKey(Particle->RelativeTime);
+			Values[i] = Indices[i];
+		}
+	}
+	else  // Depth 정렬 (먼 것부터 - 투명도 렌더링)
+	{
+		// 뷰 방향에 대한 내적으로 깊이 계산 (유클리드 거리보다 정확)
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(ParticleData + Indices[i] * ParticleStride);
+			const FVector& Location = Particle->Location;
+			const float Depth = Location.X * DepthPlane.X + Location.Y * DepthPlane.Y + Location.Z * DepthPlane.Z + DepthPlane.W;
+			Keys[i] = ParticleSort::FloatToDescendingSortKey(Depth);
+			Values[i] = Indices[i];
+		}
+	}
+
+	ParticleSort::SortKeyValues(Keys, Values, Count);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Indices[i] = static_cast<uint16>(Values[i]);
+	}
 }
@@ -179,6 +179,7 @@ struct FParticleDataContainer
 	int32 ParticleIndicesNumShorts; // 인덱스 배열 개수 (uint16 개수) = MaxParticles
 	uint8* ParticleData;           // 할당된 메모리 블록의 시작 포인터 (16바이트 정렬)
 	uint16* ParticleIndices;       // 인덱스 배열 포인터 = ParticleData + ParticleDataNumBytes (별도 할당 안함)
+	bool bFrameAllocated;          // 프레임 아레나에서 할당됨 (Free에서 해제하지 않음, 2프레임 후 일괄 회수)
 
 	FParticleDataContainer()
 		: MemBlockSize(0)
@@ -186,6 +187,7 @@ struct FParticleDataContainer
 		, ParticleIndicesNumShorts(0)
 		, ParticleData(nullptr)
 		, ParticleIndices(nullptr)
+		, bFrameAllocated(false)
 	{
 	}
 
@@ -205,6 +207,7 @@ struct FParticleDataContainer
 		, ParticleIndicesNumShorts(Other.ParticleIndicesNumShorts)
 		, ParticleData(Other.ParticleData)
 		, ParticleIndices(Other.ParticleIndices)
+		, bFrameAllocated(Other.bFrameAllocated)
 	{
 		// 원본의 소유권 해제 (double-free 방지)
 		Other.MemBlockSize = 0;
@@ -212,6 +215,7 @@ struct FParticleDataContainer
 		Other.ParticleIndicesNumShorts = 0;
 		Other.ParticleData = nullptr;
 		Other.ParticleIndices = nullptr;
+		Other.bFrameAllocated = false;
 	}
 
 	// Move 대입 연산자
@@ -228,6 +232,7 @@ struct FParticleDataContainer
 			ParticleIndicesNumShorts = Other.ParticleIndicesNumShorts;
 			ParticleData = Other.ParticleData;
 			ParticleIndices = Other.ParticleIndices;
+			bFrameAllocated = Other.bFrameAllocated;
 
 			// 원본의 소유권 해제
 			Other.MemBlockSize = 0;
@@ -235,6 +240,7 @@ struct FParticleDataContainer
 			Other.ParticleIndicesNumShorts = 0;
 			Other.ParticleData = nullptr;
 			Other.ParticleIndices = nullptr;
+			Other.bFrameAllocated = false;
 		}
 		return *this;
 	}
@@ -242,8 +248,9 @@ struct FParticleDataContainer
 	// 메모리 할당 (언리얼 엔진 호환)
 	// InParticleDataNumBytes: 파티클 데이터 영역 크기 (바이트) = MaxParticles * ParticleStride
 	// InParticleIndicesNumShorts: 인덱스 배열 개수 (uint16 개수) = MaxParticles
+	// bFromFrameArena: 렌더 데이터처럼 매 프레임 다시 만드는 임시 복사본이면 true (프레임 아레나 사용, 0 초기화 생략)
 	// 반환값: 할당 성공 시 true, 실패 시 false
-	bool Alloc(int32 InParticleDataNumBytes, int32 InParticleIndicesNumShorts);
+	bool Alloc(int32 InParticleDataNumBytes, int32 InParticleIndicesNumShorts, bool bFromFrameArena = false);
 
 	// 메모리 해제 (언리얼 엔진 호환)
 	void Free();
@@ -374,47 +381,11 @@ struct FDynamicSpriteEmitterDataBase : public FDynamicEmitterDataBase
 
 	// 언리얼 엔진 호환: 파티클 정렬 (투명 렌더링을 위해 필수)
 	// SortMode: 0 = 정렬 없음, 1 = Age (오래된 것부터), 2 = Distance (먼 것부터)
-	// ViewDirection: 카메라가 바라보는 방향 (forward vector)
-	virtual void SortSpriteParticles(int32 SortMode, const FVector& ViewOrigin, const FVector& ViewDirection)
-	{
-		const FDynamicEmitterReplayDataBase& SourceData = GetSource();
-
-		if (SortMode == 0 || SourceData.ActiveParticleCount <= 1)
-		{
-			return;  // 정렬 불필요
-		}
-
-		uint16* Indices = SourceData.DataContainer.ParticleIndices;
-		const uint8* ParticleData = SourceData.DataContainer.ParticleData;
-		const int32 ParticleStride = SourceData.ParticleStride;
-
-		if (!Indices || !ParticleData)
-		{
-			return;
-		}
-
-		// std::sort 사용 (O(N log N) - 버블 정렬보다 훨씬 빠름)
-		std::sort(Indices, Indices + SourceData.ActiveParticleCount,
-			[&](uint16 IndexA, uint16 IndexB) -> bool
-			{
-				const FBaseParticle* PA = (const FBaseParticle*)(ParticleData + IndexA * ParticleStride);
-				const FBaseParticle* PB = (const FBaseParticle*)(ParticleData + IndexB * ParticleStride);
-
-				if (SortMode == 1)  // Age 정렬 (오래된 것부터)
-				{
-					return PA->RelativeTime > PB->RelativeTime;
-				}
-				else if (SortMode == 2)  // Depth 정렬 (먼 것부터 - 투명도 렌더링)
-				{
-					// 뷰 방향에 대한 내적으로 깊이 계산 (유클리드 거리보다 정확)
-					float DepthA = FVector::Dot(PA->Location - ViewOrigin, ViewDirection);
-					float DepthB = FVector::Dot(PB->Location - ViewOrigin, ViewDirection);
-					return DepthA > DepthB;  // 먼 것(깊이가 큰 것)을 먼저 렌더링
-				}
-
-				return false;
-			});
-	}
+	// DepthPlane: 깊이 = Dot(Location, DepthPlane.XYZ) + DepthPlane.W
+	//             (카메라 전방 벡터와 원점으로 만들고, 로컬 스페이스 이미터는 컴포넌트 행렬을 미리 접어 넣는다)
+	// 파티클마다 키를 한 번만 계산해 기수 정렬하고 ParticleIndices를 그리는 순서로 재배열한다
+	// OutSortedKeys: 정렬된 순서의 키 (ActiveParticleCount개, 이미터 간 병합용, nullable)
+	virtual void SortSpriteParticles(int32 SortMode, const FVector4& DepthPlane, uint32* OutSortedKeys = nullptr);
 
 	virtual int32 GetDynamicVertexStride() const = 0;
 };
@@ -5,11 +5,60 @@
 #include "Modules/ParticleModule.h"
 #include "Modules/ParticleModuleSpawn.h"
 #include "Modules/ParticleModuleMeshRotation.h"
+#include "Modules/ParticleModuleTrailSource.h"
 #include "ParticleModuleTypeDataSprite.h"
 #include "ParticleModuleTypeDataMesh.h"
 #include "ParticleModuleTypeDataBeam.h"
 #include "ParticleModuleTypeDataRibbon.h"
 
+namespace
+{
+	// 지난 프레임 렌더 데이터가 같은 타입이면 그대로 돌려주고, 없거나 타입이 바뀌었으면 새로 만든다
+	template<typename TDynamicData>
+	TDynamicData* AcquireDynamicData(TUniquePtr<FDynamicEmitterDataBase>& Cached, EDynamicEmitterType Type)
+	{
+		if (!Cached || Cached->GetSource().eEmitterType != Type)
+		{
+			Cached = std::make_unique<TDynamicData>();
+		}
+		return static_cast<TDynamicData*>(Cached.get());
+	}
+
+	// 같은 시스템의 다른 이미터가 TrailSource로 이 이미터를 추적하는지
+	// (TrailSource는 소스 파티클을 FBaseParticle* 슬롯으로 추적하므로 소스는 AoS여야 한다)
+	bool IsTrailSourceEmitter(const UParticleSystem* System, const FString& EmitterName)
+	{
+		if (!System || EmitterName.empty())
+		{
+			return false;
+		}
+
+		for (const UParticleEmitter* Emitter : System->Emitters)
+		{
+			if (!Emitter)
+			{
+				continue;
+			}
+			for (const UParticleLODLevel* LODLevel : Emitter->LODLevels)
+			{
+				if (!LODLevel)
+				{
+					continue;
+				}
+				for (UParticleModule* Module : LODLevel->Modules)
+				{
+					const UParticleModuleTrailSource* TrailSource = Cast<UParticleModuleTrailSource>(Module);
+					if (TrailSource && TrailSource->bEnabled && TrailSource->SourceName == EmitterName)
+					{
+						return true;
+					}
+				}
+			}
+		}
+		return false;
+	}
+}
+
 FParticleEmitterInstance::FParticleEmitterInstance()
 	: SpriteTemplate(nullptr)
 	, Component(nullptr)
@@ -27,6 +76,7 @@ FParticleEmitterInstance::FParticleEmitterInstance()
 	, FrameSpawnedCount(0)
 	, FrameKilledCount(0)
 	, MaxActiveParticles(0)
+	, bUseSoALayout(false)
 	, SpawnFraction(0.0f)
 	// BurstFired는 TArray이므로 기본 초기화됨
 	, EmitterTime(0.0f)
@@ -39,6 +89,7 @@ FParticleEmitterInstance::FParticleEmitterInstance()
 	, CachedEmitterOrigin(0.0f, 0.0f, 0.0f)
 	, CachedEmitterRotation(0.0f, 0.0f, 0.0f)
 	, EmitterToWorld(FMatrix::Identity())
+	, bDeferEvents(false)
 {
 }
 
@@ -74,6 +125,17 @@ void FParticleEmitterInstance::Init(UParticleSystemComponent* InComponent, UPart
 
 	ParticleSize = SpriteTemplate->ParticleSize;
 
+	// 재초기화(풀에서 꺼낸 컴포넌트)면 이전 재생의 파티클/이벤트/정렬 캐시를 버린다 (버퍼는 유지)
+	KillAllParticles();
+	ParticleCounter = 0;
+	FrameSpawnedCount = 0;
+	FrameKilledCount = 0;
+	RenderSlots.Empty();
+	LastSortedSlots.Empty();
+	DeferredCollisionEvents.Empty();
+	DeferredSpawnEvents.Empty();
+	DeferredDeathEvents.Empty();
+
 	// 언리얼 엔진 호환: 타이밍 상태 초기화
 	EmitterTime = 0.0f;
 	SecondsSinceCreation = 0.0f;
@@ -131,10 +193,19 @@ void FParticleEmitterInstance::Init(UParticleSystemComponent* InComponent, UPart
 	}
 
 	// 초기화 로직 호출
+	const int32 OldParticleStride = ParticleStride;
+	const bool bOldUseSoALayout = bUseSoALayout;
 	SetupEmitter();
 
-	// 초기 파티클 데이터 할당
-	Resize(100); // Default to 100 particles
+	// 재초기화인데 Stride/레이아웃이 바뀌었으면 기존 버퍼는 쓸 수 없다 (Resize가 새로 할당하도록 비움)
+	if (MaxActiveParticles > 0 && (ParticleStride != OldParticleStride || bUseSoALayout != bOldUseSoALayout))
+	{
+		MaxActiveParticles = 0;
+	}
+
+	// 초기 파티클 데이터 할당 (Default to 100 particles)
+	// 재초기화면 지난 재생에서 늘어난 크기를 그대로 유지해 다시 키우지 않는다
+	Resize(FMath::Max(MaxActiveParticles, 100));
 }
 
 void FParticleEmitterInstance::SetLODLevel(int32 NewLODIndex)
@@ -199,6 +270,7 @@ void FParticleEmitterInstance::SetLODLevel(int32 NewLODIndex)
 
 	// 새 LOD의 모듈 오프셋 및 BurstFired 배열 업데이트
 	uint32 OldParticleStride = ParticleStride;
+	bool bOldUseSoALayout = bUseSoALayout;
 	SetupEmitter();
 
 	// Stride가 다르면 기존 파티클과 호환되지 않으므로 리셋
@@ -208,8 +280,16 @@ void FParticleEmitterInstance::SetLODLevel(int32 NewLODIndex)
 		UE_LOG("[ParticleEmitterInstance] WARNING: LOD %d -> %d 전환 시 Stride 불일치 (%u -> %u). "
 			"LOD 0에서만 모듈 구성을 변경해야 합니다. 파티클이 리셋됩니다.",
 			CurrentLODLevelIndex, NewLODIndex, OldParticleStride, ParticleStride);
+	}
+
+	// Stride나 저장 레이아웃(AoS/SoA)이 바뀌면 같은 크기로 다시 할당
+	// (Resize는 크기가 같으면 아무것도 하지 않으므로 MaxActiveParticles를 비워서 강제)
+	if (ParticleStride != OldParticleStride || bUseSoALayout != bOldUseSoALayout)
+	{
 		KillAllParticles();
-		Resize(MaxActiveParticles);
+		int32 OldMaxActiveParticles = MaxActiveParticles;
+		MaxActiveParticles = 0;
+		Resize(OldMaxActiveParticles);
 	}
 }
 
@@ -220,6 +300,7 @@ void FParticleEmitterInstance::SetupEmitter()
 	// 언리얼 엔진 호환: 페이로드 크기 계산
 	// 각 모듈이 필요로 하는 추가 데이터 크기를 계산하고 오프셋 할당
 	uint32 TotalPayloadSize = 0;
+	const int32 OldInstancePayloadSize = InstancePayloadSize;
 	InstancePayloadSize = 0;
 
 	// 모든 모듈의 페이로드 크기 계산
@@ -253,8 +334,44 @@ void FParticleEmitterInstance::SetupEmitter()
 	PayloadOffset = ParticleSize;  // 페이로드는 기본 파티클 뒤에 위치
 	ParticleStride = ParticleSize + TotalPayloadSize;
 
-	// 인스턴스 데이터 정리 (InstancePayloadSize 변경 전에 항상 해제)
-	if (InstanceData)
+	// SoA 레이아웃: Required에서 켜져 있고 TypeData를 포함한 모든 모듈이 지원할 때만 사용
+	bUseSoALayout = false;
+	if (CurrentLODLevel->RequiredModule && CurrentLODLevel->RequiredModule->bUseSoALayout && (ParticleStride % 4) == 0)
+	{
+		bUseSoALayout = true;
+		for (UParticleModule* Module : CurrentLODLevel->Modules)
+		{
+			if (Module && Module->bEnabled && !Module->SupportsSoALayout())
+			{
+				bUseSoALayout = false;
+				break;
+			}
+		}
+		if (TypeData && TypeData->bEnabled && !TypeData->SupportsSoALayout())
+		{
+			bUseSoALayout = false;
+		}
+		if (bUseSoALayout && Component && IsTrailSourceEmitter(Component->Template, CurrentLODLevel->RequiredModule->EmitterName))
+		{
+			bUseSoALayout = false;
+		}
+	}
+
+	// 스폰 모듈이 채울 임시 파티클 (SoA에서만)
+	if (bUseSoALayout)
+	{
+		if (SoASpawnScratch.ParticleDataNumBytes != ParticleStride)
+		{
+			SoASpawnScratch.Alloc(ParticleStride, 0);
+		}
+	}
+	else
+	{
+		SoASpawnScratch.Free();
+	}
+
+	// 인스턴스 데이터 정리 (크기가 같으면 재초기화 시 버퍼를 그대로 재사용)
+	if (InstanceData && InstancePayloadSize != OldInstancePayloadSize)
 	{
 		delete[] InstanceData;
 		InstanceData = nullptr;
@@ -263,7 +380,10 @@ void FParticleEmitterInstance::SetupEmitter()
 	// 인스턴스 데이터 할당 (필요한 경우)
 	if (InstancePayloadSize > 0)
 	{
-		InstanceData = new uint8[InstancePayloadSize];
+		if (!InstanceData)
+		{
+			InstanceData = new uint8[InstancePayloadSize];
+		}
 		memset(InstanceData, 0, InstancePayloadSize);
 	}
 
@@ -291,6 +411,37 @@ void FParticleEmitterInstance::Resize(int32 NewMaxActiveParticles)
 		return;
 	}
 
+	// SoA 레이아웃: 스트림 버퍼만 사용하고 AoS 컨테이너는 비운다
+	if (bUseSoALayout)
+	{
+		ParticleDataContainer.Free();
+		ParticleData = nullptr;
+		ParticleIndices = nullptr;
+
+		// 활성 파티클은 항상 앞쪽에 모여 있으므로 축소할 때도 앞에서부터 보존된다
+		const int32 NumStreams = ParticleStride / 4;
+		const int32 NumToPreserve = (SoAParticles.NumStreams == NumStreams) ? FMath::Min(ActiveParticles, NewMaxActiveParticles) : 0;
+		MaxActiveParticles = NewMaxActiveParticles;
+
+		if (MaxActiveParticles > 0 && SoAParticles.Alloc(NumStreams, MaxActiveParticles, NumToPreserve))
+		{
+			ActiveParticles = NumToPreserve;
+		}
+		else
+		{
+			if (MaxActiveParticles > 0)
+			{
+				UE_LOG("[ParticleEmitterInstance] Failed to allocate SoA particle memory: requested %d particles (%d streams)\n",
+					MaxActiveParticles, NumStreams);
+			}
+			SoAParticles.Free();
+			MaxActiveParticles = 0;
+			ActiveParticles = 0;
+		}
+		return;
+	}
+	SoAParticles.Free();
+
 	// 기존 데이터 백업 (확장 시 보존을 위해)
 	int32 OldActiveParticles = ActiveParticles;
 	int32 OldMaxActiveParticles = MaxActiveParticles;
@@ -494,10 +645,67 @@ void FParticleEmitterInstance::Tick(float DeltaTime, bool bSuppressSpawning)
 	}
 }
 
+bool FParticleEmitterInstance::CanTickOnWorkerThread() const
+{
+	if (!CurrentLODLevel)
+	{
+		return true;
+	}
+
+	for (UParticleModule* Module : CurrentLODLevel->Modules)
+	{
+		if (Module && Module->bEnabled && !Module->CanUpdateOnWorkerThread())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FParticleEmitterInstance::AddCollisionEvent(const FParticleEventCollideData& Event)
+{
+	if (bDeferEvents)
+	{
+		DeferredCollisionEvents.Add(Event);
+	}
+	else if (Component)
+	{
+		Component->AddCollisionEvent(Event);
+	}
+}
+
+void FParticleEmitterInstance::AddSpawnEvent(const FParticleEventData& Event)
+{
+	if (bDeferEvents)
+	{
+		DeferredSpawnEvents.Add(Event);
+	}
+	else if (Component)
+	{
+		Component->AddSpawnEvent(Event);
+	}
+}
+
+void FParticleEmitterInstance::AddDeathEvent(const FParticleEventData& Event)
+{
+	if (bDeferEvents)
+	{
+		DeferredDeathEvents.Add(Event);
+	}
+	else if (Component)
+	{
+		Component->AddDeathEvent(Event);
+	}
+}
+
 void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, float Increment, const FVector& InitialLocation, const FVector& InitialVelocity)
 {
 	// 필수 객체 nullptr 체크
-	if (!CurrentLODLevel || !ParticleData || !ParticleIndices)
+	if (!CurrentLODLevel || !HasParticleStorage())
+	{
+		return;
+	}
+	if (bUseSoALayout && !SoASpawnScratch.ParticleData)
 	{
 		return;
 	}
@@ -517,7 +725,7 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
 			Resize(MaxActiveParticles * 2);
 
 			// Resize 후 포인터 유효성 재검사
-			if (!ParticleData || !ParticleIndices)
+			if (!HasParticleStorage())
 			{
 				return;
 			}
@@ -529,14 +737,23 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
 			}
 		}
 
-		// 새 파티클의 슬롯 가져오기 (인덱스 시스템 사용)
-		// ParticleIndices[ActiveParticles]는 다음 사용 가능한 슬롯을 가리킴
-		// (KillParticle에서 스왑된 빈 슬롯 또는 초기화 시 순차 슬롯)
-		int32 ParticleSlot = ParticleIndices[ActiveParticles];
-		ActiveParticles++;
+		uint8* ParticleBase = nullptr;
+		if (bUseSoALayout)
+		{
+			// SoA: 임시 AoS 파티클에 스폰 모듈을 그대로 돌린 뒤 마지막에 스트림으로 분산
+			ParticleBase = SoASpawnScratch.ParticleData;
+		}
+		else
+		{
+			// 새 파티클의 슬롯 가져오기 (인덱스 시스템 사용)
+			// ParticleIndices[ActiveParticles]는 다음 사용 가능한 슬롯을 가리킴
+			// (KillParticle에서 스왑된 빈 슬롯 또는 초기화 시 순차 슬롯)
+			int32 ParticleSlot = ParticleIndices[ActiveParticles];
 
-		// 파티클 포인터 가져오기 (언리얼 방식)
-		uint8* ParticleBase = ParticleData + (ParticleSlot * ParticleStride);
+			// 파티클 포인터 가져오기 (언리얼 방식)
+			ParticleBase = ParticleData + (ParticleSlot * ParticleStride);
+		}
+		ActiveParticles++;
 		DECLARE_PARTICLE_PTR(Particle, ParticleBase);
 
 		// 생성 전
@@ -564,6 +781,11 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
 		// 생성 후
 		PostSpawn(Particle, static_cast<float>(i) / Count, SpawnTime);
 
+		if (bUseSoALayout)
+		{
+			SoAParticles.Scatter(ActiveParticles - 1, ParticleBase);
+		}
+
 		ParticleCounter++;
 		FrameSpawnedCount++;
 	}
@@ -626,6 +848,12 @@ void FParticleEmitterInstance::UpdateParticles(float DeltaTime)
 		return;
 	}
 
+	if (bUseSoALayout)
+	{
+		UpdateParticlesSoA(DeltaTime);
+		return;
+	}
+
 	// PHASE 1: 모든 파티클의 기본 속성 업데이트 (수명, 위치, 회전)
 	// 이 단계에서는 파티클을 죽이지 않음 - 모듈들이 먼저 처리할 수 있도록
 	for (int32 i = ActiveParticles - 1; i >= 0; i--)
@@ -696,6 +924,27 @@ void FParticleEmitterInstance::UpdateParticles(float DeltaTime)
 	}
 }
 
+void FParticleEmitterInstance::UpdateParticlesSoA(float DeltaTime)
+{
+	// PHASE 1: 기본 속성 업데이트 (SIMD, 4개씩)
+	ParticleSoA::IntegrateBase(SoAParticles, ActiveParticles, DeltaTime);
+
+	// PHASE 2: 업데이트 모듈 적용 (SetupEmitter에서 모든 모듈이 SoA를 지원함을 확인)
+	for (UParticleModule* Module : CurrentLODLevel->UpdateModules)
+	{
+		if (Module && Module->bEnabled && Module->bUpdateModule)
+		{
+			FModuleSoAUpdateContext Context = { *this, SoAParticles, PayloadOffset + static_cast<int32>(Module->ModuleOffsetInParticle), ActiveParticles, DeltaTime };
+			Module->UpdateSoA(Context);
+		}
+	}
+
+	// PHASE 3: 수명이 다한 파티클 제거 (AoS와 같은 역방향 swap-remove 순서)
+	const int32 NumAlive = ParticleSoA::KillExpired(SoAParticles, ActiveParticles);
+	FrameKilledCount += ActiveParticles - NumAlive;
+	ActiveParticles = NumAlive;
+}
+
 void FParticleEmitterInstance::KillParticle(int32 Index)
 {
 	if (Index < 0 || Index >= ActiveParticles)
@@ -707,7 +956,12 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
 	// (여기서 생성하면 Generator 없는 이미터에서도 이벤트가 발생하는 문제)
 
 	// 마지막 활성 파티클과 교체
-	if (Index != ActiveParticles - 1)
+	if (bUseSoALayout)
+	{
+		// SoA는 인덱스 간접 참조가 없으므로 마지막 파티클 데이터를 빈 자리로 옮긴다
+		SoAParticles.MoveSlot(ActiveParticles - 1, Index);
+	}
+	else if (Index != ActiveParticles - 1)
 	{
 		uint16 Temp = ParticleIndices[Index];
 		ParticleIndices[Index] = ParticleIndices[ActiveParticles - 1];
@@ -725,7 +979,8 @@ void FParticleEmitterInstance::KillAllParticles()
 
 FBaseParticle* FParticleEmitterInstance::GetParticleAtIndex(int32 Index)
 {
-	if (Index < 0 || Index >= ActiveParticles)
+	// SoA 레이아웃에는 FBaseParticle 형태의 파티클이 메모리에 존재하지 않는다
+	if (bUseSoALayout || Index < 0 || Index >= ActiveParticles)
 	{
 		return nullptr;
 	}
@@ -735,10 +990,28 @@ FBaseParticle* FParticleEmitterInstance::GetParticleAtIndex(int32 Index)
 	return (FBaseParticle*)ParticleBase;
 }
 
+FVector FParticleEmitterInstance::GetParticleLocation(int32 Index) const
+{
+	if (Index < 0 || Index >= ActiveParticles)
+	{
+		return FVector(0.0f, 0.0f, 0.0f);
+	}
+
+	if (bUseSoALayout)
+	{
+		const float* LocX = PARTICLE_SOA_STREAM(SoAParticles, Location);
+		const int32 Capacity = SoAParticles.Capacity;
+		return FVector(LocX[Index], LocX[Capacity + Index], LocX[2 * Capacity + Index]);
+	}
+
+	const uint8* ParticleBase = ParticleData + (ParticleIndices[Index] * ParticleStride);
+	return reinterpret_cast<const FBaseParticle*>(ParticleBase)->Location;
+}
+
 FDynamicEmitterDataBase* FParticleEmitterInstance::GetDynamicData(bool bSelected)
 {
 	// 필수 객체 nullptr 체크 및 LOD 활성화 체크
-	if (!ParticleData || !CurrentLODLevel || ActiveParticles <= 0 || !CurrentLODLevel->bEnabled)
+	if (!HasParticleStorage() || !CurrentLODLevel || ActiveParticles <= 0 || !CurrentLODLevel->bEnabled)
 	{
 		return nullptr;
 	}
@@ -750,10 +1023,9 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::GetDynamicData(bool bSelected
 	// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 	if (auto* BeamType = Cast<UParticleModuleTypeDataBeam>(TypeData))
 	{
-		auto* BeamData = new FDynamicBeamEmitterData();
+		auto* BeamData = AcquireDynamicData<FDynamicBeamEmitterData>(CachedDynamicData, EDynamicEmitterType::Beam);
 		if (!BuildBeamDynamicData(BeamData, BeamType))
 		{
-			delete BeamData;
 			return nullptr;
 		}
 		return BeamData;
@@ -764,10 +1036,9 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::GetDynamicData(bool bSelected
 	// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 	if (auto* RibbonType = Cast<UParticleModuleTypeDataRibbon>(TypeData))
 	{
-		auto* RibbonData = new FDynamicRibbonEmitterData();
+		auto* RibbonData = AcquireDynamicData<FDynamicRibbonEmitterData>(CachedDynamicData, EDynamicEmitterType::Ribbon);
 		if (!BuildRibbonDynamicData(RibbonData, RibbonType))
 		{
-			delete RibbonData;
 			return nullptr;
 		}
 		return RibbonData;
@@ -778,10 +1049,9 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::GetDynamicData(bool bSelected
 	// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 	if (auto* MeshType = Cast<UParticleModuleTypeDataMesh>(TypeData))
 	{
-		FDynamicMeshEmitterData* MeshData = new FDynamicMeshEmitterData();
+		FDynamicMeshEmitterData* MeshData = AcquireDynamicData<FDynamicMeshEmitterData>(CachedDynamicData, EDynamicEmitterType::Mesh);
 		if (!BuildMeshDynamicData(MeshData, MeshType))
 		{
-			delete MeshData;
 			return nullptr;
 		}
 		return MeshData;
@@ -791,27 +1061,86 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::GetDynamicData(bool bSelected
 	// SpriteEmitter DynamicData
 	// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 	{
-		FDynamicSpriteEmitterData* SpriteData = new FDynamicSpriteEmitterData();
+		FDynamicSpriteEmitterData* SpriteData = AcquireDynamicData<FDynamicSpriteEmitterData>(CachedDynamicData, EDynamicEmitterType::Sprite);
 		if (!BuildSpriteDynamicData(SpriteData))
 		{
-			delete SpriteData;
 			return nullptr;
 		}
 		return SpriteData;
 	}
 }
 
+void FParticleEmitterInstance::BuildRenderSlotOrder()
+{
+	RenderSlots.SetNum(ActiveParticles);
+	if (LastSortedSlots.IsEmpty())
+	{
+		memcpy(RenderSlots.GetData(), ParticleIndices, ActiveParticles * sizeof(uint16));
+		return;
+	}
+
+	if (SortSlotMarks.Num() < MaxActiveParticles)
+	{
+		SortSlotMarks.SetNum(MaxActiveParticles, 0);
+	}
+
+	for (int32 i = 0; i < ActiveParticles; i++)
+	{
+		SortSlotMarks[ParticleIndices[i]] = 1;
+	}
+
+	// 1. 지난 정렬 순서 중 아직 활성인 슬롯 (죽은 슬롯에 새로 생긴 파티클도 그 자리에 들어가지만 정렬이 바로잡는다)
+	int32 Num = 0;
+	for (uint16 Slot : LastSortedSlots)
+	{
+		if (Slot < MaxActiveParticles && SortSlotMarks[Slot] == 1)
+		{
+			SortSlotMarks[Slot] = 2;
+			RenderSlots[Num++] = Slot;
+		}
+	}
+
+	// 2. 새로 생긴 파티클은 뒤에
+	for (int32 i = 0; i < ActiveParticles; i++)
+	{
+		const uint16 Slot = ParticleIndices[i];
+		if (SortSlotMarks[Slot] == 1)
+		{
+			RenderSlots[Num++] = Slot;
+		}
+		SortSlotMarks[Slot] = 0;
+	}
+}
+
+void FParticleEmitterInstance::StoreSortedOrder(const uint16* SortedRenderIndices, int32 Count)
+{
+	// 렌더 복사본을 만든 뒤 이미터가 다시 만들어졌으면 슬롯 대응이 맞지 않는다
+	if (!SortedRenderIndices || Count != RenderSlots.Num())
+	{
+		return;
+	}
+
+	LastSortedSlots.SetNum(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		LastSortedSlots[i] = RenderSlots[SortedRenderIndices[i]];
+	}
+}
+
 bool FParticleEmitterInstance::BuildSpriteDynamicData(FDynamicSpriteEmitterData* Data)
 {
 	if(!Data)	return false;
 
 	// 소스 데이터 설정
+	// SoA는 렌더러가 읽는 FBaseParticle 부분만 펼쳐서 넘기므로 스트라이드가 기본 파티클 크기다
+	const int32 RenderStride = bUseSoALayout ? ParticleSize : ParticleStride;
 	Data->Source.ActiveParticleCount = ActiveParticles;
-	Data->Source.ParticleStride = ParticleStride;
+	Data->Source.ParticleStride = RenderStride;
 
 	// 파티클 데이터 복사 (언리얼 엔진 방식: Alloc 사용)
-	int32 ParticleDataBytes = ActiveParticles * ParticleStride;
-	bool bAllocSuccess = Data->Source.DataContainer.Alloc(ParticleDataBytes, ActiveParticles);
+	// 매 프레임 다시 만드는 렌더 복사본이므로 프레임 아레나에서 할당
+	int32 ParticleDataBytes = ActiveParticles * RenderStride;
+	bool bAllocSuccess = Data->Source.DataContainer.Alloc(ParticleDataBytes, ActiveParticles, true);
 
 	if (!bAllocSuccess)
 	{
@@ -821,25 +1150,61 @@ bool FParticleEmitterInstance::BuildSpriteDynamicData(FDynamicSpriteEmitterData*
 		return false;
 	}
 
-	// 컴팩트 복사: 활성 파티클만 연속으로 복사 (sparse array → dense array)
 	uint8* DstData = Data->Source.DataContainer.ParticleData;
-	for (int32 i = 0; i < ActiveParticles; i++)
+	if (bUseSoALayout)
 	{
-		int32 SrcIndex = ParticleIndices[i];
-		const uint8* SrcParticle = ParticleData + SrcIndex * ParticleStride;
-		memcpy(DstData + i * ParticleStride, SrcParticle, ParticleStride);
+		// SoA → AoS 전치 (스트림 순차 읽기), 이미 빽빽하므로 인덱스는 순차
+		// swap-remove로 슬롯이 계속 바뀌므로 지난 정렬 순서는 쓰지 않는다
+		SoAParticles.GatherBaseParticles(DstData, RenderStride, ActiveParticles);
+		RenderSlots.Empty();
+		LastSortedSlots.Empty();
+		for (int32 i = 0; i < ActiveParticles; i++)
+		{
+			Data->Source.DataContainer.ParticleIndices[i] = static_cast<uint16>(i);
+		}
+	}
+	else
+	{
+		// 정렬하는 이미터는 지난 프레임 정렬 순서대로 복사 (정렬 입력이 거의 정렬된 상태가 됨)
+		const bool bSorted = CurrentLODLevel && CurrentLODLevel->RequiredModule && CurrentLODLevel->RequiredModule->SortMode != 0;
+		const uint16* CopyOrder = ParticleIndices;
+		if (bSorted)
+		{
+			BuildRenderSlotOrder();
+			CopyOrder = RenderSlots.GetData();
+		}
+		else
+		{
+			RenderSlots.Empty();
+			LastSortedSlots.Empty();
+		}
 
-		// 인덱스는 컴팩트 복사 후 순차적으로 재매핑
-		Data->Source.DataContainer.ParticleIndices[i] = static_cast<uint16>(i);
+		// 컴팩트 복사: 활성 파티클만 연속으로 복사 (sparse array → dense array)
+		for (int32 i = 0; i < ActiveParticles; i++)
+		{
+			int32 SrcIndex = CopyOrder[i];
+			const uint8* SrcParticle = ParticleData + SrcIndex * ParticleStride;
+			memcpy(DstData + i * ParticleStride, SrcParticle, ParticleStride);
+
+			// 인덱스는 컴팩트 복사 후 순차적으로 재매핑
+			Data->Source.DataContainer.ParticleIndices[i] = static_cast<uint16>(i);
+		}
 	}
 
 	// 언리얼 엔진 호환: Required 모듈과 Material 설정 (렌더링 시 필요)
 	if (CurrentLODLevel && CurrentLODLevel->RequiredModule)
 	{
-		// 렌더 스레드용 데이터로 변환하여 저장 (TUniquePtr 사용)
-		Data->Source.RequiredModule = std::make_unique<FParticleRequiredModule>(
-			CurrentLODLevel->RequiredModule->ToRenderThreadData()
-		);
+		// 렌더 스레드용 데이터로 변환하여 저장 (재사용하는 렌더 데이터면 기존 객체에 덮어씀)
+		if (Data->Source.RequiredModule)
+		{
+			*Data->Source.RequiredModule = CurrentLODLevel->RequiredModule->ToRenderThreadData();
+		}
+		else
+		{
+			Data->Source.RequiredModule = std::make_unique<FParticleRequiredModule>(
+				CurrentLODLevel->RequiredModule->ToRenderThreadData()
+			);
+		}
 		Data->Source.MaterialInterface = Data->Source.RequiredModule->Material;
 		Data->Source.SortMode = CurrentLODLevel->RequiredModule->SortMode;
 	}
@@ -875,7 +1240,7 @@ bool FParticleEmitterInstance::BuildMeshDynamicData(FDynamicMeshEmitterData* Dat
 
 	// 파티클 데이터 복사 (스프라이트와 동일한 방식: 깊은 복사)
 	int32 ParticleDataBytes = ActiveParticles * ParticleStride;
-	bool bAllocSuccess = Data->MeshSource.DataContainer.Alloc(ParticleDataBytes, ActiveParticles);
+	bool bAllocSuccess = Data->MeshSource.DataContainer.Alloc(ParticleDataBytes, ActiveParticles, true);
 
 	if (!bAllocSuccess)
 	{
@@ -4,6 +4,8 @@
 #include "ParticleHelper.h"
 #include "ParticleEmitter.h"
 #include "ParticleRandomStream.h"
+#include "ParticleEventTypes.h"
+#include "ParticleSoA.h"
 
 class UParticleSystemComponent;
 class UParticleModuleTypeDataMesh;
@@ -51,6 +53,23 @@ struct FParticleEmitterInstance
 	/** 파티클 데이터배열에 저장할 수 있는 최대 파티클 활성 수 */
 	int32 MaxActiveParticles;
 
+	// SoA 레이아웃 (Required 모듈에서 켜고, 모든 모듈이 지원할 때만 SetupEmitter에서 true)
+	// true면 ParticleData/ParticleIndices는 nullptr이고 파티클은 SoAParticles의 [0, ActiveParticles)에 있다
+	bool bUseSoALayout;
+	FParticleSoAData SoAParticles;
+	// 스폰 모듈이 AoS 파티클 하나를 채울 임시 버퍼 (채운 뒤 SoAParticles로 분산)
+	FParticleDataContainer SoASpawnScratch;
+
+	// 반투명 정렬 순서 캐시 (SortMode가 켜진 AoS 스프라이트 이미터)
+	// 렌더 복사본을 지난 프레임의 정렬 순서(슬롯 기준)대로 만들어 정렬이 거의 정렬된 입력에서 시작하게 한다
+	TArray<uint16> RenderSlots;       // 마지막 렌더 복사본의 i번째 파티클이 있던 슬롯
+	TArray<uint16> LastSortedSlots;   // 지난 정렬 결과 (그리는 순서의 슬롯)
+	TArray<uint8> SortSlotMarks;      // 복사 순서 구성용 (슬롯별 0: 비활성, 1: 활성, 2: 추가됨)
+
+	// 렌더 데이터 객체 재사용 (GetDynamicData가 매 프레임 new/delete하지 않고 같은 객체를 다시 채운다)
+	// 컴포넌트의 EmitterRenderData는 이 객체를 가리키기만 하고 소유하지 않는다
+	TUniquePtr<FDynamicEmitterDataBase> CachedDynamicData;
+
 	// 스폰 분수 (부드러운 스폰을 위함)
 	float SpawnFraction;
 
@@ -74,6 +93,13 @@ struct FParticleEmitterInstance
 	FVector CachedEmitterRotation;   // Required 모듈의 EmitterRotation 캐시 (Euler angles)
 	FMatrix EmitterToWorld;          // 이미터 회전 변환 행렬 (파티클 속도 회전용)
 
+	// 파티클 시뮬레이션 단계(워커 스레드)에서 생긴 이벤트는 컴포넌트 대신 여기 모아뒀다가
+	// 틱이 끝난 뒤 게임 스레드에서 이미터 순서대로 컴포넌트에 합친다 (스레드 수와 무관하게 결정적)
+	bool bDeferEvents;
+	TArray<FParticleEventCollideData> DeferredCollisionEvents;
+	TArray<FParticleEventData> DeferredSpawnEvents;
+	TArray<FParticleEventData> DeferredDeathEvents;
+
 	// 생성자 / 소멸자
 	FParticleEmitterInstance();
 	virtual ~FParticleEmitterInstance();
@@ -90,6 +116,14 @@ struct FParticleEmitterInstance
 	// 이미터 인스턴스 업데이트
 	void Tick(float DeltaTime, bool bSuppressSpawning);
 
+	// 현재 LOD의 모든 모듈이 워커 스레드 Update를 허용하는지
+	bool CanTickOnWorkerThread() const;
+
+	// 이벤트 추가 (bDeferEvents면 이미터 버퍼에, 아니면 바로 컴포넌트에)
+	void AddCollisionEvent(const FParticleEventCollideData& Event);
+	void AddSpawnEvent(const FParticleEventData& Event);
+	void AddDeathEvent(const FParticleEventData& Event);
+
 	// 파티클 생성
 	void SpawnParticles(int32 Count, float StartTime, float Increment, const FVector& InitialLocation, const FVector& InitialVelocity);
 
@@ -111,24 +145,39 @@ struct FParticleEmitterInstance
 	// 파티클 업데이트
 	void UpdateParticles(float DeltaTime);
 
-	// 인덱스의 파티클 가져오기
+	// SoA 레이아웃 업데이트 (기본 적분 → 모듈 UpdateSoA → 수명 만료 제거)
+	void UpdateParticlesSoA(float DeltaTime);
+
+	// 인덱스의 파티클 가져오기 (SoA 레이아웃이면 nullptr)
 	FBaseParticle* GetParticleAtIndex(int32 Index);
 
-	// 렌더링을 위한 동적 데이터 생성
+	// 인덱스의 파티클 위치 (두 레이아웃 공통)
+	FVector GetParticleLocation(int32 Index) const;
+
+	// 파티클 저장소가 할당되어 있는지 (AoS/SoA 공통)
+	bool HasParticleStorage() const { return bUseSoALayout ? SoAParticles.Data != nullptr : ParticleData != nullptr; }
+
+	// 렌더링을 위한 동적 데이터 갱신 (인스턴스 소유, 다음 호출이나 인스턴스 해제 전까지 유효)
 	FDynamicEmitterDataBase* GetDynamicData(bool bSelected);
 
+	// 렌더 복사본을 정렬한 결과를 다음 렌더 복사본의 시작 순서로 저장 (렌더 복사본 인덱스 → 슬롯)
+	void StoreSortedOrder(const uint16* SortedRenderIndices, int32 Count);
+
 	// Dynamic Data builders (Sprite / Mesh / Beam / Ribbon)
 	bool BuildSpriteDynamicData(FDynamicSpriteEmitterData* Data);
 	bool BuildMeshDynamicData(FDynamicMeshEmitterData* Data, UParticleModuleTypeDataMesh* MeshType);
 	bool BuildBeamDynamicData(FDynamicBeamEmitterData* Data, UParticleModuleTypeDataBeam* BeamType);
 	bool BuildRibbonDynamicData(FDynamicRibbonEmitterData* Data, UParticleModuleTypeDataRibbon* RibbonType);
+
+	// RenderSlots = 지난 정렬 순서로 늘어놓은 활성 슬롯
+	void BuildRenderSlotOrder();
 };
 
 // 언리얼 엔진 호환: 인덱스로 파티클을 가져오는 헬퍼 함수 구현
 // ParticleHelper.h에서 선언된 함수의 구현 (순환 의존성 방지)
 inline FBaseParticle* GetParticleAtIndex(FParticleEmitterInstance* Instance, int32 Index)
 {
-	if (!Instance || Index < 0 || Index >= Instance->ActiveParticles)
+	if (!Instance || !Instance->ParticleData || Index < 0 || Index >= Instance->ActiveParticles)
 	{
 		return nullptr;
 	}
@@ -4,6 +4,7 @@
 
 // 전방 선언
 struct FParticleEmitterInstance;
+struct FParticleSoAData;
 
 // 언리얼 엔진 호환: 모듈 업데이트 컨텍스트 구조체
 // 매개변수 전달을 간소화하고 확장성을 높임
@@ -14,6 +15,17 @@ struct FModuleUpdateContext
 	float                     DeltaTime;  // 델타 타임
 };
 
+// SoA 레이아웃 이미터용 업데이트 컨텍스트 (UParticleModule::UpdateSoA)
+// Offset은 AoS와 같은 바이트 오프셋 → Particles.GetStream(Offset + 필드 오프셋)으로 페이로드 스트림을 얻는다
+struct FModuleSoAUpdateContext
+{
+	FParticleEmitterInstance& Owner;         // 이미터 인스턴스 참조
+	FParticleSoAData&         Particles;     // 스트림 저장소
+	int32                     Offset;        // 모듈 페이로드 바이트 오프셋 (PayloadOffset + ModuleOffsetInParticle)
+	int32                     NumParticles;  // 활성 파티클 수 (커널은 4의 배수로 올려 순회)
+	float                     DeltaTime;     // 델타 타임
+};
+
 // 파티클 데이터에서 파티클 포인터를 선언하는 헬퍼 매크로 (언리얼 엔진 호환)
 // SpawnParticles 내부에서 사용 (ParticleBase를 Particle로 캐스팅)
 // 사용법: DECLARE_PARTICLE_PTR(Particle, ParticleBase);
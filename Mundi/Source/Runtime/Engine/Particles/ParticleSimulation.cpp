@@ -0,0 +1,124 @@
+#include "pch.h"
+#include "ParticleSimulation.h"
+#include "ParticleSystemComponent.h"
+#include "ParticleEmitterInstance.h"
+#include "JobSystem.h"
+
+namespace
+{
+	// 이미터 틱 하나는 가벼운 편이라 너무 잘게 쪼개면 잡 스케줄링 비용이 더 크다
+	constexpr int32 MinEmittersPerJob = 2;
+}
+
+void FParticleSimulation::Enqueue(UParticleSystemComponent* Component, float DeltaTime)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	if (Component->PendingSimulationIndex != -1)
+	{
+		PendingComponents[Component->PendingSimulationIndex].DeltaTime += DeltaTime;
+		return;
+	}
+
+	Component->PendingSimulationIndex = PendingComponents.Num();
+
+	FPendingComponent Pending;
+	Pending.Component = Component;
+	Pending.DeltaTime = DeltaTime;
+	PendingComponents.Add(Pending);
+}
+
+void FParticleSimulation::Remove(UParticleSystemComponent* Component)
+{
+	if (!Component || Component->PendingSimulationIndex == -1)
+	{
+		return;
+	}
+
+	// 인덱스를 유지해야 하므로 자리만 비운다
+	PendingComponents[Component->PendingSimulationIndex].Component = nullptr;
+	Component->PendingSimulationIndex = -1;
+}
+
+void FParticleSimulation::Execute()
+{
+	if (PendingComponents.IsEmpty())
+	{
+		return;
+	}
+
+	WorkerTasks.clear();
+	GameThreadTasks.clear();
+
+	// === 1. 이미터 수집 (게임 스레드) ===
+	for (const FPendingComponent& Pending : PendingComponents)
+	{
+		UParticleSystemComponent* Component = Pending.Component;
+		if (!Component)
+		{
+			continue;
+		}
+
+		// 모듈들이 워커에서 GetWorldTransform()을 읽으므로 캐시를 미리 채워둔다 (const 조회가 캐시를 갱신함)
+		// 소켓에 붙은 컴포넌트는 조회할 때마다 부모 체인을 다시 계산하므로 워커에 보내지 않는다
+		Component->GetWorldTransform();
+		const bool bComponentOnWorker = !Component->IsTransformCacheBypassed();
+
+		for (FParticleEmitterInstance* Instance : Component->EmitterInstances)
+		{
+			if (!Instance)
+			{
+				continue;
+			}
+
+			Instance->bDeferEvents = true;
+
+			FEmitterTask Task;
+			Task.Instance = Instance;
+			Task.DeltaTime = Pending.DeltaTime;
+
+			if (bComponentOnWorker && Instance->CanTickOnWorkerThread())
+			{
+				WorkerTasks.Add(Task);
+			}
+			else
+			{
+				GameThreadTasks.Add(Task);
+			}
+		}
+	}
+
+	// === 2. 병렬 시뮬레이션 ===
+	// 이미터는 자신의 파티클/랜덤 스트림/이벤트 버퍼만 쓰고 컴포넌트는 읽기만 한다
+	FEmitterTask* Tasks = WorkerTasks.data();
+	ParallelFor(WorkerTasks.Num(), [Tasks](int32 Index)
+	{
+		Tasks[Index].Instance->Tick(Tasks[Index].DeltaTime, false);
+	}, MinEmittersPerJob);
+
+	// === 3. 게임 스레드 전용 이미터 (월드 조회, 형제 이미터 참조) ===
+	for (const FEmitterTask& Task : GameThreadTasks)
+	{
+		Task.Instance->Tick(Task.DeltaTime, false);
+	}
+
+	// === 4. 컴포넌트별 후처리 (등록 순서대로) ===
+	// 이벤트 핸들러가 다른 컴포넌트를 해제할 수 있으므로 매번 슬롯을 다시 읽는다
+	for (int32 i = 0; i < PendingComponents.Num(); ++i)
+	{
+		UParticleSystemComponent* Component = PendingComponents[i].Component;
+		if (!Component)
+		{
+			continue;
+		}
+
+		Component->PendingSimulationIndex = -1;
+		PendingComponents[i].Component = nullptr;
+		Component->FinishSimulation();
+	}
+
+	PendingComponents.clear();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+class UParticleSystemComponent;
+struct FParticleEmitterInstance;
+
+/**
+ * FParticleSimulation
+ * 월드 단위 파티클 시뮬레이션 단계입니다.
+ *
+ * 액터 틱 동안 UParticleSystemComponent::TickComponent는 이미터를 직접 틱하지 않고 여기에 등록만 합니다.
+ * 액터 틱이 끝나면 UWorld::Tick이 Execute()를 호출하고, 등록된 모든 컴포넌트의 이미터 인스턴스를 모아
+ * 잡 시스템 워커에서 한꺼번에 틱합니다.
+ *
+ * - 워커에서 생긴 스폰/사망/충돌 이벤트는 이미터별 버퍼에 쌓였다가
+ *   게임 스레드에서 (등록 순서 → 이미터 순서)로 컴포넌트에 합쳐지므로 스레드 수와 무관하게 결정적입니다.
+ * - 게임 스레드 전용 모듈(충돌, 트레일 소스)을 가진 이미터와 소켓에 붙은 컴포넌트는 병렬 단계 뒤에 순서대로 틱합니다.
+ * - 렌더 데이터 갱신과 이벤트 디스패치/브로드캐스트는 지금처럼 게임 스레드에서 컴포넌트별로 수행합니다.
+ */
+class FParticleSimulation
+{
+public:
+	// TickComponent에서 호출 (같은 프레임에 다시 등록되면 DeltaTime만 누적)
+	void Enqueue(UParticleSystemComponent* Component, float DeltaTime);
+
+	// 컴포넌트 해제 시 호출 (이번 프레임 대기 목록에서 제외)
+	void Remove(UParticleSystemComponent* Component);
+
+	// 등록된 모든 이미터를 시뮬레이션하고 컴포넌트별 후처리 수행 (게임 스레드, 액터 틱 이후)
+	void Execute();
+
+	bool IsEmpty() const { return PendingComponents.IsEmpty(); }
+
+private:
+	struct FPendingComponent
+	{
+		UParticleSystemComponent* Component = nullptr;
+		float DeltaTime = 0.0f;
+	};
+
+	struct FEmitterTask
+	{
+		FParticleEmitterInstance* Instance = nullptr;
+		float DeltaTime = 0.0f;
+	};
+
+	TArray<FPendingComponent> PendingComponents;
+
+	// 프레임마다 재사용 (게임 스레드에서만 채운다)
+	TArray<FEmitterTask> WorkerTasks;
+	TArray<FEmitterTask> GameThreadTasks;
+};
@@ -0,0 +1,188 @@
+#include "pch.h"
+#include "ParticleSoA.h"
+
+bool FParticleSoAData::Alloc(int32 InNumStreams, int32 InCapacity, int32 NumToPreserve)
+{
+	const int32 NewCapacity = ParticleSoA::PackedCount(InCapacity);
+	if (InNumStreams <= 0 || NewCapacity <= 0)
+	{
+		Free();
+		return false;
+	}
+
+	float* NewData = static_cast<float*>(_aligned_malloc(static_cast<size_t>(InNumStreams) * NewCapacity * sizeof(float), 16));
+	if (!NewData)
+	{
+		Free();
+		return false;
+	}
+
+	// 남는 레인까지 SSE로 읽으므로 0으로 채워 NaN/비정규화 수가 섞이지 않게 한다
+	memset(NewData, 0, static_cast<size_t>(InNumStreams) * NewCapacity * sizeof(float));
+
+	// 스트림 구성이 같을 때만 기존 파티클 보존
+	if (Data && InNumStreams == NumStreams)
+	{
+		NumToPreserve = FMath::Min(NumToPreserve, FMath::Min(Capacity, NewCapacity));
+		if (NumToPreserve > 0)
+		{
+			for (int32 Stream = 0; Stream < NumStreams; ++Stream)
+			{
+				memcpy(NewData + static_cast<size_t>(Stream) * NewCapacity,
+					Data + static_cast<size_t>(Stream) * Capacity,
+					NumToPreserve * sizeof(float));
+			}
+		}
+	}
+
+	Free();
+	Data = NewData;
+	NumStreams = InNumStreams;
+	Capacity = NewCapacity;
+	return true;
+}
+
+void FParticleSoAData::Free()
+{
+	if (Data)
+	{
+		_aligned_free(Data);
+		Data = nullptr;
+	}
+	NumStreams = 0;
+	Capacity = 0;
+}
+
+void FParticleSoAData::Scatter(int32 Index, const uint8* ParticleBase)
+{
+	const uint32* Src = reinterpret_cast<const uint32*>(ParticleBase);
+	uint32* Dst = reinterpret_cast<uint32*>(Data) + Index;
+	for (int32 Stream = 0; Stream < NumStreams; ++Stream)
+	{
+		Dst[static_cast<size_t>(Stream) * Capacity] = Src[Stream];
+	}
+}
+
+void FParticleSoAData::Gather(int32 Index, uint8* OutParticleBase, int32 NumBytes) const
+{
+	const int32 NumWords = FMath::Min(NumBytes >> 2, NumStreams);
+	const uint32* Src = reinterpret_cast<const uint32*>(Data) + Index;
+	uint32* Dst = reinterpret_cast<uint32*>(OutParticleBase);
+	for (int32 Stream = 0; Stream < NumWords; ++Stream)
+	{
+		Dst[Stream] = Src[static_cast<size_t>(Stream) * Capacity];
+	}
+}
+
+void FParticleSoAData::MoveSlot(int32 From, int32 To)
+{
+	if (From == To)
+	{
+		return;
+	}
+
+	uint32* Words = reinterpret_cast<uint32*>(Data);
+	for (int32 Stream = 0; Stream < NumStreams; ++Stream)
+	{
+		uint32* StreamWords = Words + static_cast<size_t>(Stream) * Capacity;
+		StreamWords[To] = StreamWords[From];
+	}
+}
+
+void FParticleSoAData::GatherBaseParticles(uint8* OutData, int32 Stride, int32 Count) const
+{
+	// 스트림 단위로 순차 읽기 → 파티클 단위로 흩어 쓰기
+	const int32 NumWords = FMath::Min(static_cast<int32>(sizeof(FBaseParticle) / 4), NumStreams);
+	for (int32 Word = 0; Word < NumWords; ++Word)
+	{
+		const uint32* Src = reinterpret_cast<const uint32*>(Data) + static_cast<size_t>(Word) * Capacity;
+		uint8* Dst = OutData + Word * 4;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			*reinterpret_cast<uint32*>(Dst + static_cast<size_t>(i) * Stride) = Src[i];
+		}
+	}
+}
+
+namespace ParticleSoA
+{
+	void IntegrateBase(FParticleSoAData& Particles, int32 Count, float DeltaTime)
+	{
+		float* RelativeTime = PARTICLE_SOA_STREAM(Particles, RelativeTime);
+		const float* OneOverMaxLifetime = PARTICLE_SOA_STREAM(Particles, OneOverMaxLifetime);
+
+		float* LocX = PARTICLE_SOA_STREAM(Particles, Location);
+		float* LocY = LocX + Particles.Capacity;
+		float* LocZ = LocY + Particles.Capacity;
+		float* OldX = PARTICLE_SOA_STREAM(Particles, OldLocation);
+		float* OldY = OldX + Particles.Capacity;
+		float* OldZ = OldY + Particles.Capacity;
+		const float* VelX = PARTICLE_SOA_STREAM(Particles, Velocity);
+		const float* VelY = VelX + Particles.Capacity;
+		const float* VelZ = VelY + Particles.Capacity;
+
+		float* Rotation = PARTICLE_SOA_STREAM(Particles, Rotation);
+		const float* RotationRate = PARTICLE_SOA_STREAM(Particles, RotationRate);
+		uint32* Flags = Particles.GetBitStream(static_cast<int32>(offsetof(FBaseParticle, Flags)));
+
+		const __m128 Dt = _mm_set1_ps(DeltaTime);
+		const __m128i ClearJustSpawned = _mm_set1_epi32(~STATE_Particle_JustSpawned);
+
+		const int32 Packed = PackedCount(Count);
+		for (int32 i = 0; i < Packed; i += 4)
+		{
+			// 수명 (AoS와 같은 연산 순서: RelativeTime += DeltaTime * OneOverMaxLifetime)
+			_mm_store_ps(RelativeTime + i, _mm_add_ps(_mm_load_ps(RelativeTime + i), _mm_mul_ps(Dt, _mm_load_ps(OneOverMaxLifetime + i))));
+
+			// 이전 위치 저장 후 적분
+			const __m128 X = _mm_load_ps(LocX + i);
+			const __m128 Y = _mm_load_ps(LocY + i);
+			const __m128 Z = _mm_load_ps(LocZ + i);
+			_mm_store_ps(OldX + i, X);
+			_mm_store_ps(OldY + i, Y);
+			_mm_store_ps(OldZ + i, Z);
+			_mm_store_ps(LocX + i, _mm_add_ps(X, _mm_mul_ps(_mm_load_ps(VelX + i), Dt)));
+			_mm_store_ps(LocY + i, _mm_add_ps(Y, _mm_mul_ps(_mm_load_ps(VelY + i), Dt)));
+			_mm_store_ps(LocZ + i, _mm_add_ps(Z, _mm_mul_ps(_mm_load_ps(VelZ + i), Dt)));
+
+			// 회전
+			_mm_store_ps(Rotation + i, _mm_add_ps(_mm_load_ps(Rotation + i), _mm_mul_ps(_mm_load_ps(RotationRate + i), Dt)));
+
+			// 방금 생성 플래그 제거
+			__m128i* FlagPtr = reinterpret_cast<__m128i*>(Flags + i);
+			_mm_store_si128(FlagPtr, _mm_and_si128(_mm_load_si128(FlagPtr), ClearJustSpawned));
+		}
+	}
+
+	int32 KillExpired(FParticleSoAData& Particles, int32 Count)
+	{
+		if (Count <= 0)
+		{
+			return 0;
+		}
+
+		const float* RelativeTime = PARTICLE_SOA_STREAM(Particles, RelativeTime);
+		const __m128 One = _mm_set1_ps(1.0f);
+
+		// 4개 블록 단위로 위에서부터 검사, 만료된 레인만 역순으로 swap-remove
+		// 옮겨오는 마지막 파티클은 이미 검사를 통과한 것이므로 다시 볼 필요가 없다 (AoS 역방향 루프와 같은 결과)
+		int32 Num = Count;
+		for (int32 Block = (Count - 1) & ~3; Block >= 0; Block -= 4)
+		{
+			int32 Mask = _mm_movemask_ps(_mm_cmpge_ps(_mm_load_ps(RelativeTime + Block), One));
+			const int32 ValidLanes = FMath::Min(4, Count - Block);
+			Mask &= (1 << ValidLanes) - 1;
+
+			for (int32 Lane = 3; Lane >= 0 && Mask; --Lane)
+			{
+				if (Mask & (1 << Lane))
+				{
+					Particles.MoveSlot(Num - 1, Block + Lane);
+					--Num;
+					Mask &= ~(1 << Lane);
+				}
+			}
+		}
+		return Num;
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <immintrin.h>
+#include "ParticleDefinitions.h"
+
+/**
+ * SoA 파티클 저장소 (UParticleModuleRequired::bUseSoALayout으로 켜는 선택 모드)
+ *
+ * 파티클 하나(FBaseParticle + 모듈 페이로드, ParticleStride 바이트)를 4바이트 워드 단위로 쪼개
+ * 워드마다 별도 스트림을 둔다. 스트림 번호 = AoS에서의 바이트 오프셋 / 4 이므로
+ * offsetof(FBaseParticle, ...)나 PayloadOffset + ModuleOffsetInParticle을 그대로 스트림 주소로 쓸 수 있다.
+ *
+ * - 활성 파티클은 항상 [0, Num)에 빽빽하게 있고, 제거는 마지막 파티클을 빈 자리로 옮긴다 (swap-remove).
+ * - 용량은 4의 배수 → 모든 스트림이 16바이트 정렬이고 SSE 커널이 꼬리 처리 없이 4개씩 돈다.
+ *   (Num 뒤 남는 레인도 같이 계산되지만 유효 범위 밖이라 결과를 쓰지 않는 것과 같다)
+ * - Flags처럼 정수 필드도 비트 그대로 float 스트림에 담긴다 (산술 없이 복사/비트 연산만 한다).
+ */
+struct FParticleSoAData
+{
+	float* Data = nullptr;   // [스트림 0 | 스트림 1 | ...], 스트림 하나 = Capacity개
+	int32 NumStreams = 0;    // ParticleStride / 4
+	int32 Capacity = 0;      // 4의 배수
+
+	FParticleSoAData() = default;
+	~FParticleSoAData() { Free(); }
+
+	FParticleSoAData(const FParticleSoAData&) = delete;
+	FParticleSoAData& operator=(const FParticleSoAData&) = delete;
+
+	/**
+	 * 스트림 수/용량을 다시 잡는다
+	 * @param NumToPreserve 앞쪽에서 보존할 파티클 수 (스트림 수가 같을 때만 보존)
+	 */
+	bool Alloc(int32 InNumStreams, int32 InCapacity, int32 NumToPreserve);
+	void Free();
+
+	float* GetStream(int32 ByteOffset) const { return Data + static_cast<size_t>(ByteOffset >> 2) * Capacity; }
+	uint32* GetBitStream(int32 ByteOffset) const { return reinterpret_cast<uint32*>(GetStream(ByteOffset)); }
+
+	// AoS 파티클 한 개 ↔ SoA 슬롯 (스폰/조회용)
+	void Scatter(int32 Index, const uint8* ParticleBase);
+	void Gather(int32 Index, uint8* OutParticleBase, int32 NumBytes) const;
+
+	// 슬롯 From의 모든 스트림을 To로 복사 (swap-remove)
+	void MoveSlot(int32 From, int32 To);
+
+	// [0, Count)를 FBaseParticle 배열(Stride 간격)로 펼친다 (렌더 데이터용)
+	void GatherBaseParticles(uint8* OutData, int32 Stride, int32 Count) const;
+};
+
+// FBaseParticle 필드 → 스트림 포인터
+#define PARTICLE_SOA_STREAM(Particles, Field) ((Particles).GetStream(static_cast<int32>(offsetof(FBaseParticle, Field))))
+
+namespace ParticleSoA
+{
+	// 4의 배수로 올림 (SSE 커널 반복 횟수)
+	inline int32 PackedCount(int32 Count) { return (Count + 3) & ~3; }
+
+	/**
+	 * 기본 적분 (AoS UpdateParticles의 PHASE 1)
+	 * RelativeTime += dt / Lifetime, OldLocation = Location, Location += Velocity * dt,
+	 * Rotation += RotationRate * dt, JustSpawned 플래그 제거
+	 * SoA 모드에는 Freeze 계열 플래그를 세우는 모듈(충돌 등)이 올 수 없으므로 파티클별 분기가 없다.
+	 */
+	void IntegrateBase(FParticleSoAData& Particles, int32 Count, float DeltaTime);
+
+	/**
+	 * 수명이 다한(RelativeTime >= 1) 파티클 제거, AoS와 같은 역방향 swap-remove 순서
+	 * @return 남은 파티클 수
+	 */
+	int32 KillExpired(FParticleSoAData& Particles, int32 Count);
+
+	// FMath::Lerp와 같은 식 (A + (B - A) * T)
+	inline __m128 Lerp(__m128 A, __m128 B, __m128 T)
+	{
+		return _mm_add_ps(A, _mm_mul_ps(_mm_sub_ps(B, A), T));
+	}
+
+	// 커브 샘플 위치가 파티클마다 달라(베이크된 룩업 테이블도 gather) 레인별로 스칼라 평가하고 결과만 모은다
+	template<typename CurveType>
+	inline void EvalVectorCurve4(const CurveType& Curve, const float* Time, __m128& OutX, __m128& OutY, __m128& OutZ)
+	{
+		alignas(16) float X[4], Y[4], Z[4];
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const FVector Value = Curve.Eval(Time[Lane]);
+			X[Lane] = Value.X;
+			Y[Lane] = Value.Y;
+			Z[Lane] = Value.Z;
+		}
+		OutX = _mm_load_ps(X);
+		OutY = _mm_load_ps(Y);
+		OutZ = _mm_load_ps(Z);
+	}
+
+	template<typename CurveType>
+	inline __m128 EvalFloatCurve4(const CurveType& Curve, const float* Time)
+	{
+		return _mm_set_ps(Curve.Eval(Time[3]), Curve.Eval(Time[2]), Curve.Eval(Time[1]), Curve.Eval(Time[0]));
+	}
+}
@@ -0,0 +1,212 @@
+#include "pch.h"
+#include "ParticleSort.h"
+
+namespace
+{
+	// 역순 쌍 비율이 이보다 높으면 삽입 정렬을 시도하지 않는다
+	constexpr int32 MaxDescentsRatio = 16;      // Count / 16
+
+	// 삽입 정렬 이동 예산 (원소당), 넘으면 기수 정렬로 넘어간다
+	constexpr int32 InsertionMovesPerElement = 8;
+
+	uint32* AllocFrameScratch(int32 Count)
+	{
+		return static_cast<uint32*>(FFrameMemory::GetInstance().GetCurrentArena().Allocate(static_cast<SIZE_T>(Count) * sizeof(uint32), 16));
+	}
+
+	// 예산 안에서 삽입 정렬, 다 끝냈으면 true (중간에 멈춰도 순열은 유지됨)
+	bool InsertionSortWithBudget(uint32* Keys, uint32* Values, int32 Count, int64 MoveBudget)
+	{
+		for (int32 i = 1; i < Count; ++i)
+		{
+			const uint32 Key = Keys[i];
+			if (Keys[i - 1] <= Key)
+			{
+				continue;
+			}
+
+			const uint32 Value = Values[i];
+			int32 j = i;
+			while (j > 0 && Keys[j - 1] > Key)
+			{
+				Keys[j] = Keys[j - 1];
+				Values[j] = Values[j - 1];
+				--j;
+			}
+			Keys[j] = Key;
+			Values[j] = Value;
+
+			MoveBudget -= (i - j);
+			if (MoveBudget < 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void RadixSort(uint32* Keys, uint32* Values, int32 Count)
+	{
+		// 4개 바이트의 히스토그램을 한 번에 계산
+		uint32 Histogram[4][256] = {};
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const uint32 Key = Keys[i];
+			++Histogram[0][Key & 0xFF];
+			++Histogram[1][(Key >> 8) & 0xFF];
+			++Histogram[2][(Key >> 16) & 0xFF];
+			++Histogram[3][Key >> 24];
+		}
+
+		uint32* KeyScratch = AllocFrameScratch(Count);
+		uint32* ValueScratch = AllocFrameScratch(Count);
+
+		uint32* SrcKeys = Keys;
+		uint32* SrcValues = Values;
+		uint32* DstKeys = KeyScratch;
+		uint32* DstValues = ValueScratch;
+
+		for (int32 Pass = 0; Pass < 4; ++Pass)
+		{
+			uint32* Counts = Histogram[Pass];
+			const uint32 Shift = Pass * 8;
+
+			// 모든 키의 이 바이트가 같으면 순서가 바뀌지 않는다 (깊이 범위가 좁으면 상위 바이트가 대부분 같음)
+			if (Counts[(SrcKeys[0] >> Shift) & 0xFF] == static_cast<uint32>(Count))
+			{
+				continue;
+			}
+
+			uint32 Offset = 0;
+			for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+			{
+				const uint32 BucketCount = Counts[Bucket];
+				Counts[Bucket] = Offset;
+				Offset += BucketCount;
+			}
+
+			for (int32 i = 0; i < Count; ++i)
+			{
+				const uint32 Key = SrcKeys[i];
+				const uint32 Dst = Counts[(Key >> Shift) & 0xFF]++;
+				DstKeys[Dst] = Key;
+				DstValues[Dst] = SrcValues[i];
+			}
+
+			std::swap(SrcKeys, DstKeys);
+			std::swap(SrcValues, DstValues);
+		}
+
+		// 홀수 번 섞었으면 결과가 임시 버퍼에 있다
+		if (SrcKeys != Keys)
+		{
+			memcpy(Keys, SrcKeys, static_cast<size_t>(Count) * sizeof(uint32));
+			memcpy(Values, SrcValues, static_cast<size_t>(Count) * sizeof(uint32));
+		}
+	}
+}
+
+namespace ParticleSort
+{
+	bool SortKeyValues(uint32* Keys, uint32* Values, int32 Count)
+	{
+		if (Count <= 1)
+		{
+			return false;
+		}
+
+		// 지난 프레임 순서에서 시작했다면 역순 쌍이 거의 없다
+		int32 NumDescents = 0;
+		for (int32 i = 1; i < Count; ++i)
+		{
+			NumDescents += (Keys[i - 1] > Keys[i]) ? 1 : 0;
+		}
+
+		if (NumDescents == 0)
+		{
+			return false;
+		}
+
+		if (NumDescents <= Count / MaxDescentsRatio &&
+			InsertionSortWithBudget(Keys, Values, Count, static_cast<int64>(Count) * InsertionMovesPerElement))
+		{
+			return false;
+		}
+
+		RadixSort(Keys, Values, Count);
+		return true;
+	}
+
+	void MergeSortedRuns(uint32* Keys, uint32* Values, const int32* RunStarts, int32 NumRuns, int32 Count)
+	{
+		if (NumRuns <= 1 || Count <= 1)
+		{
+			return;
+		}
+
+		uint32* KeyScratch = AllocFrameScratch(Count);
+		uint32* ValueScratch = AllocFrameScratch(Count);
+
+		// 구간 경계 (NumRuns + 1개), 병합할 때마다 절반으로 줄어든다
+		int32* Bounds = static_cast<int32*>(FFrameMemory::GetInstance().GetCurrentArena().Allocate(static_cast<SIZE_T>(NumRuns + 1) * sizeof(int32), alignof(int32)));
+		memcpy(Bounds, RunStarts, static_cast<size_t>(NumRuns) * sizeof(int32));
+		Bounds[NumRuns] = Count;
+
+		uint32* SrcKeys = Keys;
+		uint32* SrcValues = Values;
+		uint32* DstKeys = KeyScratch;
+		uint32* DstValues = ValueScratch;
+
+		// 인접한 두 구간씩 병합 (O(N log NumRuns))
+		while (NumRuns > 1)
+		{
+			int32 NewNumRuns = 0;
+			for (int32 Run = 0; Run < NumRuns; Run += 2)
+			{
+				const int32 Begin = Bounds[Run];
+				const int32 Mid = Bounds[FMath::Min(Run + 1, NumRuns)];
+				const int32 End = Bounds[FMath::Min(Run + 2, NumRuns)];
+
+				int32 A = Begin;
+				int32 B = Mid;
+				int32 Out = Begin;
+				while (A < Mid && B < End)
+				{
+					// 같은 키면 앞 구간 먼저 (안정)
+					const bool bTakeB = SrcKeys[B] < SrcKeys[A];
+					const int32 From = bTakeB ? B++ : A++;
+					DstKeys[Out] = SrcKeys[From];
+					DstValues[Out] = SrcValues[From];
+					++Out;
+				}
+				while (A < Mid)
+				{
+					DstKeys[Out] = SrcKeys[A];
+					DstValues[Out] = SrcValues[A];
+					++Out;
+					++A;
+				}
+				while (B < End)
+				{
+					DstKeys[Out] = SrcKeys[B];
+					DstValues[Out] = SrcValues[B];
+					++Out;
+					++B;
+				}
+
+				Bounds[NewNumRuns++] = Begin;
+			}
+			Bounds[NewNumRuns] = Count;
+			NumRuns = NewNumRuns;
+
+			std::swap(SrcKeys, DstKeys);
+			std::swap(SrcValues, DstValues);
+		}
+
+		if (SrcKeys != Keys)
+		{
+			memcpy(Keys, SrcKeys, static_cast<size_t>(Count) * sizeof(uint32));
+			memcpy(Values, SrcValues, static_cast<size_t>(Count) * sizeof(uint32));
+		}
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstring>
+
+/**
+ * 파티클 정렬 유틸리티 (반투명 스프라이트 그리기 순서)
+ *
+ * 비교 정렬 대신 파티클마다 32비트 키를 한 번만 계산하고 (Key, Value) 쌍을 정렬한다.
+ * - 키는 float 비트를 부호 없는 정수 순서로 바꾼 것이라 정수 비교 = 실수 비교
+ * - 입력이 지난 프레임 순서로 거의 정렬돼 있으면 삽입 정렬로 끝내고,
+ *   아니면 8비트 4패스 LSD 기수 정렬 (모든 키가 같은 바이트인 패스는 건너뜀)
+ * - 두 경로 모두 안정 정렬이다 (같은 키는 입력 순서 유지)
+ */
+namespace ParticleSort
+{
+	// float → 오름차순 정렬 키 (음수는 모든 비트 반전, 양수는 부호 비트만 세움)
+	inline uint32 FloatToSortKey(float Value)
+	{
+		uint32 Bits;
+		memcpy(&Bits, &Value, sizeof(Bits));
+		const uint32 Mask = static_cast<uint32>(-static_cast<int32>(Bits >> 31)) | 0x80000000u;
+		return Bits ^ Mask;
+	}
+
+	// 큰 값이 먼저 오는 키 (먼 것/오래된 것부터 그리기)
+	inline uint32 FloatToDescendingSortKey(float Value)
+	{
+		return ~FloatToSortKey(Value);
+	}
+
+	/**
+	 * (Keys[i], Values[i]) 쌍을 키 오름차순으로 안정 정렬 (제자리, 임시 버퍼는 프레임 아레나)
+	 * @return 기수 정렬을 수행했으면 true (거의 정렬된 입력이라 삽입 정렬로 끝났으면 false)
+	 */
+	bool SortKeyValues(uint32* Keys, uint32* Values, int32 Count);
+
+	/**
+	 * 각각 정렬된 구간 NumRuns개를 하나로 병합 (안정, 앞 구간 우선)
+	 * @param RunStarts 구간 시작 인덱스 (오름차순, RunStarts[0] == 0), 마지막 구간은 Count까지
+	 */
+	void MergeSortedRuns(uint32* Keys, uint32* Values, const int32* RunStarts, int32 NumRuns, int32 Count);
+}
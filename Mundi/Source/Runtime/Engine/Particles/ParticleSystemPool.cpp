@@ -0,0 +1,227 @@
+#include "pch.h"
+#include "ParticleSystemPool.h"
+#include "ParticleSystemComponent.h"
+#include "World.h"
+#include "Actor.h"
+#include "ObjectFactory.h"
+
+FParticleSystemPool::FParticleSystemPool(UWorld* InWorld)
+	: World(InWorld)
+{
+}
+
+FParticleSystemPool::~FParticleSystemPool()
+{
+	// 보통은 월드가 액터를 먼저 정리하면서 전부 빠져 있지만, 남은 컴포넌트가 풀을 가리키지 않게 끊어둔다
+	for (auto& Pair : Pools)
+	{
+		for (UParticleSystemComponent* Component : Pair.second.Active)
+		{
+			Component->OwningPool = nullptr;
+		}
+		for (UParticleSystemComponent* Component : Pair.second.Free)
+		{
+			Component->OwningPool = nullptr;
+		}
+	}
+}
+
+UParticleSystemComponent* FParticleSystemPool::SpawnAtLocation(UParticleSystem* Template, const FTransform& Transform)
+{
+	if (!Template || !World)
+	{
+		return nullptr;
+	}
+
+	FTemplatePool& Pool = FindOrAddPool(Template);
+	UParticleSystemComponent* Component = nullptr;
+
+	if (Pool.Limits.MaxActive > 0 && Pool.Active.Num() >= Pool.Limits.MaxActive)
+	{
+		if (Pool.Limits.CullPolicy == EParticlePoolCullPolicy::RejectNew)
+		{
+			return nullptr;
+		}
+
+		// 가장 오래 재생 중인 것을 새 요청에 넘긴다 (반납 → 재사용과 같은 경로)
+		Component = Pool.Active[0];
+		Pool.Active.RemoveAt(0);
+		Component->EnterPooledState();
+	}
+	else if (Pool.Free.Num() > 0)
+	{
+		Component = Pool.Free.Last();
+		Pool.Free.pop_back();
+	}
+
+	if (Component)
+	{
+		if (AActor* Owner = Component->GetOwner())
+		{
+			Owner->SetActorTransform(Transform);
+		}
+
+		// 기존 이미터 인스턴스를 제자리에서 재초기화 (파티클 버퍼 재할당 없음)
+		Component->ActivateSystem();
+	}
+	else
+	{
+		Component = CreateComponent(Template, Transform);
+		if (!Component)
+		{
+			return nullptr;
+		}
+	}
+
+	Pool.Active.Add(Component);
+	return Component;
+}
+
+void FParticleSystemPool::Release(UParticleSystemComponent* Component)
+{
+	if (!Component || Component->OwningPool != this)
+	{
+		return;
+	}
+
+	FTemplatePool* Pool = Pools.Find(Component->PoolTemplate);
+	if (!Pool || !Pool->Active.Remove(Component))
+	{
+		return;
+	}
+
+	if (Pool->Free.Num() >= Pool->Limits.MaxFree)
+	{
+		DestroyComponent(Component);
+		return;
+	}
+
+	Component->EnterPooledState();
+	Pool->Free.Add(Component);
+}
+
+void FParticleSystemPool::Prewarm(UParticleSystem* Template, int32 Count)
+{
+	if (!Template || !World)
+	{
+		return;
+	}
+
+	FTemplatePool& Pool = FindOrAddPool(Template);
+	Count = FMath::Min(Count, Pool.Limits.MaxFree);
+
+	while (Pool.Free.Num() < Count)
+	{
+		UParticleSystemComponent* Component = CreateComponent(Template, FTransform());
+		if (!Component)
+		{
+			break;
+		}
+		Component->EnterPooledState();
+		Pool.Free.Add(Component);
+	}
+}
+
+void FParticleSystemPool::SetLimits(UParticleSystem* Template, const FParticlePoolLimits& Limits)
+{
+	if (!Template)
+	{
+		return;
+	}
+
+	FTemplatePool& Pool = FindOrAddPool(Template);
+	Pool.Limits = Limits;
+	Pool.bCustomLimits = true;
+
+	// 보관 수가 줄었으면 넘치는 것부터 정리
+	while (Pool.Free.Num() > FMath::Max(Limits.MaxFree, 0))
+	{
+		UParticleSystemComponent* Component = Pool.Free.Last();
+		Pool.Free.pop_back();
+		DestroyComponent(Component);
+	}
+}
+
+int32 FParticleSystemPool::GetNumActive(UParticleSystem* Template) const
+{
+	const FTemplatePool* Pool = Pools.Find(Template);
+	return Pool ? Pool->Active.Num() : 0;
+}
+
+int32 FParticleSystemPool::GetNumFree(UParticleSystem* Template) const
+{
+	const FTemplatePool* Pool = Pools.Find(Template);
+	return Pool ? Pool->Free.Num() : 0;
+}
+
+void FParticleSystemPool::NotifyComponentDestroyed(UParticleSystemComponent* Component)
+{
+	if (!Component || Component->OwningPool != this)
+	{
+		return;
+	}
+
+	if (FTemplatePool* Pool = Pools.Find(Component->PoolTemplate))
+	{
+		if (!Pool->Active.Remove(Component))
+		{
+			Pool->Free.Remove(Component);
+		}
+	}
+
+	Component->OwningPool = nullptr;
+	Component->PoolTemplate = nullptr;
+}
+
+FParticleSystemPool::FTemplatePool& FParticleSystemPool::FindOrAddPool(UParticleSystem* Template)
+{
+	FTemplatePool& Pool = Pools[Template];
+	if (!Pool.bCustomLimits)
+	{
+		Pool.Limits = DefaultLimits;
+	}
+	return Pool;
+}
+
+UParticleSystemComponent* FParticleSystemPool::CreateComponent(UParticleSystem* Template, const FTransform& Transform)
+{
+	AActor* Actor = World->SpawnActor<AActor>(Transform);
+	if (!Actor)
+	{
+		return nullptr;
+	}
+	Actor->SetHiddenInOutliner(true);
+
+	UParticleSystemComponent* Component = NewObject<UParticleSystemComponent>();
+	Component->bAutoActivate = false;
+	Actor->AddOwnedComponent(Component);
+
+	// 등록 전에 템플릿을 넣어 이미터 인스턴스를 만든다 (OnRegister가 디버그 템플릿을 만들지 않도록)
+	Component->SetTemplate(Template);
+	Component->RegisterComponent(World);
+	if (World->bPie)
+	{
+		Component->InitializeComponent();
+		Component->BeginPlay();
+	}
+
+	// 루트 컴포넌트가 방금 생겼으므로 트랜스폼을 다시 적용
+	Actor->SetActorTransform(Transform);
+
+	Component->OwningPool = this;
+	Component->PoolTemplate = Template;
+	return Component;
+}
+
+void FParticleSystemPool::DestroyComponent(UParticleSystemComponent* Component)
+{
+	// 풀에서 이미 뺐으므로 OnUnregister에서 다시 찾지 않게 끊는다
+	Component->EnterPooledState();
+	Component->OwningPool = nullptr;
+	Component->PoolTemplate = nullptr;
+
+	if (AActor* Owner = Component->GetOwner())
+	{
+		Owner->Destroy();
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+class UWorld;
+class UParticleSystem;
+class UParticleSystemComponent;
+struct FTransform;
+
+// 템플릿별 동시 재생 수가 MaxActive에 도달했을 때의 처리
+enum class EParticlePoolCullPolicy : uint8
+{
+	RecycleOldest,  // 가장 오래 재생 중인 컴포넌트를 새 위치에서 처음부터 다시 재생
+	RejectNew,      // 새 요청을 무시 (nullptr 반환)
+};
+
+struct FParticlePoolLimits
+{
+	int32 MaxActive = 32;   // 템플릿당 동시 재생 수 (0이면 제한 없음)
+	int32 MaxFree = 8;      // 반납 후 보관할 수 (넘치는 컴포넌트는 액터째 파괴)
+	EParticlePoolCullPolicy CullPolicy = EParticlePoolCullPolicy::RecycleOldest;
+};
+
+/**
+ * FParticleSystemPool
+ * 일회성 이펙트(피격, 폭발 등)용 월드 단위 파티클 시스템 컴포넌트 풀입니다.
+ *
+ * 매번 액터/컴포넌트/이미터 인스턴스를 만들고 지우는 대신, UParticleSystem 템플릿별로
+ * 재생이 끝난 컴포넌트를 보관했다가 다음 요청에 제자리에서 재초기화해 씁니다.
+ * - 반납된 컴포넌트는 이미터 인스턴스와 파티클 버퍼(지난 재생에서 늘어난 크기 그대로)를 유지한 채 틱/렌더를 건너뜁니다.
+ * - 풀에서 꺼낸 컴포넌트는 모든 이미터가 끝나고 파티클이 없어지면 스스로 반납됩니다 (무한 루프 이미터는 Release로 직접 반납).
+ * - 컴포넌트가 다른 이유로 파괴되면(레벨 정리 등) OnUnregister에서 풀 목록에서 빠집니다.
+ */
+class FParticleSystemPool
+{
+public:
+	explicit FParticleSystemPool(UWorld* InWorld);
+	~FParticleSystemPool();
+
+	FParticleSystemPool(const FParticleSystemPool&) = delete;
+	FParticleSystemPool& operator=(const FParticleSystemPool&) = delete;
+
+	/**
+	 * 템플릿을 주어진 위치에서 한 번 재생 (반납된 컴포넌트가 있으면 재사용, 없으면 새로 생성)
+	 * @return 재생 중인 컴포넌트 (RejectNew 정책으로 거부되면 nullptr), 반납 후에는 다른 요청에 재사용되므로 보관하지 말 것
+	 */
+	UParticleSystemComponent* SpawnAtLocation(UParticleSystem* Template, const FTransform& Transform);
+
+	// 재생 중인 컴포넌트를 풀로 반납 (재생이 끝나면 자동으로 호출됨)
+	void Release(UParticleSystemComponent* Component);
+
+	// 반납된 컴포넌트를 Count개까지 미리 만들어 둠 (첫 재생 때의 할당 스파이크 방지)
+	void Prewarm(UParticleSystem* Template, int32 Count);
+
+	// 템플릿별 제한 (설정하지 않은 템플릿은 DefaultLimits 사용)
+	void SetLimits(UParticleSystem* Template, const FParticlePoolLimits& Limits);
+	void SetDefaultLimits(const FParticlePoolLimits& Limits) { DefaultLimits = Limits; }
+
+	int32 GetNumActive(UParticleSystem* Template) const;
+	int32 GetNumFree(UParticleSystem* Template) const;
+
+	// 컴포넌트 해제 시 호출 (풀 목록에서 제외)
+	void NotifyComponentDestroyed(UParticleSystemComponent* Component);
+
+private:
+	struct FTemplatePool
+	{
+		TArray<UParticleSystemComponent*> Active;  // 재생 시작 순서 (0번이 가장 오래됨)
+		TArray<UParticleSystemComponent*> Free;
+		FParticlePoolLimits Limits;
+		bool bCustomLimits = false;
+	};
+
+	FTemplatePool& FindOrAddPool(UParticleSystem* Template);
+	UParticleSystemComponent* CreateComponent(UParticleSystem* Template, const FTransform& Transform);
+	void DestroyComponent(UParticleSystemComponent* Component);
+
+	UWorld* World = nullptr;
+	FParticlePoolLimits DefaultLimits;
+	TMap<UParticleSystem*, FTemplatePool> Pools;
+};
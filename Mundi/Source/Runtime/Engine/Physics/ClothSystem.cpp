@@ -4,6 +4,7 @@
 #include <NvCloth/Solver.h>
 #include <NvCloth/Callbacks.h>
 #include <iostream>
+#include "JobSystem.h"
 
 // ========== CPU 멀티스레드 시뮬레이션 ==========
 // NvCloth CPU Factory는 멀티스레드로 최적화되어 있어
@@ -150,17 +151,17 @@ void FClothSystem::Update(float DeltaTime)
     {
         // ===== Chunk 기반 시뮬레이션 =====
         // Chunk: Solver가 작업을 분할한 단위 (병렬 처리를 위해)
-        //   - 단일 스레드: for 루프로 순차 처리
-        //   - 멀티 스레드: 각 Chunk를 별도 스레드에서 병렬 처리 가능
+        //   - 엔진 잡 시스템 워커 + 게임 스레드에서 병렬 처리 (별도 스레드 풀 없이 물리/엔진 잡과 코어를 나눠 씀)
         int chunkCount = Solver->getSimulationChunkCount();
-        for (int i = 0; i < chunkCount; i++)
+        nv::cloth::Solver* ClothSolver = Solver;
+        ParallelFor(chunkCount, [ClothSolver](int32 ChunkIndex)
         {
             // ===== Solver::simulateChunk() 호출 =====
             // @brief 특정 Chunk의 시뮬레이션을 수행합니다
             // @param chunkIdx: Chunk 인덱스 (0 ~ chunkCount-1)
-            // @note 이 함수는 병렬로 호출 가능하므로 멀티스레드 최적화에 유용
-            Solver->simulateChunk(i);
-        }
+            // @note 서로 다른 Chunk는 병렬로 호출 가능
+            ClothSolver->simulateChunk(ChunkIndex);
+        });
 
         // ===== Solver::endSimulation() 호출 =====
         // @brief 시뮬레이션을 종료하고 결과를 각 Cloth에 적용합니다
@@ -40,6 +40,7 @@ public:
 //
 // === CPU 멀티스레드 시뮬레이션 ===
 // - CPU Factory 사용 (멀티스레드 최적화)
+// - Solver 청크는 엔진 잡 시스템 워커에서 병렬 실행 (전용 스레드 풀 없음)
 // - GPU↔CPU 데이터 전송 오버헤드 없음
 // - 40,000 정점 기준 실시간 성능 보장
 //
@@ -51,7 +52,7 @@ public:
 // === 시뮬레이션 루프 ===
 // 1. Update(DeltaTime) 호출 (매 프레임)
 // 2. Solver::beginSimulation()
-// 3. Solver::simulateChunk() (멀티스레드 병렬 처리)
+// 3. Solver::simulateChunk() (ParallelFor로 잡 시스템 워커에서 병렬 처리)
 // 4. Solver::endSimulation()
 //
 // ========================================================================================================
@@ -0,0 +1,20 @@
+﻿#include "pch.h"
+#include "PhysXJobDispatcher.h"
+
+void FPhysXJobDispatcher::submitTask(physx::PxBaseTask& Task)
+{
+	physx::PxBaseTask* TaskPtr = &Task;
+	GJobSystem.Launch([TaskPtr]()
+	{
+		// release()가 이 태스크를 기다리던 후속 태스크를 다시 submitTask로 제출함
+		TaskPtr->run();
+		TaskPtr->release();
+	}, {}, Priority);
+}
+
+uint32_t FPhysXJobDispatcher::getWorkerCount() const
+{
+	// 0이면 PhysX가 태스크를 잘게 나누지 않음 (submitTask도 제출한 스레드에서 바로 실행됨)
+	const FJobSystem& JobSystem = GJobSystem;
+	return JobSystem.IsInitialized() ? static_cast<uint32_t>(JobSystem.GetNumWorkers()) : 0u;
+}
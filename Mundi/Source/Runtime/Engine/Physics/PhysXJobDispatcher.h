@@ -0,0 +1,22 @@
+﻿#pragma once
+#include "JobSystem.h"
+
+/**
+ * FPhysXJobDispatcher
+ * PhysX 태스크를 엔진 잡 시스템 워커에서 실행하는 PxCpuDispatcher
+ *
+ * PxDefaultCpuDispatcher가 따로 스레드 풀을 만들면 잡 시스템 워커, 천 시뮬레이션과 코어를 두고 경쟁하므로
+ * 모든 태스크를 잡 시스템에 High 우선순위로 넘긴다 (동기화 지점에서 기다리는 스텝이 일반 잡 뒤로 밀리지 않게).
+ * 워커가 없으면 PxDefaultCpuDispatcher(0)처럼 제출한 스레드에서 바로 실행한다.
+ */
+class FPhysXJobDispatcher : public physx::PxCpuDispatcher
+{
+public:
+	explicit FPhysXJobDispatcher(EJobPriority InPriority = EJobPriority::High) : Priority(InPriority) {}
+
+	void submitTask(physx::PxBaseTask& Task) override;
+	uint32_t getWorkerCount() const override;
+
+private:
+	EJobPriority Priority;
+};
@@ -10,6 +10,8 @@
 #include "PhysicsSystem.h"
 #include "SkeletalMeshComponent.h"
 #include "RagdollStats.h"
+#include "PlatformTime.h"
+#include "JobSystem.h"
 
 
 #define SCOPED_READ_LOCK(Scene) PxSceneReadLock ScopedReadLock(Scene);
@@ -23,6 +25,15 @@ FPhysicsScene::FPhysicsScene(PxScene* InScene) : Scene(InScene)
 
 FPhysicsScene::~FPhysicsScene()
 {
+	// 진행 중인 스텝이 끝나야 씬 객체를 해제할 수 있음
+	if (Scene)
+	{
+		WaitForSimulation();
+	}
+
+	// 대기 중인 씬 쿼리와 콜백 폐기 (Scene 해제 후 실행되지 않도록)
+	SceneQueries.Reset();
+
 	if (VehicleSDKInitialized)
 	{
 		ReleaseVehicleSDK();
@@ -116,6 +127,27 @@ void FPhysicsScene::Simulate(float DeltaTime)
 		DeltaTime = MaxFrameTime;
 	}
 
+	SimulationStats.Reset();
+
+	if (SimulationMode == EPhysicsSimulationMode::AsyncOneFrameLatency)
+	{
+		// 지난 틱에 시작한 스텝을 받고, 그동안(액터 틱 ~ 렌더링) 쌓인 명령/데스노트를 씬이 멈춘 지금 처리
+		if (bIsSimulated)
+		{
+			const uint64 WaitStart = FWindowsPlatformTime::Cycles64();
+			SimulationStats.OverlapTimeMS = FWindowsPlatformTime::ToMilliseconds(WaitStart - KickCycles);
+			FetchStep(true);
+			SimulationStats.FenceWaitTimeMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - WaitStart);
+		}
+		ProcessCommandQueue();
+		PendingDestroyInDeathNote();
+	}
+	else if (bIsSimulated)
+	{
+		// 동기화 지점을 거치지 않은 스텝 (모드 변경 직후, 월드 밖에서 직접 호출 등)
+		FetchAndUpdate();
+	}
+
 	LeftoverTime += DeltaTime;
 
 	constexpr int32 MaxSubSteps = 10;
@@ -127,24 +159,17 @@ void FPhysicsScene::Simulate(float DeltaTime)
 		LeftoverTime -= FixedDeltaTime;
 		CurrentStep++;
 
-		// 1. 물리 업데이트 전 처리
-		for (IPrePhysics* PrePhysics : PreUpdateList)
+		// 서브스테핑 중에는 이전 단계가 끝나야 PrePhysicsUpdate와 다음 단계를 계산할 수 있으므로
+		// 여기서 fetchResults를 통해 기다립니다. (Blocking)
+		if (bIsSimulated)
 		{
-			PrePhysics->PrePhysicsUpdate(FixedDeltaTime);
+			const uint64 WaitStart = FWindowsPlatformTime::Cycles64();
+			FetchStep(true);
+			PendingDestroyInDeathNote();
+			SimulationStats.BlockingStepTimeMS += FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - WaitStart);
 		}
 
-		// 2. 시뮬레이션 시작
-		Scene->simulate(FixedDeltaTime);
-		bIsSimulated = true; // 시뮬레이션 시작했으므로 true
-
-		// 3. 결과 대기 및 동기화 (Blocking)
-		// 서브스테핑 중에는 반드시 이전 단계가 끝나야 다음 단계를 계산할 수 있으므로
-		// 여기서 fetchResults를 통해 기다립니다.
-		FetchAndUpdate(); 
-       
-		// [삭제됨] bIsSimulated = true; 
-		// FetchAndUpdate 안에서 bIsSimulated가 false가 되었고, 
-		// PhysX도 Idle 상태가 되었으므로 이 상태가 맞습니다.
+		KickStep();
 	}
 
 	// 루프 제한으로 남은 시간 버림
@@ -152,6 +177,59 @@ void FPhysicsScene::Simulate(float DeltaTime)
 	{
 		LeftoverTime = 0.0f;
 	}
+
+	SimulationStats.SubStepCount = CurrentStep;
+
+	if (bIsSimulated)
+	{
+		if (SimulationMode == EPhysicsSimulationMode::Synchronous)
+		{
+			// 마지막 스텝도 바로 기다린다 (기존 방식)
+			const uint64 WaitStart = FWindowsPlatformTime::Cycles64();
+			FetchStep(true);
+			PendingDestroyInDeathNote();
+			SimulationStats.BlockingStepTimeMS += FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - WaitStart);
+		}
+		else
+		{
+			// 마지막 스텝은 워커가 계산하는 동안 게임 스레드가 틱을 진행
+			KickCycles = FWindowsPlatformTime::Cycles64();
+			SimulationStats.AsyncStepCount = 1;
+		}
+	}
+
+	if (SimulationMode == EPhysicsSimulationMode::AsyncOneFrameLatency)
+	{
+		// 받은 마지막 두 스텝 사이를 아직 시뮬레이션하지 못한 남은 시간 비율로 보간
+		ApplyInterpolatedPoses(LeftoverTime / FixedDeltaTime);
+	}
+
+	PublishSimulationStats();
+}
+
+void FPhysicsScene::SyncSimulation()
+{
+	// 지연 모드는 스텝을 다음 틱 Simulate에서 받는다 (명령/데스노트도 그때 처리)
+	if (SimulationMode == EPhysicsSimulationMode::AsyncOneFrameLatency)
+	{
+		return;
+	}
+
+	// 1. 틱 초반에 시작한 스텝 결과 반영 (액터 틱 중 쌓인 명령이 이 결과를 덮어쓰도록 명령보다 먼저)
+	if (bIsSimulated)
+	{
+		const uint64 WaitStart = FWindowsPlatformTime::Cycles64();
+		SimulationStats.OverlapTimeMS = FWindowsPlatformTime::ToMilliseconds(WaitStart - KickCycles);
+		FetchStep(true);
+		SimulationStats.FenceWaitTimeMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - WaitStart);
+		PublishSimulationStats();
+	}
+
+	// 2. ProcessCommandQueue를 먼저 실행해야 함
+	// (PendingDestroyInDeathNote에서 Actor가 삭제되기 전에
+	// CommandQueue의 명령들을 처리해야 삭제된 Actor에 접근하는 크래시 방지)
+	ProcessCommandQueue();
+	PendingDestroyInDeathNote();
 }
 
 void FPhysicsScene::FetchAndUpdate()
@@ -161,15 +239,110 @@ void FPhysicsScene::FetchAndUpdate()
 		return;
 	}
 
-    bIsSimulated = false;
+	FetchStep(true);
+
+	if (SimulationMode == EPhysicsSimulationMode::AsyncOneFrameLatency)
+	{
+		ApplyInterpolatedPoses(1.0f);
+	}
+
+	PendingDestroyInDeathNote();
+}
+
+void FPhysicsScene::WaitForSimulation()
+{
+	FetchStep(false);
+}
+
+void FPhysicsScene::SetSimulationMode(EPhysicsSimulationMode InMode)
+{
+	if (SimulationMode == InMode)
+	{
+		return;
+	}
+
+	// 진행 중인 스텝은 이전 모드 규칙대로 마무리
+	FetchAndUpdate();
+
+	if (SimulationMode == EPhysicsSimulationMode::AsyncOneFrameLatency)
+	{
+		ApplyInterpolatedPoses(1.0f);
+		PoseHistory.Empty();
+	}
+
+	SimulationMode = InMode;
+
+	switch (SimulationMode)
+	{
+	case EPhysicsSimulationMode::Synchronous:			SimulationStats.ModeName = L"Sync"; break;
+	case EPhysicsSimulationMode::Async:					SimulationStats.ModeName = L"Async"; break;
+	case EPhysicsSimulationMode::AsyncOneFrameLatency:	SimulationStats.ModeName = L"Async (1 Frame Latency)"; break;
+	}
+}
+
+void FPhysicsScene::ApplySimulationModeFromConfig()
+{
+	EPhysicsSimulationMode Mode = EPhysicsSimulationMode::Async;
+
+	auto ModeIt = EditorINI.find("PhysicsSimulationMode");
+	if (ModeIt != EditorINI.end())
+	{
+		if (ModeIt->second == "Sync")
+		{
+			Mode = EPhysicsSimulationMode::Synchronous;
+		}
+		else if (ModeIt->second == "Latency")
+		{
+			Mode = EPhysicsSimulationMode::AsyncOneFrameLatency;
+		}
+	}
+
+	SetSimulationMode(Mode);
+}
+
+void FPhysicsScene::KickStep()
+{
+	// 1. 물리 업데이트 전 처리 (씬이 멈춰 있는 상태, 차량 배치 레이캐스트 등)
+	for (IPrePhysics* PrePhysics : PreUpdateList)
+	{
+		PrePhysics->PrePhysicsUpdate(FixedDeltaTime);
+	}
+
+	// 2. 시뮬레이션 시작 (워커 스레드에서 진행)
+	Scene->simulate(FixedDeltaTime);
+	bIsSimulated = true;
+}
+
+void FPhysicsScene::FetchStep(bool bApplyResults)
+{
+	if (!bIsSimulated)
+	{
+		return;
+	}
+
+	bIsSimulated = false;
+
+	// PhysX 태스크는 잡 시스템 워커에서 돌므로 기다리는 동안 게임 스레드도 남은 태스크(와 다른 잡)를 처리
+	while (!Scene->checkResults(false))
+	{
+		if (!GJobSystem.ExecutePendingJob())
+		{
+			std::this_thread::yield();
+		}
+	}
 	Scene->fetchResults(true);
+	++FetchedStepCount;
+
+	if (!bApplyResults)
+	{
+		return;
+	}
+
+	const bool bRecordPoses = SimulationMode == EPhysicsSimulationMode::AsyncOneFrameLatency;
 
 	PxU32 NumActiveActors = 0;
 	PxActor** ActiveActors = Scene->getActiveActors(NumActiveActors);
 
-	// 래그돌 통계 수집을 위한 처리된 컴포넌트 추적
-	TSet<USkeletalMeshComponent*> ProcessedRagdolls;
-
 	for (PxU32 Index = 0; Index < NumActiveActors; Index++)
 	{
 		PxActor* Actor = ActiveActors[Index];
@@ -177,15 +350,81 @@ void FPhysicsScene::FetchAndUpdate()
 		if (Actor->userData)
 		{
 			FBodyInstance* Instance = (FBodyInstance*)Actor->userData;
+			UPrimitiveComponent* OwnerComponent = Instance->OwnerComponent;
 
-			if (Instance->OwnerComponent)
+			if (!OwnerComponent)
 			{
-				Instance->OwnerComponent->ApplyPhysicsResult();
+				continue;
+			}
+
+			// 지연 모드: 컴포넌트 자신의 단일 바디는 포즈만 기록해 두고 ApplyInterpolatedPoses에서 보간 반영
+			// (래그돌/차량처럼 바디 여러 개를 본에 맞추는 컴포넌트는 받은 결과를 그대로 반영)
+			PxRigidActor* RigidActor = Actor->is<PxRigidActor>();
+			if (bRecordPoses && RigidActor && Instance == &OwnerComponent->BodyInstance
+				&& !OwnerComponent->IsA(USkeletalMeshComponent::StaticClass()))
+			{
+				const PxTransform Pose = RigidActor->getGlobalPose();
+
+				FPoseHistory& History = PoseHistory.FindOrAdd(RigidActor);
+				History.Prev = History.StepIndex != 0 ? History.Curr : Pose;
+				History.Curr = Pose;
+				History.StepIndex = FetchedStepCount;
+				continue;
 			}
+
+			OwnerComponent->ApplyPhysicsResult();
 		}
 	}
+}
 
-	PendingDestroyInDeathNote();
+void FPhysicsScene::ApplyInterpolatedPoses(float Alpha)
+{
+	Alpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
+	SimulationStats.InterpolationAlpha = Alpha;
+
+	for (auto It = PoseHistory.begin(); It != PoseHistory.end();)
+	{
+		FBodyInstance* Instance = (FBodyInstance*)It->first->userData;
+		const FPoseHistory& History = It->second;
+
+		// 데스노트에 들어간 바디 (릴리즈 전에 PendingDestroyInDeathNote가 기록을 지움)
+		if (!Instance || !Instance->OwnerComponent)
+		{
+			It = PoseHistory.erase(It);
+			continue;
+		}
+
+		// 마지막 스텝에서 움직이지 않은(잠든) 바디는 최종 포즈에 맞추고 기록 제거
+		if (History.StepIndex != FetchedStepCount)
+		{
+			Instance->OwnerComponent->ApplyPhysicsPose(PhysxConverter::ToFTransform(History.Curr));
+			It = PoseHistory.erase(It);
+			continue;
+		}
+
+		const FTransform Pose = FTransform::Lerp(
+			PhysxConverter::ToFTransform(History.Prev), PhysxConverter::ToFTransform(History.Curr), Alpha);
+		Instance->OwnerComponent->ApplyPhysicsPose(Pose);
+
+		++SimulationStats.InterpolatedBodyCount;
+		++It;
+	}
+}
+
+void FPhysicsScene::ExecuteSceneQueries()
+{
+	const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+	SimulationStats.SceneQueryCount = SceneQueries.GetNumPending();
+
+	SceneQueries.Execute(Scene);
+
+	SimulationStats.SceneQueryTimeMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - StartCycles);
+	PublishSimulationStats();
+}
+
+void FPhysicsScene::PublishSimulationStats()
+{
+	FRagdollStatManager::GetInstance().SetSimulationStats(SimulationStats);
 }
 
 void FPhysicsScene::WriteInTheDeathNote(physx::PxActor* ActorToDie)
@@ -201,8 +440,21 @@ void FPhysicsScene::WriteInTheDeathNote(physx::PxActor* ActorToDie)
 
 void FPhysicsScene::PendingDestroyInDeathNote()
 {
+	if (ActorDeathNote.IsEmpty())
+	{
+		return;
+	}
+
+	// 시뮬레이션 중에는 액터를 제거할 수 없음 (월드 정리 등 동기화 지점 밖에서 호출된 경우)
+	WaitForSimulation();
+
 	for (PxActor* ActorToDie : ActorDeathNote)
 	{
+		if (PxRigidActor* RigidActor = ActorToDie->is<PxRigidActor>())
+		{
+			PoseHistory.Remove(RigidActor);
+		}
+
 		// 현재 씬에 속한 액터지만 확실히 처리
 		if (ActorToDie->getScene())
 		{
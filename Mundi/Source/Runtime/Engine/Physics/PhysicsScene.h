@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "PrePhysics.h"
+#include "RagdollStats.h"
+#include "SceneQueryBatch.h"
 
 using namespace physx;
 class FBodyInstance;
@@ -19,6 +21,23 @@ private:
 	FName GetBoneNameFromShape(const physx::PxShape* Shape);
 };
 
+/**
+ * 물리 시뮬레이션과 게임 스레드를 겹치는 방식 (editor.ini PhysicsSimulationMode=Sync|Async|Latency, PIE 월드에 적용)
+ */
+enum class EPhysicsSimulationMode : uint8
+{
+	// 서브스텝마다 simulate 직후 fetchResults(true)로 기다린다 (기존 방식)
+	Synchronous,
+
+	// 틱 초반(Simulate)에 마지막 서브스텝을 시작만 하고 액터 틱/애니메이션/Lua 동안 워커가 계산,
+	// 틱 후반 동기화 지점(SyncSimulation)에서 결과를 받아 같은 프레임에 반영
+	Async,
+
+	// 마지막 서브스텝 결과를 다음 틱 Simulate 시작에서 받는다 (렌더링과도 겹침)
+	// 단일 바디 컴포넌트는 받은 두 스텝 포즈를 남은 시간 비율로 보간해 반영
+	AsyncOneFrameLatency,
+};
+
 class FPhysicsScene
 {
 public:
@@ -44,10 +63,34 @@ public:
 	void AddActor(PxActor* Actor);
 	void RemoveActor(PxActor* Actor);
 
+	/**
+	 * 고정 스텝 시뮬레이션 (UWorld::Tick 초반)
+	 * 서브스텝 사이와 마지막 스텝 시작 전에는 항상 이전 스텝을 받아 씬이 멈춘 상태에서 PrePhysicsUpdate를 호출한다.
+	 * Async 계열 모드에서는 마지막 스텝을 시작만 하고 반환한다.
+	 */
 	void Simulate(float DeltaTime);
 
+	/**
+	 * 틱 후반 동기화 지점 (UWorld::Tick, Lua 틱 이후)
+	 * Async: 진행 중인 스텝 결과 반영 → 이번 틱에 쌓인 명령 실행 → 데스노트 정리
+	 * AsyncOneFrameLatency: 스텝이 아직 진행 중이므로 아무것도 하지 않음 (다음 Simulate에서 처리)
+	 */
+	void SyncSimulation();
+
+	// 진행 중인 스텝이 있으면 기다려 결과를 반영하고 데스노트 정리 (모드와 무관하게 즉시 동기화)
 	void FetchAndUpdate();
 
+	// 진행 중인 스텝이 있으면 결과를 반영하지 않고 기다리기만 함 (월드 정리 등 컴포넌트가 사라지는 중일 때)
+	void WaitForSimulation();
+
+	bool IsSimulating() const { return bIsSimulated; }
+
+	void SetSimulationMode(EPhysicsSimulationMode InMode);
+	EPhysicsSimulationMode GetSimulationMode() const { return SimulationMode; }
+
+	// editor.ini의 PhysicsSimulationMode 값 적용 (Sync / Async / Latency, 없으면 Async)
+	void ApplySimulationModeFromConfig();
+
 	void WriteInTheDeathNote(physx::PxActor* ActorToDie);
 
 	void PendingDestroyInDeathNote();
@@ -70,8 +113,32 @@ public:
 
 	// 시작점, 방향(정규화 안해도 내부에서 함), 거리, 결과값(Ref)
 	bool Raycast(const FVector& Origin, const FVector& Direction, float MaxDistance, FHitResult& OutHit);
+
+	// 프레임 동안 모아서 한꺼번에 실행하는 레이캐스트/스윕/오버랩 (결과는 ExecuteSceneQueries 이후)
+	FSceneQueryBatch& GetSceneQueries() { return SceneQueries; }
+
+	// 등록된 배치 쿼리를 병렬 실행하고 콜백 호출 (UWorld::Tick 물리 동기화 지점 직후)
+	void ExecuteSceneQueries();
 	
 private:
+	// 지연 모드 보간용 포즈 기록 (fetch로 받은 직전 두 스텝)
+	struct FPoseHistory
+	{
+		PxTransform Prev;
+		PxTransform Curr;
+		uint64 StepIndex = 0;   // Curr를 받은 스텝
+	};
+
+	// 스텝 하나 시작 (PrePhysicsUpdate → simulate)
+	void KickStep();
+
+	// fetchResults(true)로 기다린 뒤 활성 액터 결과 반영 (지연 모드의 단일 바디는 포즈 기록만)
+	void FetchStep(bool bApplyResults);
+
+	// 기록된 포즈를 Alpha로 보간해 컴포넌트에 반영 (지연 모드)
+	void ApplyInterpolatedPoses(float Alpha);
+
+	void PublishSimulationStats();
 
 	// Un/Register 쉽게하려고 Set 사용
 	TSet<IPrePhysics*> PreUpdateList;      
@@ -89,7 +156,21 @@ private:
 
 	const float FixedDeltaTime = 1.0f / 60.0f;
 	float LeftoverTime = 0.0f;
-	bool bIsSimulated = false;  // 이번 Tick에 Simulate 을 수행했는지
+	bool bIsSimulated = false;  // simulate를 시작했고 아직 fetchResults를 하지 않았는지
+
+	EPhysicsSimulationMode SimulationMode = EPhysicsSimulationMode::Synchronous;
+
+	// 완료(fetch)한 스텝 수
+	uint64 FetchedStepCount = 0;
+
+	// 마지막 스텝 시작 시각 (게임 스레드와 겹친 시간 통계용)
+	uint64 KickCycles = 0;
+
+	TFlatMap<PxRigidActor*, FPoseHistory> PoseHistory;
+
+	FPhysicsSimulationStats SimulationStats;
+
+	FSceneQueryBatch SceneQueries;
 	
 	// 자동차 레이캐스팅 묶음 
 	PxBatchQuery* BatchQuery = nullptr;
@@ -2,8 +2,7 @@
 #include "PhysicsSystem.h"
 #include "PhysicsScene.h"
 #include "FKConvexElem.h"
-
-#define MAX_PHYSX_THREADS 8
+#include "PhysXJobDispatcher.h"
 
 FPhysicsSystem* FPhysicsSystem::Instance = nullptr;
 FPhysicsSystem& FPhysicsSystem::GetInstance()
@@ -63,13 +62,8 @@ void FPhysicsSystem::Initialize()
 	// Params: Scale, TargetPlatform(기본값: 현재 플랫폼. 플랫폼마다 최적화 방식이 다름) 등 
 	Cooking = PxCreateCooking(PX_PHYSICS_VERSION, *Foundation, PxCookingParams(PxTolerancesScale()));
 
-	int LogicCores = std::thread::hardware_concurrency();
-
-	int TargetThread = LogicCores - 2;
-
-	int PhysxThreadCount = std::clamp(TargetThread, 1, MAX_PHYSX_THREADS);
-	
-	Dispatcher = PxDefaultCpuDispatcherCreate(PhysxThreadCount);
+	// 별도 스레드 풀 대신 잡 시스템 워커에서 태스크 실행 (스레드 수는 editor.ini JobWorkerThreads 하나로 관리)
+	Dispatcher = new FPhysXJobDispatcher();
 
 	// 정지마찰, 운동마찰, 반발 계수(디폴트, 원하면 새로 생성해서 사용)
 	Material = Physics->createMaterial(0.5f, 0.5f, 0.6f);
@@ -218,7 +212,7 @@ void FPhysicsSystem::Shutdown()
 {
 	PxCloseExtensions();
 	PxCloseVehicleSDK();
-	if (Dispatcher) Dispatcher->release();
+	if (Dispatcher) { delete Dispatcher; Dispatcher = nullptr; }
 	if (Cooking) Cooking->release();
 	if (Material) Material->release();
 	if (Physics) Physics->release();
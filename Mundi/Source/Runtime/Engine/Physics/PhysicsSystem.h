@@ -2,6 +2,7 @@
 
 using namespace physx;
 class FPhysicsScene;
+class FPhysXJobDispatcher;
 
 #define VEHICLE_FILTER 0x00000001
 
@@ -52,8 +53,8 @@ private:
     // 복잡한 메쉬의 정점 데이터를 받아서 Physx가 계산하기 쉬운 형태로 변환(Bvh쓴다고 함)
     PxCooking* Cooking = nullptr;     
 
-    // Physx에 스레드 배분해줌
-    PxDefaultCpuDispatcher* Dispatcher = nullptr;     
+    // Physx에 스레드 배분해줌 (엔진 잡 시스템 워커를 같이 씀)
+    FPhysXJobDispatcher* Dispatcher = nullptr;     
 
     // 표면 성질 정의(마찰, 반발계수)
     PxMaterial* Material = nullptr;    
@@ -52,6 +52,36 @@ struct FRagdollStats
     }
 };
 
+// ===== Physics Simulation Statistics =====
+// FPhysicsScene 스텝 진행/동기화 통계 (틱마다 FPhysicsScene이 갱신)
+
+struct FPhysicsSimulationStats
+{
+    const wchar_t* ModeName = L"Sync";
+    int32 SubStepCount = 0;                 // 이번 틱에 시작한 스텝 수
+    int32 AsyncStepCount = 0;               // 그중 게임 스레드와 겹쳐 돈 스텝 수
+    double BlockingStepTimeMS = 0.0;        // 서브스텝 사이에 simulate ~ fetch를 기다린 시간 (겹치지 못한 스텝)
+    double OverlapTimeMS = 0.0;             // 비동기 스텝 시작 ~ 동기화 지점까지 게임 스레드가 다른 일을 한 시간
+    double FenceWaitTimeMS = 0.0;           // 동기화 지점 fetchResults(true)에서 기다린 시간
+    int32 InterpolatedBodyCount = 0;        // 지연 모드에서 보간해 반영한 바디 수
+    float InterpolationAlpha = 0.0f;
+    int32 SceneQueryCount = 0;              // 배치 씬 쿼리 수 (FSceneQueryBatch)
+    double SceneQueryTimeMS = 0.0;          // 배치 실행 + 콜백 시간
+
+    void Reset()
+    {
+        SubStepCount = 0;
+        AsyncStepCount = 0;
+        BlockingStepTimeMS = 0.0;
+        OverlapTimeMS = 0.0;
+        FenceWaitTimeMS = 0.0;
+        InterpolatedBodyCount = 0;
+        InterpolationAlpha = 0.0f;
+        SceneQueryCount = 0;
+        SceneQueryTimeMS = 0.0;
+    }
+};
+
 // ===== Ragdoll Stat Manager =====
 // 래그돌 통계를 수집하고 관리하는 싱글톤
 
@@ -114,7 +144,19 @@ public:
         CurrentStats.ConstraintsMemoryBytes += ConstraintsBytes;
     }
 
+    // 물리 스텝 통계 (ResetFrameStats와 별개로 FPhysicsScene이 덮어씀)
+    void SetSimulationStats(const FPhysicsSimulationStats& InStats)
+    {
+        SimulationStats = InStats;
+    }
+
+    const FPhysicsSimulationStats& GetSimulationStats() const
+    {
+        return SimulationStats;
+    }
+
 private:
     FRagdollStatManager() = default;
     FRagdollStats CurrentStats;
+    FPhysicsSimulationStats SimulationStats;
 };
@@ -0,0 +1,326 @@
+﻿#include "pch.h"
+#include "SceneQueryBatch.h"
+#include "BodyInstance.h"
+#include "PrimitiveComponent.h"
+#include "JobSystem.h"
+
+using namespace physx;
+
+namespace
+{
+	// 쿼리 하나가 가벼우므로 잡 하나가 이 정도는 처리하게 한다
+	constexpr int32 MinQueriesPerJob = 8;
+
+	// IgnoreActor 소유 바디 제외 (쿼리마다 스택에 만들어 워커 간 공유 없음)
+	class FIgnoreActorFilter : public PxQueryFilterCallback
+	{
+	public:
+		FIgnoreActorFilter(AActor* InIgnoreActor, PxQueryHitType::Enum InHitType)
+			: IgnoreActor(InIgnoreActor), HitType(InHitType) {}
+
+		PxQueryHitType::Enum preFilter(const PxFilterData&, const PxShape*, const PxRigidActor* Actor, PxHitFlags&) override
+		{
+			const FBodyInstance* Instance = Actor ? static_cast<const FBodyInstance*>(Actor->userData) : nullptr;
+			if (Instance && Instance->OwnerComponent && Instance->OwnerComponent->GetOwner() == IgnoreActor)
+			{
+				return PxQueryHitType::eNONE;
+			}
+			return HitType;
+		}
+
+		PxQueryHitType::Enum postFilter(const PxFilterData&, const PxQueryHit&) override
+		{
+			return HitType;
+		}
+
+	private:
+		AActor* IgnoreActor;
+		PxQueryHitType::Enum HitType;
+	};
+
+	PxQueryFilterData MakeFilterData(const FSceneQueryParams& Params, bool bOverlap)
+	{
+		PxQueryFlags Flags;
+		if (Params.bStatic) Flags |= PxQueryFlag::eSTATIC;
+		if (Params.bDynamic) Flags |= PxQueryFlag::eDYNAMIC;
+		if (Params.IgnoreActor) Flags |= PxQueryFlag::ePREFILTER;
+		// 오버랩은 블로킹 히트 하나가 아니라 겹친 바디 전부를 받는다
+		if (bOverlap) Flags |= PxQueryFlag::eNO_BLOCK;
+		return PxQueryFilterData(Flags);
+	}
+
+	// 엔진 모양 → PhysX 지오메트리 + 포즈 (캡슐은 엔진 Z축 → PhysX X축 기본 회전 적용, BodyInstance와 같은 규칙)
+	PxGeometryHolder MakeGeometry(const FSceneQueryShape& Shape)
+	{
+		switch (Shape.Type)
+		{
+		case FSceneQueryShape::EType::Box:
+		{
+			PxVec3 HalfExtent = PhysxConverter::ToPxVec3(Shape.HalfExtent);
+			return PxGeometryHolder(PxBoxGeometry(std::abs(HalfExtent.x), std::abs(HalfExtent.y), std::abs(HalfExtent.z)));
+		}
+		case FSceneQueryShape::EType::Capsule:
+			return PxGeometryHolder(PxCapsuleGeometry(Shape.Radius, Shape.HalfHeight));
+		case FSceneQueryShape::EType::Sphere:
+		default:
+			return PxGeometryHolder(PxSphereGeometry(Shape.Radius));
+		}
+	}
+
+	PxTransform MakeShapePose(const FSceneQueryShape& Shape, const FQuat& Rotation, const FVector& Location)
+	{
+		FQuat FinalRotation = Rotation;
+		if (Shape.Type == FSceneQueryShape::EType::Capsule)
+		{
+			FinalRotation = Rotation * FQuat::MakeFromEulerZYX(FVector(-90.0f, 0.0f, 0.0f));
+		}
+		return PxTransform(PhysxConverter::ToPxVec3(Location), PhysxConverter::ToPxQuat(FinalRotation));
+	}
+
+	void FillHitTarget(const PxRigidActor* Actor, const PxShape* Shape, FHitResult& OutHit)
+	{
+		if (Actor && Actor->userData)
+		{
+			const FBodyInstance* Instance = static_cast<const FBodyInstance*>(Actor->userData);
+			if (Instance->OwnerComponent)
+			{
+				OutHit.Component = Instance->OwnerComponent;
+				OutHit.Actor = Instance->OwnerComponent->GetOwner();
+			}
+		}
+
+		if (Shape && Shape->userData)
+		{
+			OutHit.BoneName = *static_cast<const FName*>(Shape->userData);
+		}
+	}
+
+	void FillLocationHit(const PxLocationHit& PxHit, FHitResult& OutHit)
+	{
+		OutHit.bBlockingHit = true;
+		OutHit.Distance = PxHit.distance;
+		OutHit.ImpactPoint = PhysxConverter::ToFVector(PxHit.position);
+		OutHit.ImpactNormal = PhysxConverter::ToFVector(PxHit.normal);
+		OutHit.Item = PxHit.faceIndex;
+		FillHitTarget(PxHit.actor, PxHit.shape, OutHit);
+	}
+}
+
+FSceneQueryShape FSceneQueryShape::MakeSphere(float InRadius)
+{
+	FSceneQueryShape Shape;
+	Shape.Type = EType::Sphere;
+	Shape.Radius = InRadius;
+	return Shape;
+}
+
+FSceneQueryShape FSceneQueryShape::MakeBox(const FVector& InHalfExtent)
+{
+	FSceneQueryShape Shape;
+	Shape.Type = EType::Box;
+	Shape.HalfExtent = InHalfExtent;
+	return Shape;
+}
+
+FSceneQueryShape FSceneQueryShape::MakeCapsule(float InRadius, float InHalfHeight)
+{
+	FSceneQueryShape Shape;
+	Shape.Type = EType::Capsule;
+	Shape.Radius = InRadius;
+	Shape.HalfHeight = InHalfHeight;
+	return Shape;
+}
+
+FSceneQueryHandle FSceneQueryBatch::Raycast(const FVector& Origin, const FVector& Direction, float MaxDistance,
+	const FSceneQueryParams& Params, FCallback Callback)
+{
+	FRequest Request;
+	Request.Type = ESceneQueryType::Raycast;
+	Request.Origin = Origin;
+	Request.Direction = Direction;
+	Request.MaxDistance = MaxDistance;
+	Request.Params = Params;
+	return AddRequest(Request, std::move(Callback));
+}
+
+FSceneQueryHandle FSceneQueryBatch::Sweep(const FSceneQueryShape& Shape, const FQuat& Rotation, const FVector& Origin, const FVector& Direction, float MaxDistance,
+	const FSceneQueryParams& Params, FCallback Callback)
+{
+	FRequest Request;
+	Request.Type = ESceneQueryType::Sweep;
+	Request.Shape = Shape;
+	Request.Rotation = Rotation;
+	Request.Origin = Origin;
+	Request.Direction = Direction;
+	Request.MaxDistance = MaxDistance;
+	Request.Params = Params;
+	return AddRequest(Request, std::move(Callback));
+}
+
+FSceneQueryHandle FSceneQueryBatch::Overlap(const FSceneQueryShape& Shape, const FQuat& Rotation, const FVector& Center,
+	const FSceneQueryParams& Params, FCallback Callback)
+{
+	FRequest Request;
+	Request.Type = ESceneQueryType::Overlap;
+	Request.Shape = Shape;
+	Request.Rotation = Rotation;
+	Request.Origin = Center;
+	Request.Params = Params;
+	Request.MaxHits = FMath::Max(Params.MaxOverlaps, 1);
+	return AddRequest(Request, std::move(Callback));
+}
+
+FSceneQueryHandle FSceneQueryBatch::AddRequest(const FRequest& Request, FCallback&& Callback)
+{
+	const uint64 Index = static_cast<uint64>(PendingRequests.Num());
+	PendingRequests.Add(Request);
+	PendingCallbacks.Add(std::move(Callback));
+	return (static_cast<uint64>(ExecutedSerial + 1) << 32) | Index;
+}
+
+void FSceneQueryBatch::Execute(PxScene* Scene)
+{
+	// 콜백에서 새로 등록하는 쿼리는 다음 배치로 가도록 먼저 교환
+	ExecutingRequests.swap(PendingRequests);
+	ExecutingCallbacks.swap(PendingCallbacks);
+	PendingRequests.clear();
+	PendingCallbacks.clear();
+	++ExecutedSerial;
+
+	const int32 NumRequests = ExecutingRequests.Num();
+
+	// 1. 쿼리마다 평탄한 히트 버퍼 구간 배정
+	int32 NumHitSlots = 0;
+	for (FRequest& Request : ExecutingRequests)
+	{
+		Request.FirstHit = NumHitSlots;
+		NumHitSlots += Request.MaxHits;
+	}
+
+	Results.clear();
+	Results.resize(NumRequests);
+	Hits.clear();
+	Hits.resize(NumHitSlots);
+
+	if (NumRequests == 0 || !Scene)
+	{
+		ExecutingCallbacks.clear();
+		return;
+	}
+
+	// 2. 병렬 실행 (쿼리는 자기 결과/히트 구간만 쓰고 씬은 읽기만 함)
+	const FRequest* Requests = ExecutingRequests.GetData();
+	FSceneQueryResult* OutResults = Results.GetData();
+	FHitResult* OutHits = Hits.GetData();
+	ParallelFor(NumRequests, [Scene, Requests, OutResults, OutHits](int32 Index)
+	{
+		ExecuteRequest(Scene, Requests[Index], OutResults[Index], OutHits + Requests[Index].FirstHit);
+	}, MinQueriesPerJob);
+
+	// 3. 콜백 (게임 스레드, 등록 순서)
+	for (int32 Index = 0; Index < NumRequests; ++Index)
+	{
+		if (ExecutingCallbacks[Index])
+		{
+			ExecutingCallbacks[Index](Results[Index]);
+		}
+	}
+	ExecutingCallbacks.clear();
+}
+
+void FSceneQueryBatch::ExecuteRequest(PxScene* Scene, const FRequest& Request, FSceneQueryResult& OutResult, FHitResult* OutHits)
+{
+	OutResult.UserTag = Request.Params.UserTag;
+	OutResult.Type = Request.Type;
+	OutResult.Hits = OutHits;
+
+	const bool bOverlap = Request.Type == ESceneQueryType::Overlap;
+	const PxQueryFilterData FilterData = MakeFilterData(Request.Params, bOverlap);
+	FIgnoreActorFilter Filter(Request.Params.IgnoreActor, bOverlap ? PxQueryHitType::eTOUCH : PxQueryHitType::eBLOCK);
+	PxQueryFilterCallback* FilterCallback = Request.Params.IgnoreActor ? &Filter : nullptr;
+
+	switch (Request.Type)
+	{
+	case ESceneQueryType::Raycast:
+	{
+		PxVec3 Direction = PhysxConverter::ToPxVec3(Request.Direction);
+		Direction.normalize();
+
+		PxRaycastBuffer Buffer;
+		if (Scene->raycast(PhysxConverter::ToPxVec3(Request.Origin), Direction, Request.MaxDistance, Buffer,
+			PxHitFlag::eDEFAULT, FilterData, FilterCallback) && Buffer.hasBlock)
+		{
+			FillLocationHit(Buffer.block, OutHits[0]);
+			OutHits[0].Location = PhysxConverter::ToFVector(Buffer.block.position);
+			OutResult.NumHits = 1;
+		}
+		break;
+	}
+	case ESceneQueryType::Sweep:
+	{
+		PxVec3 Direction = PhysxConverter::ToPxVec3(Request.Direction);
+		Direction.normalize();
+
+		const PxGeometryHolder Geometry = MakeGeometry(Request.Shape);
+		const PxTransform Pose = MakeShapePose(Request.Shape, Request.Rotation, Request.Origin);
+
+		PxSweepBuffer Buffer;
+		if (Scene->sweep(Geometry.any(), Pose, Direction, Request.MaxDistance, Buffer,
+			PxHitFlag::eDEFAULT, FilterData, FilterCallback) && Buffer.hasBlock)
+		{
+			FillLocationHit(Buffer.block, OutHits[0]);
+			// 충돌 순간의 모양 중심
+			OutHits[0].Location = Request.Origin + Request.Direction.GetSafeNormal() * Buffer.block.distance;
+			OutResult.NumHits = 1;
+		}
+		break;
+	}
+	case ESceneQueryType::Overlap:
+	{
+		const PxGeometryHolder Geometry = MakeGeometry(Request.Shape);
+		const PxTransform Pose = MakeShapePose(Request.Shape, Request.Rotation, Request.Origin);
+
+		// 결과는 스택 버퍼로 받아 히트 구간에 옮김 (MaxOverlaps가 크면 나눠 받지 않고 잘림)
+		constexpr int32 MaxStackOverlaps = 64;
+		PxOverlapHit Touches[MaxStackOverlaps];
+		const int32 MaxTouches = FMath::Min(Request.MaxHits, MaxStackOverlaps);
+		PxOverlapBuffer Buffer(Touches, static_cast<PxU32>(MaxTouches));
+
+		Scene->overlap(Geometry.any(), Pose, Buffer, FilterData, FilterCallback);
+
+		const int32 NumTouches = static_cast<int32>(Buffer.getNbTouches());
+		for (int32 i = 0; i < NumTouches; ++i)
+		{
+			FHitResult& Hit = OutHits[i];
+			FillHitTarget(Touches[i].actor, Touches[i].shape, Hit);
+			Hit.Location = Request.Origin;
+			Hit.Item = Touches[i].faceIndex;
+		}
+		OutResult.NumHits = NumTouches;
+		break;
+	}
+	}
+
+	OutResult.bHit = OutResult.NumHits > 0;
+}
+
+const FSceneQueryResult* FSceneQueryBatch::GetResult(FSceneQueryHandle Handle) const
+{
+	const uint32 Serial = static_cast<uint32>(Handle >> 32);
+	const uint32 Index = static_cast<uint32>(Handle & 0xFFFFFFFFull);
+	if (Serial != ExecutedSerial || Index >= static_cast<uint32>(Results.Num()))
+	{
+		return nullptr;
+	}
+	return &Results[Index];
+}
+
+void FSceneQueryBatch::Reset()
+{
+	PendingRequests.clear();
+	PendingCallbacks.clear();
+	ExecutingRequests.clear();
+	ExecutingCallbacks.clear();
+	Results.clear();
+	Hits.clear();
+}
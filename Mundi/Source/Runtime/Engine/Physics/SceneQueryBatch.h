@@ -0,0 +1,125 @@
+﻿#pragma once
+#include "HitResult.h"
+
+class AActor;
+
+enum class ESceneQueryType : uint8
+{
+	Raycast,
+	Sweep,
+	Overlap,
+};
+
+/**
+ * 스윕/오버랩에 쓰는 모양 (엔진 좌표계, 캡슐은 Z축이 길이 방향)
+ */
+struct FSceneQueryShape
+{
+	enum class EType : uint8 { Sphere, Box, Capsule };
+
+	EType Type = EType::Sphere;
+	float Radius = 0.5f;            // Sphere, Capsule
+	float HalfHeight = 0.5f;        // Capsule 원통 부분 절반 길이
+	FVector HalfExtent;             // Box
+
+	static FSceneQueryShape MakeSphere(float InRadius);
+	static FSceneQueryShape MakeBox(const FVector& InHalfExtent);
+	static FSceneQueryShape MakeCapsule(float InRadius, float InHalfHeight);
+};
+
+struct FSceneQueryParams
+{
+	uint64 UserTag = 0;                 // 호출자가 결과를 구분할 값 (결과에 그대로 돌려줌)
+	AActor* IgnoreActor = nullptr;      // 이 액터의 바디는 무시 (자기 자신 제외용)
+	int32 MaxOverlaps = 16;             // 오버랩 결과 최대 개수
+	bool bStatic = true;
+	bool bDynamic = true;
+};
+
+/**
+ * 쿼리 하나의 결과
+ * Raycast/Sweep은 가장 가까운 블로킹 히트 하나, Overlap은 겹친 바디 최대 MaxOverlaps개
+ * Hits는 배치의 평탄한 히트 버퍼를 가리키며 다음 Execute 전까지 유효
+ */
+struct FSceneQueryResult
+{
+	uint64 UserTag = 0;
+	ESceneQueryType Type = ESceneQueryType::Raycast;
+	bool bHit = false;
+	int32 NumHits = 0;
+	const FHitResult* Hits = nullptr;
+};
+
+// 배치 일련번호(상위 32비트) + 배치 안 인덱스(하위 32비트), 0은 무효
+using FSceneQueryHandle = uint64;
+
+/**
+ * FSceneQueryBatch
+ * 레이캐스트/스윕/오버랩을 프레임 동안 모았다가 정해진 지점에서 한꺼번에 실행하는 씬 쿼리 배치
+ *
+ * 1. 게임 스레드 (액터 틱, Lua 등): Raycast/Sweep/Overlap으로 등록 (핸들 반환, 필요하면 콜백 지정)
+ * 2. UWorld::Tick 물리 동기화 지점 직후 FPhysicsScene::ExecuteSceneQueries → Execute
+ *    - 등록된 쿼리를 잡 시스템 워커에서 병렬 실행 (쿼리는 자기 결과 칸만 씀, 씬은 읽기만 함)
+ *    - 결과를 평탄한 버퍼(GetResults)에 등록 순서대로 채우고 콜백을 등록 순서대로 게임 스레드에서 호출
+ * 3. 결과는 다음 Execute 전까지 GetResult(Handle)로 조회 가능
+ *
+ * 콜백 안이나 Execute 이후에 등록한 쿼리는 다음 프레임 배치에서 실행된다.
+ */
+class FSceneQueryBatch
+{
+public:
+	using FCallback = std::function<void(const FSceneQueryResult&)>;
+
+	FSceneQueryHandle Raycast(const FVector& Origin, const FVector& Direction, float MaxDistance,
+		const FSceneQueryParams& Params = FSceneQueryParams(), FCallback Callback = nullptr);
+
+	FSceneQueryHandle Sweep(const FSceneQueryShape& Shape, const FQuat& Rotation, const FVector& Origin, const FVector& Direction, float MaxDistance,
+		const FSceneQueryParams& Params = FSceneQueryParams(), FCallback Callback = nullptr);
+
+	FSceneQueryHandle Overlap(const FSceneQueryShape& Shape, const FQuat& Rotation, const FVector& Center,
+		const FSceneQueryParams& Params = FSceneQueryParams(), FCallback Callback = nullptr);
+
+	// 대기 중인 쿼리를 병렬 실행하고 콜백 호출 (게임 스레드)
+	void Execute(physx::PxScene* Scene);
+
+	// 마지막 Execute 결과 (지난 배치 핸들이면 nullptr)
+	const FSceneQueryResult* GetResult(FSceneQueryHandle Handle) const;
+	const TArray<FSceneQueryResult>& GetResults() const { return Results; }
+
+	int32 GetNumPending() const { return PendingRequests.Num(); }
+
+	// 월드 정리 시 (대기 쿼리/콜백 폐기, ~UWorld와 ~FPhysicsScene에서 호출)
+	void Reset();
+
+private:
+	struct FRequest
+	{
+		ESceneQueryType Type = ESceneQueryType::Raycast;
+		FSceneQueryShape Shape;
+		FQuat Rotation;
+		FVector Origin;
+		FVector Direction;
+		float MaxDistance = 0.0f;
+		FSceneQueryParams Params;
+		int32 FirstHit = 0;     // Execute에서 채움
+		int32 MaxHits = 1;
+	};
+
+	FSceneQueryHandle AddRequest(const FRequest& Request, FCallback&& Callback);
+
+	static void ExecuteRequest(physx::PxScene* Scene, const FRequest& Request, FSceneQueryResult& OutResult, FHitResult* OutHits);
+
+	// 등록 중 (다음 Execute에서 실행)
+	TArray<FRequest> PendingRequests;
+	TArray<FCallback> PendingCallbacks;
+
+	// 실행 중/실행 완료 (Execute에서 Pending과 교환해 재사용)
+	TArray<FRequest> ExecutingRequests;
+	TArray<FCallback> ExecutingCallbacks;
+
+	TArray<FSceneQueryResult> Results;
+	TArray<FHitResult> Hits;
+
+	// 마지막으로 실행한 배치 번호 (등록 중인 배치는 +1)
+	uint32 ExecutedSerial = 0;
+};
@@ -15,6 +15,8 @@
 #include "GameHUD.h"
 #include "LuaScriptComponent.h"
 #include "SkeletalMeshComponent.h"
+#include "ParticleSystem.h"
+#include "ParticleSystemPool.h"
 
 sol::object MakeCompProxy(sol::state_view SolState, UObject* Instance, UClass* Class) {
     LuaComponentProxy Proxy;
@@ -267,6 +269,26 @@ FLuaManager::FLuaManager()
             return NewObject;
         }
     ));
+    // 일회성 파티클 이펙트 재생 (월드 파티클 풀에서 재사용, 재생이 끝나면 자동 반납)
+    SharedLib.set_function("SpawnEmitterAtLocation",
+        [](const FString& ParticlePath, FVector Location) -> bool
+        {
+            if (!GWorld || !GWorld->GetParticleSystemPool())
+            {
+                return false;
+            }
+
+            UParticleSystem* Template = UResourceManager::GetInstance().Load<UParticleSystem>(ParticlePath);
+            if (!Template)
+            {
+                return false;
+            }
+
+            FTransform Transform;
+            Transform.Translation = Location;
+            return GWorld->GetParticleSystemPool()->SpawnAtLocation(Template, Transform) != nullptr;
+        }
+    );
     SharedLib.set_function("DeleteObject", sol::overload(
         [](const FGameObject& GameObject)
         {
@@ -530,6 +552,86 @@ FLuaManager::FLuaManager()
         return std::make_tuple(bHit, Hit);
     });
 
+    // === 배치 씬 쿼리 ===
+    // 이번 틱에 등록해 두면 물리 동기화 지점 직후 한꺼번에 병렬 실행됨
+    // 사용법: local Handle = Physics.QueueRaycast(Start, Dir, Dist, Tag, function(bHit, Hits, Tag) ... end)
+    //         (Tag, Callback은 생략 가능, Tag 없이 콜백만 쓰려면 Tag 자리에 nil.
+    //          콜백 없이 쓰면 실행 이후 Physics.GetQueryResult(Handle)로 조회)
+    //         Hits는 FHitResult 배열 (레이캐스트/스윕은 가장 가까운 히트 하나)
+    auto MakeHitTable = [LuaState = Lua](const FSceneQueryResult& Result) -> sol::table
+    {
+        sol::table HitTable = LuaState->create_table(Result.NumHits, 0);
+        for (int32 i = 0; i < Result.NumHits; ++i)
+        {
+            HitTable[i + 1] = Result.Hits[i];
+        }
+        return HitTable;
+    };
+
+    auto MakeQueryParams = [](sol::optional<uint64> Tag)
+    {
+        FSceneQueryParams Params;
+        Params.UserTag = Tag.value_or(0);
+        return Params;
+    };
+
+    auto MakeLuaCallback = [MakeHitTable](sol::optional<sol::protected_function> Callback) -> FSceneQueryBatch::FCallback
+    {
+        if (!Callback || !Callback->valid())
+        {
+            return nullptr;
+        }
+
+        return [Func = *Callback, MakeHitTable](const FSceneQueryResult& Result)
+        {
+            auto CallResult = Func(Result.bHit, MakeHitTable(Result), Result.UserTag);
+            if (!CallResult.valid())
+            {
+                sol::error Err = CallResult; UE_LOG("[Lua][error] %s\n", Err.what());
+            }
+        };
+    };
+
+    Physics.set_function("QueueRaycast", [MakeQueryParams, MakeLuaCallback](FVector Origin, FVector Direction, float Distance,
+        sol::optional<uint64> Tag, sol::optional<sol::protected_function> Callback) -> FSceneQueryHandle
+    {
+        FPhysicsScene* PhyScene = GWorld->GetPhysicsScene();
+        if (!PhyScene) { return 0; }
+        return PhyScene->GetSceneQueries().Raycast(Origin, Direction, Distance, MakeQueryParams(Tag), MakeLuaCallback(Callback));
+    });
+
+    // 구 스윕 (Radius 반지름 구를 Dir 방향으로 Dist만큼)
+    Physics.set_function("QueueSphereSweep", [MakeQueryParams, MakeLuaCallback](FVector Origin, FVector Direction, float Distance, float Radius,
+        sol::optional<uint64> Tag, sol::optional<sol::protected_function> Callback) -> FSceneQueryHandle
+    {
+        FPhysicsScene* PhyScene = GWorld->GetPhysicsScene();
+        if (!PhyScene) { return 0; }
+        return PhyScene->GetSceneQueries().Sweep(FSceneQueryShape::MakeSphere(Radius), FQuat::Identity(), Origin, Direction, Distance,
+            MakeQueryParams(Tag), MakeLuaCallback(Callback));
+    });
+
+    // 구 오버랩 (Center 중심 Radius 반지름 안의 바디들)
+    Physics.set_function("QueueSphereOverlap", [MakeQueryParams, MakeLuaCallback](FVector Center, float Radius,
+        sol::optional<uint64> Tag, sol::optional<sol::protected_function> Callback) -> FSceneQueryHandle
+    {
+        FPhysicsScene* PhyScene = GWorld->GetPhysicsScene();
+        if (!PhyScene) { return 0; }
+        return PhyScene->GetSceneQueries().Overlap(FSceneQueryShape::MakeSphere(Radius), FQuat::Identity(), Center,
+            MakeQueryParams(Tag), MakeLuaCallback(Callback));
+    });
+
+    // 사용법: local bHit, Hits, Tag = Physics.GetQueryResult(Handle) (마지막으로 실행된 배치의 핸들만 유효, 아니면 nil)
+    Physics.set_function("GetQueryResult", [MakeHitTable](FSceneQueryHandle Handle) -> std::tuple<sol::optional<bool>, sol::optional<sol::table>, uint64>
+    {
+        FPhysicsScene* PhyScene = GWorld->GetPhysicsScene();
+        const FSceneQueryResult* Result = PhyScene ? PhyScene->GetSceneQueries().GetResult(Handle) : nullptr;
+        if (!Result)
+        {
+            return std::make_tuple(sol::optional<bool>(), sol::optional<sol::table>(), uint64(0));
+        }
+        return std::make_tuple(sol::optional<bool>(Result->bHit), sol::optional<sol::table>(MakeHitTable(*Result)), Result->UserTag);
+    });
+
     RegisterComponentProxy(*Lua);
     ExposeGlobalFunctions();
     ExposeAllComponentsToLua();
@@ -541,6 +643,7 @@ FLuaManager::FLuaManager()
     (*Lua)["AddComponent"] = SharedLib["AddComponent"];
     (*Lua)["GetOwnerAs"] = SharedLib["GetOwnerAs"];
     (*Lua)["SpawnPrefab"] = SharedLib["SpawnPrefab"];
+    (*Lua)["SpawnEmitterAtLocation"] = SharedLib["SpawnEmitterAtLocation"];
     (*Lua)["DeleteObject"] = SharedLib["DeleteObject"];
     (*Lua)["FindObjectByName"] = SharedLib["FindObjectByName"];
     (*Lua)["FindComponentByName"] = SharedLib["FindComponentByName"];
@@ -45,6 +45,20 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    inline float SurfaceArea(const FAABB& Box)
+    {
+        const float Dx = std::max(0.0f, Box.Max.X - Box.Min.X);
+        const float Dy = std::max(0.0f, Box.Max.Y - Box.Min.Y);
+        const float Dz = std::max(0.0f, Box.Max.Z - Box.Min.Z);
+        return 2.0f * (Dx * Dy + Dy * Dz + Dz * Dx);
+    }
+
+    inline bool IsSameBounds(const FAABB& A, const FAABB& B)
+    {
+        return A.Min.X == B.Min.X && A.Min.Y == B.Min.Y && A.Min.Z == B.Min.Z
+            && A.Max.X == B.Max.X && A.Max.Y == B.Max.Y && A.Max.Z == B.Max.Z;
+    }
 }
 
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
@@ -63,13 +77,31 @@ FBVHierarchy::~FBVHierarchy()
 void FBVHierarchy::Clear()
 {
     // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
-    StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
+    StaticMeshComponentBounds.Empty();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
     Bounds = FAABB();
+    ComponentLeafIndex.Empty();
+    PendingRefitComponents = TArray<UPrimitiveComponent*>();
+    BuiltSAHCost = 0.0f;
+    CurrentSAHCost = 0.0f;
     bPendingRebuild = false;
 }
 
+void FBVHierarchy::SetBuildMode(EBVHBuildMode InMode)
+{
+    if (BuildMode == InMode)
+    {
+        return;
+    }
+
+    BuildMode = InMode;
+    if (!StaticMeshComponentBounds.IsEmpty())
+    {
+        bPendingRebuild = true;
+    }
+}
+
 void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
 {
     for (const auto& SMC : Components)
@@ -82,8 +114,7 @@ void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
 
     // Level 복사 등으로 다량의 컴포넌트를 한 번에 넣는 상황 전제
     // 일반적인 update에서 budget 단위로 끊어 갱신되는 로직 우회해 강제 rebuild
-    BuildLBVH();
-    bPendingRebuild = false;
+    Rebuild();
 }
 
 void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
@@ -102,6 +133,14 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
     const FAABB WorldBounds = InComponent->GetWorldAABB();
 
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
+
+    // 이미 트리에 들어있는 컴포넌트의 이동은 재빌드 없이 refit으로 처리
+    if (!bPendingRebuild && ComponentLeafIndex.Contains(InComponent))
+    {
+        PendingRefitComponents.Add(InComponent);
+        return;
+    }
+
     bPendingRebuild = true;
 }
 
@@ -267,6 +306,95 @@ namespace
     {
         return (ExpandBits(x) << 2) | (ExpandBits(y) << 1) | ExpandBits(z);
     }
+
+    // LSD radix sort (11비트 x 3패스 = 30비트 Morton 코드), 코드와 함께 인덱스를 재배치
+    void RadixSortMortonCodes(TArray<uint32>& Codes, TArray<int32>& Indices)
+    {
+        constexpr int32 RadixBits = 11;
+        constexpr int32 NumBuckets = 1 << RadixBits;
+        constexpr uint32 RadixMask = NumBuckets - 1;
+
+        const int32 N = Codes.Num();
+        TArray<uint32> TempCodes;
+        TArray<int32> TempIndices;
+        TempCodes.resize(N);
+        TempIndices.resize(N);
+
+        for (int32 Pass = 0; Pass < 3; ++Pass)
+        {
+            const uint32 Shift = Pass * RadixBits;
+            int32 Counts[NumBuckets] = {};
+            for (int32 i = 0; i < N; ++i)
+            {
+                ++Counts[(Codes[i] >> Shift) & RadixMask];
+            }
+
+            // 모든 코드가 한 버킷이면 이 자릿수는 순서를 바꾸지 않으므로 건너뜀
+            if (Counts[(Codes[0] >> Shift) & RadixMask] == N)
+            {
+                continue;
+            }
+
+            int32 Offset = 0;
+            for (int32 b = 0; b < NumBuckets; ++b)
+            {
+                const int32 Count = Counts[b];
+                Counts[b] = Offset;
+                Offset += Count;
+            }
+
+            for (int32 i = 0; i < N; ++i)
+            {
+                const int32 Dst = Counts[(Codes[i] >> Shift) & RadixMask]++;
+                TempCodes[Dst] = Codes[i];
+                TempIndices[Dst] = Indices[i];
+            }
+
+            std::swap(Codes, TempCodes);
+            std::swap(Indices, TempIndices);
+        }
+    }
+}
+
+void FBVHierarchy::Rebuild()
+{
+    if (BuildMode == EBVHBuildMode::BinnedSAH)
+    {
+        BuildBinnedSAH();
+    }
+    else
+    {
+        BuildLBVH();
+    }
+
+    FinalizeBuild();
+    ++RebuildCount;
+    bPendingRebuild = false;
+}
+
+void FBVHierarchy::FinalizeBuild()
+{
+    ComponentLeafIndex.Empty();
+    PendingRefitComponents.clear();
+
+    for (int32 NodeIdx = 0; NodeIdx < Nodes.Num(); ++NodeIdx)
+    {
+        const FLBVHNode& Node = Nodes[NodeIdx];
+        if (!Node.IsLeaf())
+        {
+            continue;
+        }
+        for (int32 i = 0; i < Node.Count; ++i)
+        {
+            if (UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i])
+            {
+                ComponentLeafIndex.Add(Component, NodeIdx);
+            }
+        }
+    }
+
+    BuiltSAHCost = ComputeSAHCost();
+    CurrentSAHCost = BuiltSAHCost;
 }
 
 void FBVHierarchy::BuildLBVH()
@@ -333,74 +461,312 @@ void FBVHierarchy::BuildLBVH()
         Codes[i] = Morton3D(Ix, Iy, Iz);
     }
 
-    TArray<std::pair<UPrimitiveComponent*, uint32>> ComponentCodePairs;
-    ComponentCodePairs.resize(N);
+    TArray<int32> SortedIndices;
+    SortedIndices.resize(N);
     for (int i = 0; i < N; ++i)
     {
-        ComponentCodePairs[i] = { StaticMeshComponentArray[i], Codes[i] };
+        SortedIndices[i] = i;
     }
 
-    std::sort(ComponentCodePairs.begin(), ComponentCodePairs.end(),
-        [](const auto& LHS, const auto& RHS)
-        {
-            return LHS.second < RHS.second;
-        });
+    RadixSortMortonCodes(Codes, SortedIndices);
 
+    TArray<UPrimitiveComponent*> SortedComponents;
+    SortedComponents.resize(N);
     for (int i = 0; i < N; ++i)
     {
-        StaticMeshComponentArray[i] = ComponentCodePairs[i].first;
+        SortedComponents[i] = StaticMeshComponentArray[SortedIndices[i]];
     }
+    StaticMeshComponentArray = std::move(SortedComponents);
 
     Nodes.reserve(std::max(1, 2 * N));
     Nodes.clear();
-    BuildRange(0, N);
+    BuildRange(0, N, -1);
 }
 
-int FBVHierarchy::BuildRange(int s, int e)
+int FBVHierarchy::BuildRange(int s, int e, int parent)
 {
     int nodeIdx = static_cast<int>(Nodes.size());
     Nodes.push_back(FLBVHNode{});
     FLBVHNode& node = Nodes[nodeIdx];
+    node.Parent = parent;
 
     int count = e - s;
     if (count <= MaxObjects)
     {
         node.First = s;
         node.Count = count;
-        bool bInitialized = false;
-        FAABB Accumulated;
+        node.Bounds = ComputeLeafBounds(node);
+        return nodeIdx;
+    }
+
+    int mid = (s + e) / 2;
+    int L = BuildRange(s, mid, nodeIdx);
+    int R = BuildRange(mid, e, nodeIdx);
+    node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
+    node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
+    return nodeIdx;
+}
+
+void FBVHierarchy::BuildBinnedSAH()
+{
+    StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
+    const int N = StaticMeshComponentArray.Num();
+    Nodes = TArray<FLBVHNode>();
+
+    if (N == 0)
+    {
+        Bounds = FAABB();
+        return;
+    }
+
+    // 빌드 중 반복 조회를 피하려고 bounds/centroid를 배열로 한 번만 수집
+    TArray<FAABB> ItemBounds;
+    TArray<FVector> Centroids;
+    TArray<int32> Order;
+    ItemBounds.resize(N);
+    Centroids.resize(N);
+    Order.resize(N);
+    for (int i = 0; i < N; ++i)
+    {
+        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
+        const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
+        ItemBounds[i] = Bound ? *Bound : Component->GetWorldAABB();
+        Centroids[i] = ItemBounds[i].GetCenter();
+        Order[i] = i;
+        Bounds = (i == 0) ? ItemBounds[i] : FAABB::Union(Bounds, ItemBounds[i]);
+    }
+
+    Nodes.reserve(std::max(1, 2 * N));
+    BuildBinnedRange(0, N, -1, Order, ItemBounds, Centroids);
+
+    // 리프의 [First, First + Count) 구간이 Order 순서를 가리키므로 컴포넌트 배열도 같은 순서로 재배치
+    TArray<UPrimitiveComponent*> SortedComponents;
+    SortedComponents.resize(N);
+    for (int i = 0; i < N; ++i)
+    {
+        SortedComponents[i] = StaticMeshComponentArray[Order[i]];
+    }
+    StaticMeshComponentArray = std::move(SortedComponents);
+}
+
+int FBVHierarchy::BuildBinnedRange(int s, int e, int parent, TArray<int32>& Order, const TArray<FAABB>& ItemBounds, const TArray<FVector>& Centroids)
+{
+    constexpr int32 NumBins = 12;
+
+    const int nodeIdx = static_cast<int>(Nodes.size());
+    Nodes.push_back(FLBVHNode{});
+    Nodes[nodeIdx].Parent = parent;
+
+    FAABB NodeBounds = ItemBounds[Order[s]];
+    FVector CentroidMin = Centroids[Order[s]];
+    FVector CentroidMax = CentroidMin;
+    for (int i = s + 1; i < e; ++i)
+    {
+        NodeBounds = FAABB::Union(NodeBounds, ItemBounds[Order[i]]);
+        const FVector& C = Centroids[Order[i]];
+        for (int Axis = 0; Axis < 3; ++Axis)
+        {
+            CentroidMin[Axis] = std::min(CentroidMin[Axis], C[Axis]);
+            CentroidMax[Axis] = std::max(CentroidMax[Axis], C[Axis]);
+        }
+    }
+    Nodes[nodeIdx].Bounds = NodeBounds;
+
+    const int count = e - s;
+    if (count <= MaxObjects)
+    {
+        Nodes[nodeIdx].First = s;
+        Nodes[nodeIdx].Count = count;
+        return nodeIdx;
+    }
+
+    // 축별로 centroid를 NumBins개 bin에 나누고, bin 경계 중 SAH 비용(면적 x 개수 합)이 최소인 분할 선택
+    int32 BestAxis = -1;
+    int32 BestSplit = -1;
+    float BestCost = FLT_MAX;
+    for (int Axis = 0; Axis < 3; ++Axis)
+    {
+        const float Extent = CentroidMax[Axis] - CentroidMin[Axis];
+        if (Extent <= 1e-6f)
+        {
+            continue;
+        }
+
+        struct FBin
+        {
+            FAABB Bounds;
+            int32 Count = 0;
+        };
+        FBin Bins[NumBins];
+
+        const float BinScale = NumBins / Extent;
         for (int i = s; i < e; ++i)
         {
-            UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-            if (!Component)
+            const int32 Item = Order[i];
+            const int32 BinIdx = std::min(NumBins - 1, static_cast<int32>((Centroids[Item][Axis] - CentroidMin[Axis]) * BinScale));
+            FBin& Bin = Bins[BinIdx];
+            Bin.Bounds = (Bin.Count == 0) ? ItemBounds[Item] : FAABB::Union(Bin.Bounds, ItemBounds[Item]);
+            ++Bin.Count;
+        }
+
+        // 왼쪽에서 누적한 면적/개수를 저장해두고 오른쪽에서 누적하며 비용 계산
+        float LeftArea[NumBins - 1];
+        int32 LeftCount[NumBins - 1];
+        FAABB Accumulated;
+        int32 AccumulatedCount = 0;
+        for (int32 b = 0; b < NumBins - 1; ++b)
+        {
+            if (Bins[b].Count > 0)
             {
-                continue;
+                Accumulated = (AccumulatedCount == 0) ? Bins[b].Bounds : FAABB::Union(Accumulated, Bins[b].Bounds);
+                AccumulatedCount += Bins[b].Count;
             }
+            LeftArea[b] = AccumulatedCount > 0 ? SurfaceArea(Accumulated) : 0.0f;
+            LeftCount[b] = AccumulatedCount;
+        }
 
-            const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-            const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
-            if (!bInitialized)
+        AccumulatedCount = 0;
+        for (int32 b = NumBins - 1; b > 0; --b)
+        {
+            if (Bins[b].Count > 0)
             {
-                Accumulated = LocalBound;
-                bInitialized = true;
+                Accumulated = (AccumulatedCount == 0) ? Bins[b].Bounds : FAABB::Union(Accumulated, Bins[b].Bounds);
+                AccumulatedCount += Bins[b].Count;
             }
-            else
+            if (AccumulatedCount == 0 || LeftCount[b - 1] == 0)
+            {
+                continue;
+            }
+
+            const float Cost = LeftArea[b - 1] * LeftCount[b - 1] + SurfaceArea(Accumulated) * AccumulatedCount;
+            if (Cost < BestCost)
             {
-                Accumulated = FAABB::Union(Accumulated, LocalBound);
+                BestCost = Cost;
+                BestAxis = Axis;
+                BestSplit = b;
             }
         }
-        node.Bounds = bInitialized ? Accumulated : Bounds;
-        return nodeIdx;
     }
 
     int mid = (s + e) / 2;
-    int L = BuildRange(s, mid);
-    int R = BuildRange(mid, e);
-    node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
-    node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
+    if (BestAxis >= 0)
+    {
+        const float BinScale = NumBins / (CentroidMax[BestAxis] - CentroidMin[BestAxis]);
+        const float AxisMin = CentroidMin[BestAxis];
+        int32* SplitIt = std::partition(Order.data() + s, Order.data() + e, [&](int32 Item)
+            {
+                const int32 BinIdx = std::min(NumBins - 1, static_cast<int32>((Centroids[Item][BestAxis] - AxisMin) * BinScale));
+                return BinIdx < BestSplit;
+            });
+        mid = static_cast<int>(SplitIt - Order.data());
+    }
+
+    // centroid가 모두 겹치는 등 분할이 안 되면 개수 기준 중앙 분할로 폴백
+    if (mid <= s || mid >= e)
+    {
+        mid = (s + e) / 2;
+    }
+
+    const int L = BuildBinnedRange(s, mid, nodeIdx, Order, ItemBounds, Centroids);
+    const int R = BuildBinnedRange(mid, e, nodeIdx, Order, ItemBounds, Centroids);
+    Nodes[nodeIdx].Left = L;
+    Nodes[nodeIdx].Right = R;
     return nodeIdx;
 }
 
+FAABB FBVHierarchy::ComputeLeafBounds(const FLBVHNode& Node) const
+{
+    bool bInitialized = false;
+    FAABB Accumulated;
+    for (int i = Node.First; i < Node.First + Node.Count; ++i)
+    {
+        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
+        if (!Component)
+        {
+            continue;
+        }
+
+        const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
+        const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
+        if (!bInitialized)
+        {
+            Accumulated = LocalBound;
+            bInitialized = true;
+        }
+        else
+        {
+            Accumulated = FAABB::Union(Accumulated, LocalBound);
+        }
+    }
+    return bInitialized ? Accumulated : Bounds;
+}
+
+void FBVHierarchy::Refit()
+{
+    for (UPrimitiveComponent* Component : PendingRefitComponents)
+    {
+        const int32* LeafIdx = ComponentLeafIndex.Find(Component);
+        if (!LeafIdx)
+        {
+            continue;
+        }
+
+        FLBVHNode& Leaf = Nodes[*LeafIdx];
+        const FAABB LeafBounds = ComputeLeafBounds(Leaf);
+        if (IsSameBounds(Leaf.Bounds, LeafBounds))
+        {
+            continue;
+        }
+        Leaf.Bounds = LeafBounds;
+
+        // 부모 방향으로 올라가며 자식 합집합으로 갱신, 변화가 없으면 그 위도 동일하므로 중단
+        int32 ParentIdx = Leaf.Parent;
+        while (ParentIdx >= 0)
+        {
+            FLBVHNode& ParentNode = Nodes[ParentIdx];
+            const FAABB Merged = FAABB::Union(Nodes[ParentNode.Left].Bounds, Nodes[ParentNode.Right].Bounds);
+            if (IsSameBounds(ParentNode.Bounds, Merged))
+            {
+                break;
+            }
+            ParentNode.Bounds = Merged;
+            ParentIdx = ParentNode.Parent;
+        }
+    }
+    PendingRefitComponents.clear();
+
+    if (!Nodes.empty())
+    {
+        Bounds = Nodes[0].Bounds;
+    }
+    ++RefitCount;
+}
+
+float FBVHierarchy::ComputeSAHCost() const
+{
+    if (Nodes.empty())
+    {
+        return 0.0f;
+    }
+
+    // 루트 면적으로 정규화한 SAH 비용 (내부 노드 순회 1, 리프 컴포넌트 검사 1로 가정)
+    const float RootArea = SurfaceArea(Nodes[0].Bounds);
+    if (RootArea <= 1e-8f)
+    {
+        return 0.0f;
+    }
+
+    constexpr float TraversalCost = 1.0f;
+    constexpr float IntersectCost = 1.0f;
+    float Cost = 0.0f;
+    for (const FLBVHNode& Node : Nodes)
+    {
+        const float AreaRatio = SurfaceArea(Node.Bounds) / RootArea;
+        Cost += AreaRatio * (Node.IsLeaf() ? IntersectCost * Node.Count : TraversalCost);
+    }
+    return Cost;
+}
+
 void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
 {
     OutActor = nullptr;
@@ -498,8 +864,22 @@ void FBVHierarchy::FlushRebuild()
 {
     if (bPendingRebuild)
     {
-        BuildLBVH();
-        bPendingRebuild = false;
+        Rebuild();
+        return;
+    }
+
+    if (PendingRefitComponents.empty())
+    {
+        return;
+    }
+
+    Refit();
+
+    // 이동이 누적되어 노드 겹침이 커지면(SAH 비용 증가) 그때만 재빌드
+    CurrentSAHCost = ComputeSAHCost();
+    if (BuiltSAHCost > 0.0f && CurrentSAHCost > BuiltSAHCost * RefitRebuildThreshold)
+    {
+        Rebuild();
     }
 }
 
@@ -557,6 +937,44 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FAAB
     );
 }
 
+// FAABB 오버로드 (프레임 배열 출력)
+void FBVHierarchy::QueryIntersectedComponents(const FAABB& InBound, TFrameArray<UPrimitiveComponent*>& OutComponents) const
+{
+    if (Nodes.empty())
+        return;
+
+    TFrameArray<int32> IdxStack;
+    IdxStack.reserve(64);
+    IdxStack.push_back(0);
+
+    while (!IdxStack.empty())
+    {
+        const int32 Idx = IdxStack.back();
+        IdxStack.pop_back();
+        const FLBVHNode& Node = Nodes[Idx];
+        if (!Node.Bounds.Intersects(InBound))
+            continue;
+
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
+                const FAABB* Cached = Component ? StaticMeshComponentBounds.Find(Component) : nullptr;
+                if (Cached && InBound.Intersects(*Cached))
+                {
+                    OutComponents.Add(Component);
+                }
+            }
+        }
+        else
+        {
+            if (Node.Left >= 0) IdxStack.push_back(Node.Left);
+            if (Node.Right >= 0) IdxStack.push_back(Node.Right);
+        }
+    }
+}
+
 // FOBB 오버로드
 TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FOBB& InBound) const
 {
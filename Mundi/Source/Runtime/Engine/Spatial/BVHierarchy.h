@@ -7,6 +7,17 @@ class AActor;
 struct FOBB;
 struct FBoundingSphere;
 
+/**
+ * BVH 빌드 방식
+ * - LBVH: Morton 코드 기반, 빌드가 빠름 (기본값, 자주 바뀌는 씬)
+ * - BinnedSAH: 축별 centroid bin으로 SAH 분할, 빌드는 느리지만 쿼리 트리 품질이 좋음 (정적 콘텐츠)
+ */
+enum class EBVHBuildMode : uint8
+{
+    LBVH,
+    BinnedSAH,
+};
+
 /**
  * @brief Broad phase BVH based on UPrimitiveComponent
  */
@@ -30,14 +41,27 @@ public:
     void Update(UPrimitiveComponent* InComponent);
     void Remove(UPrimitiveComponent* InComponent);
 
+    /**
+     * 대기 중인 변경 반영
+     * - 추가/삭제가 있으면 전체 재빌드
+     * - 이동만 있으면 리프부터 부모 방향으로 bounds refit, SAH 비용이 빌드 직후 대비
+     *   RefitRebuildThreshold 배를 넘으면 그때만 재빌드
+     */
     void FlushRebuild();
 
+    void SetBuildMode(EBVHBuildMode InMode);
+    EBVHBuildMode GetBuildMode() const { return BuildMode; }
+    void SetRefitRebuildThreshold(float InThreshold) { RefitRebuildThreshold = InThreshold; }
+
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
     void QueryFrustum(const FFrustum& InFrustum);
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
 
+    // 할당 없는 AABB 쿼리: 결과를 OutComponents 뒤에 추가 (중복 제거용 TSet 없이, 컴포넌트는 리프에 한 번만 있음)
+    void QueryIntersectedComponents(const FAABB& InBound, TFrameArray<UPrimitiveComponent*>& OutComponents) const;
+
     void DebugDraw(URenderer* Renderer) const;
 
     // Debug/Stats
@@ -46,6 +70,10 @@ public:
     int MaxOccupiedDepth() const;
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
+    int32 GetRebuildCount() const { return RebuildCount; }
+    int32 GetRefitCount() const { return RefitCount; }
+    float GetSAHCost() const { return CurrentSAHCost; }
+    float GetBuiltSAHCost() const { return BuiltSAHCost; }
 
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
@@ -59,9 +87,16 @@ private:
         int32 Right = -1;
         int32 First = -1;
         int32 Count = 0;
+        int32 Parent = -1;
         bool IsLeaf() const { return Count > 0; }
     };
+    void Rebuild();
     void BuildLBVH();
+    void BuildBinnedSAH();
+    void Refit();
+    void FinalizeBuild();
+    FAABB ComputeLeafBounds(const FLBVHNode& Node) const;
+    float ComputeSAHCost() const;
 
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
@@ -69,18 +104,31 @@ private:
         , NodeIntersectFunc NodeIntersects
         , ComponentIntersectFunc ComponentIntersects) const;
 
-    int BuildRange(int s, int e);
+    int BuildRange(int s, int e, int parent);
+    int BuildBinnedRange(int s, int e, int parent, TArray<int32>& Order, const TArray<FAABB>& ItemBounds, const TArray<FVector>& Centroids);
 
     int Depth;
     int MaxDepth;
     int MaxObjects;
     FAABB Bounds;
 
-    TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
+    TFlatMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
 
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
+    // 컴포넌트 -> 소속 리프 노드 인덱스 (빌드마다 갱신, refit 경로에서 사용)
+    TFlatMap<UPrimitiveComponent*, int32> ComponentLeafIndex;
+    // 이동만 한 컴포넌트 (다음 FlushRebuild에서 refit)
+    TArray<UPrimitiveComponent*> PendingRefitComponents;
+
+    EBVHBuildMode BuildMode = EBVHBuildMode::LBVH;
+    float RefitRebuildThreshold = 1.5f;
+    float BuiltSAHCost = 0.0f;
+    float CurrentSAHCost = 0.0f;
+    int32 RebuildCount = 0;
+    int32 RefitCount = 0;
+
     bool bPendingRebuild = false;
 };
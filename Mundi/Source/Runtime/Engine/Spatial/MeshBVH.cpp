@@ -1,10 +1,156 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include "JobSystem.h"
+#include <immintrin.h>
 
-void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+namespace
+{
+	// BVH4 깊이 * 3 (노드당 최대 3개를 더 쌓음) 보다 넉넉하게
+	constexpr int32 MeshBVHStackSize = 256;
+
+	// 방향 성분이 0이면 슬랩 테스트가 NaN을 만들지 않도록 큰 유한값으로 대체
+	float SafeInverse(float Value)
+	{
+		if (std::abs(Value) < 1e-8f)
+		{
+			return Value < 0.0f ? -1e30f : 1e30f;
+		}
+		return 1.0f / Value;
+	}
+
+	/**
+	 * 한 레이에 대해 트리 순회 중 변하지 않는 값들을 미리 splat 해둔다.
+	 * 방향 부호별로 near/far 평면을 고르므로 min/max 스왑이 필요 없고,
+	 * 빈 슬롯(Min=+Inf, Max=-Inf)은 항상 near > far 가 되어 자연스럽게 걸러진다.
+	 */
+	struct FMeshBVHRay
+	{
+		__m128 OriginX, OriginY, OriginZ;
+		__m128 DirX, DirY, DirZ;
+		__m128 InvDirX, InvDirY, InvDirZ;
+		bool bNegX, bNegY, bNegZ;
+
+		explicit FMeshBVHRay(const FRay& InRay)
+		{
+			OriginX = _mm_set1_ps(InRay.Origin.X);
+			OriginY = _mm_set1_ps(InRay.Origin.Y);
+			OriginZ = _mm_set1_ps(InRay.Origin.Z);
+			DirX = _mm_set1_ps(InRay.Direction.X);
+			DirY = _mm_set1_ps(InRay.Direction.Y);
+			DirZ = _mm_set1_ps(InRay.Direction.Z);
+			InvDirX = _mm_set1_ps(SafeInverse(InRay.Direction.X));
+			InvDirY = _mm_set1_ps(SafeInverse(InRay.Direction.Y));
+			InvDirZ = _mm_set1_ps(SafeInverse(InRay.Direction.Z));
+			bNegX = InRay.Direction.X < 0.0f;
+			bNegY = InRay.Direction.Y < 0.0f;
+			bNegZ = InRay.Direction.Z < 0.0f;
+		}
+	};
+
+	// 자식 4개 AABB 슬랩 테스트. 반환값은 교차한 레인 비트마스크, OutEntry에 진입 거리
+	int IntersectChildren4(const FMeshBVHRay& Ray, const FMeshBVH4Node& Node, float MaxDistance, __m128& OutEntry)
+	{
+		const __m128 NearX = _mm_load_ps(Ray.bNegX ? Node.MaxX : Node.MinX);
+		const __m128 FarX = _mm_load_ps(Ray.bNegX ? Node.MinX : Node.MaxX);
+		const __m128 NearY = _mm_load_ps(Ray.bNegY ? Node.MaxY : Node.MinY);
+		const __m128 FarY = _mm_load_ps(Ray.bNegY ? Node.MinY : Node.MaxY);
+		const __m128 NearZ = _mm_load_ps(Ray.bNegZ ? Node.MaxZ : Node.MinZ);
+		const __m128 FarZ = _mm_load_ps(Ray.bNegZ ? Node.MinZ : Node.MaxZ);
+
+		const __m128 EntryX = _mm_mul_ps(_mm_sub_ps(NearX, Ray.OriginX), Ray.InvDirX);
+		const __m128 EntryY = _mm_mul_ps(_mm_sub_ps(NearY, Ray.OriginY), Ray.InvDirY);
+		const __m128 EntryZ = _mm_mul_ps(_mm_sub_ps(NearZ, Ray.OriginZ), Ray.InvDirZ);
+		const __m128 ExitX = _mm_mul_ps(_mm_sub_ps(FarX, Ray.OriginX), Ray.InvDirX);
+		const __m128 ExitY = _mm_mul_ps(_mm_sub_ps(FarY, Ray.OriginY), Ray.InvDirY);
+		const __m128 ExitZ = _mm_mul_ps(_mm_sub_ps(FarZ, Ray.OriginZ), Ray.InvDirZ);
+
+		// 레이 시작점 뒤쪽은 보지 않고, 이미 찾은 교차보다 먼 구간도 보지 않는다
+		const __m128 Entry = _mm_max_ps(_mm_max_ps(EntryX, EntryY), _mm_max_ps(EntryZ, _mm_setzero_ps()));
+		const __m128 Exit = _mm_min_ps(_mm_min_ps(ExitX, ExitY), _mm_min_ps(ExitZ, _mm_set1_ps(MaxDistance)));
+
+		OutEntry = Entry;
+		return _mm_movemask_ps(_mm_cmple_ps(Entry, Exit));
+	}
+
+	// 패킷 안의 삼각형 4개에 대한 Möller–Trumbore (IntersectRayTriangleMT와 같은 epsilon 규칙)
+	// InOutClosest보다 가까운 교차가 있으면 갱신하고 true
+	bool IntersectPacket(const FMeshBVHRay& Ray, const FMeshBVHTriPacket& Packet, float& InOutClosest)
+	{
+		const __m128 Epsilon = _mm_set1_ps(KINDA_SMALL_NUMBER);
+		const __m128 NegEpsilon = _mm_set1_ps(-KINDA_SMALL_NUMBER);
+		const __m128 OnePlusEpsilon = _mm_set1_ps(1.0f + KINDA_SMALL_NUMBER);
+		const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+		const __m128 E1X = _mm_load_ps(Packet.E1X);
+		const __m128 E1Y = _mm_load_ps(Packet.E1Y);
+		const __m128 E1Z = _mm_load_ps(Packet.E1Z);
+		const __m128 E2X = _mm_load_ps(Packet.E2X);
+		const __m128 E2Y = _mm_load_ps(Packet.E2Y);
+		const __m128 E2Z = _mm_load_ps(Packet.E2Z);
+
+		// Perpendicular = Direction x Edge2
+		const __m128 PX = _mm_sub_ps(_mm_mul_ps(Ray.DirY, E2Z), _mm_mul_ps(Ray.DirZ, E2Y));
+		const __m128 PY = _mm_sub_ps(_mm_mul_ps(Ray.DirZ, E2X), _mm_mul_ps(Ray.DirX, E2Z));
+		const __m128 PZ = _mm_sub_ps(_mm_mul_ps(Ray.DirX, E2Y), _mm_mul_ps(Ray.DirY, E2X));
+
+		const __m128 Determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E1X, PX), _mm_mul_ps(E1Y, PY)), _mm_mul_ps(E1Z, PZ));
+		__m128 Valid = _mm_cmpge_ps(_mm_and_ps(Determinant, AbsMask), Epsilon);
+		if (_mm_movemask_ps(Valid) == 0)
+		{
+			return false;
+		}
+		const __m128 InvDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Determinant);
+
+		// OriginToA = Origin - V0
+		const __m128 SX = _mm_sub_ps(Ray.OriginX, _mm_load_ps(Packet.V0X));
+		const __m128 SY = _mm_sub_ps(Ray.OriginY, _mm_load_ps(Packet.V0Y));
+		const __m128 SZ = _mm_sub_ps(Ray.OriginZ, _mm_load_ps(Packet.V0Z));
+
+		const __m128 U = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(SX, PX), _mm_mul_ps(SY, PY)), _mm_mul_ps(SZ, PZ)), InvDeterminant);
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpge_ps(U, NegEpsilon), _mm_cmple_ps(U, OnePlusEpsilon)));
+		if (_mm_movemask_ps(Valid) == 0)
+		{
+			return false;
+		}
+
+		// CrossQ = OriginToA x Edge1
+		const __m128 QX = _mm_sub_ps(_mm_mul_ps(SY, E1Z), _mm_mul_ps(SZ, E1Y));
+		const __m128 QY = _mm_sub_ps(_mm_mul_ps(SZ, E1X), _mm_mul_ps(SX, E1Z));
+		const __m128 QZ = _mm_sub_ps(_mm_mul_ps(SX, E1Y), _mm_mul_ps(SY, E1X));
+
+		const __m128 V = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Ray.DirX, QX), _mm_mul_ps(Ray.DirY, QY)), _mm_mul_ps(Ray.DirZ, QZ)), InvDeterminant);
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpge_ps(V, NegEpsilon), _mm_cmple_ps(_mm_add_ps(U, V), OnePlusEpsilon)));
+
+		const __m128 T = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(E2X, QX), _mm_mul_ps(E2Y, QY)), _mm_mul_ps(E2Z, QZ)), InvDeterminant);
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpgt_ps(T, Epsilon), _mm_cmplt_ps(T, _mm_set1_ps(InOutClosest))));
+
+		const int HitMask = _mm_movemask_ps(Valid);
+		if (HitMask == 0)
+		{
+			return false;
+		}
+
+		alignas(16) float Distances[4];
+		_mm_store_ps(Distances, T);
+		for (int Lane = 0; Lane < 4; ++Lane)
+		{
+			if ((HitMask & (1 << Lane)) && Distances[Lane] < InOutClosest)
+			{
+				InOutClosest = Distances[Lane];
+			}
+		}
+		return true;
+	}
+}
+
+void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, uint32 InLeafSize, bool bKeepBinaryTree)
 {
 	TriIndices.Empty();
 	Nodes.Empty();
+	Nodes4.Empty();
+	Packets.Empty();
+	LeafSize = std::max(InLeafSize, 1u);
+
 	uint32 TriCount = Indices.Num() / 3;
 	if (TriCount == 0) return;
 
@@ -13,11 +159,110 @@ void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>
 		TriIndices.Add(t);
 
 	BuildRecursive(0, TriCount, Vertices, Indices);
+
+	// 이진 트리 → BVH4 평탄화. 쿼리는 Nodes4/Packets만 보므로 빌드용 데이터는 해제
+	Nodes4.Reserve(Nodes.Num() / 2 + 1);
+	Packets.Reserve((TriCount + 3) / 4 + Nodes.Num() / 2);
+	CollapseRecursive(0, Vertices, Indices);
+
+	if (bKeepBinaryTree)
+	{
+		return;
+	}
+
+	Nodes.Empty();
+	Nodes.Shrink();
+	TriIndices.Empty();
+	TriIndices.Shrink();
 }
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
+// 가까운 자식부터 내려가며(DFS) 현재까지 찾은 최근접 교차보다 먼 노드는 건너뛴다.
+// 리프에서는 패킹된 삼각형 4개씩 SSE Möller–Trumbore로 검사
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const
+{
+	if (Nodes4.Num() == 0)
+	{
+		return false;
+	}
+
+	const FMeshBVHRay Ray(InLocalRay);
+	float ClosestHitDistance = FLT_MAX;
+
+	struct FStackEntry
+	{
+		int32 NodeIndex;
+		float EntryDistance;
+	};
+	FStackEntry Stack[MeshBVHStackSize];
+	int32 StackSize = 0;
+	Stack[StackSize++] = { 0, 0.0f };
+
+	while (StackSize > 0)
+	{
+		const FStackEntry Current = Stack[--StackSize];
+		if (Current.EntryDistance > ClosestHitDistance)
+		{
+			continue;
+		}
+
+		const FMeshBVH4Node& Node = Nodes4[Current.NodeIndex];
+		__m128 EntryVector;
+		const int HitMask = IntersectChildren4(Ray, Node, ClosestHitDistance, EntryVector);
+		if (HitMask == 0)
+		{
+			continue;
+		}
+
+		alignas(16) float Entries[4];
+		_mm_store_ps(Entries, EntryVector);
+
+		// 교차한 내부 노드 자식은 먼 것부터 쌓아서 가까운 것이 먼저 꺼내지도록 한다
+		FStackEntry Pending[4];
+		int32 PendingCount = 0;
+		for (int Lane = 0; Lane < 4; ++Lane)
+		{
+			if ((HitMask & (1 << Lane)) == 0)
+			{
+				continue;
+			}
+
+			if (Node.PacketCount[Lane] > 0)
+			{
+				// 리프는 바로 검사해서 ClosestHitDistance를 빨리 줄인다
+				const FMeshBVHTriPacket* Packet = &Packets[Node.Child[Lane]];
+				for (uint32 PacketIndex = 0; PacketIndex < Node.PacketCount[Lane]; ++PacketIndex)
+				{
+					IntersectPacket(Ray, Packet[PacketIndex], ClosestHitDistance);
+				}
+				continue;
+			}
+
+			FStackEntry Entry{ Node.Child[Lane], Entries[Lane] };
+			int32 InsertAt = PendingCount++;
+			while (InsertAt > 0 && Pending[InsertAt - 1].EntryDistance < Entry.EntryDistance)
+			{
+				Pending[InsertAt] = Pending[InsertAt - 1];
+				--InsertAt;
+			}
+			Pending[InsertAt] = Entry;
+		}
+
+		for (int32 i = 0; i < PendingCount && StackSize < MeshBVHStackSize; ++i)
+		{
+			Stack[StackSize++] = Pending[i];
+		}
+	}
+
+	if (ClosestHitDistance < FLT_MAX)
+	{
+		OutHitDistance = ClosestHitDistance;
+		return true;
+	}
+	return false;
+}
+
+// 평탄화 이전 경로 그대로: 진입 거리 최소 힙으로 이진 노드를 꺼내고, 리프에서 첫 교차가 나오면 바로 종료
+bool FMeshBVH::IntersectRayBinary(const FRay& InLocalRay,
 	const TArray<FNormalVertex>& InVertices,
 	const TArray<uint32>& InIndices,
 	float& OutHitDistance)
@@ -58,135 +303,66 @@ bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
 			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
 			{
 				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
-
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+				const FVector& A = InVertices[InIndices[3 * TriangleID + 0]].pos;
+				const FVector& B = InVertices[InIndices[3 * TriangleID + 1]].pos;
+				const FVector& C = InVertices[InIndices[3 * TriangleID + 2]].pos;
 
 				float HitT = 0.0f;
 				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
 				{
 					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
+					return true;
 				}
 			}
 		}
 		else
 		{
-			if (Node.Left >= 0)
+			float ChildEntry, ChildExit;
+			if (Node.Left >= 0 && Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Left, ChildEntry });
-				}
+				Heap.push({ Node.Left, ChildEntry });
 			}
-			if (Node.Right >= 0)
+			if (Node.Right >= 0 && Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Right, ChildEntry });
-				}
+				Heap.push({ Node.Right, ChildEntry });
 			}
 		}
 	}
 
 	return false;
 }
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
+
+int32 FMeshBVH::IntersectRays(const TArray<FRay>& InLocalRays, TArray<float>& OutHitDistances) const
+{
+	const int32 NumRays = InLocalRays.Num();
+	OutHitDistances.SetNum(NumRays);
+	if (NumRays == 0)
+	{
+		return 0;
+	}
+
+	// 트리는 읽기 전용이라 레이 구간별로 나눠서 병렬 처리 (레이 하나는 수 μs 수준이라 배치를 크게)
+	const FRay* Rays = InLocalRays.GetData();
+	float* Distances = OutHitDistances.GetData();
+	ParallelForRange(NumRays, [this, Rays, Distances](int32 Begin, int32 End)
+	{
+		for (int32 RayIndex = Begin; RayIndex < End; ++RayIndex)
+		{
+			float HitDistance;
+			Distances[RayIndex] = IntersectRay(Rays[RayIndex], HitDistance) ? HitDistance : FLT_MAX;
+		}
+	}, 64);
+
+	int32 NumHits = 0;
+	for (int32 RayIndex = 0; RayIndex < NumRays; ++RayIndex)
+	{
+		if (Distances[RayIndex] < FLT_MAX)
+		{
+			++NumHits;
+		}
+	}
+	return NumHits;
+}
 
 FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
 {
@@ -331,3 +507,124 @@ int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVer
 
 	return NodeIndex;
 }
+
+// 이진 노드 하나를 BVH4 노드 하나로 접는다.
+// 자식 슬롯이 4개가 될 때까지 표면적이 가장 큰 내부 노드 자식을 그 자식 둘로 펼친다.
+int32 FMeshBVH::CollapseRecursive(int32 BinaryNodeIndex, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	int32 Slots[4];
+	int32 SlotCount = 0;
+
+	const FMeshBVHNode& Root = Nodes[BinaryNodeIndex];
+	if (Root.IsLeaf())
+	{
+		// 삼각형이 LeafSize 이하인 메시는 루트 자체가 리프
+		Slots[SlotCount++] = BinaryNodeIndex;
+	}
+	else
+	{
+		Slots[SlotCount++] = Root.Left;
+		Slots[SlotCount++] = Root.Right;
+	}
+
+	while (SlotCount < 4)
+	{
+		int32 ExpandSlot = -1;
+		float LargestArea = -1.0f;
+		for (int32 i = 0; i < SlotCount; ++i)
+		{
+			const FMeshBVHNode& Candidate = Nodes[Slots[i]];
+			if (Candidate.IsLeaf())
+			{
+				continue;
+			}
+			const FVector Size = Candidate.Bounds.Max - Candidate.Bounds.Min;
+			const float Area = Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X;
+			if (Area > LargestArea)
+			{
+				LargestArea = Area;
+				ExpandSlot = i;
+			}
+		}
+		if (ExpandSlot < 0)
+		{
+			break;
+		}
+
+		const FMeshBVHNode& Expanded = Nodes[Slots[ExpandSlot]];
+		Slots[ExpandSlot] = Expanded.Left;
+		Slots[SlotCount++] = Expanded.Right;
+	}
+
+	// 자식 재귀 중 Nodes4가 재할당될 수 있으므로 로컬에서 채운 뒤 마지막에 복사
+	const int32 NodeIndex = Nodes4.Num();
+	Nodes4.Add(FMeshBVH4Node());
+
+	FMeshBVH4Node Node;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		Node.MinX[i] = Node.MinY[i] = Node.MinZ[i] = FLT_MAX;
+		Node.MaxX[i] = Node.MaxY[i] = Node.MaxZ[i] = -FLT_MAX;
+		Node.Child[i] = -1;
+		Node.PacketCount[i] = 0;
+	}
+
+	for (int32 i = 0; i < SlotCount; ++i)
+	{
+		const FMeshBVHNode& Child = Nodes[Slots[i]];
+		Node.MinX[i] = Child.Bounds.Min.X;
+		Node.MinY[i] = Child.Bounds.Min.Y;
+		Node.MinZ[i] = Child.Bounds.Min.Z;
+		Node.MaxX[i] = Child.Bounds.Max.X;
+		Node.MaxY[i] = Child.Bounds.Max.Y;
+		Node.MaxZ[i] = Child.Bounds.Max.Z;
+
+		if (Child.IsLeaf())
+		{
+			Node.Child[i] = static_cast<int32>(Packets.Num());
+			Node.PacketCount[i] = PackLeafTriangles(Child, Vertices, Indices);
+		}
+		else
+		{
+			Node.Child[i] = CollapseRecursive(Slots[i], Vertices, Indices);
+		}
+	}
+
+	Nodes4[NodeIndex] = Node;
+	return NodeIndex;
+}
+
+// 리프 삼각형을 4개씩 패킷으로 옮기고 만든 패킷 수를 반환
+uint32 FMeshBVH::PackLeafTriangles(const FMeshBVHNode& Leaf, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	const uint32 PacketCount = (Leaf.Count + 3) / 4;
+	for (uint32 PacketIndex = 0; PacketIndex < PacketCount; ++PacketIndex)
+	{
+		FMeshBVHTriPacket Packet;
+		for (uint32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const uint32 TriOffset = PacketIndex * 4 + Lane;
+			if (TriOffset >= Leaf.Count)
+			{
+				// 빈 레인: Edge가 0이라 determinant가 0 → 항상 실패
+				Packet.V0X[Lane] = Packet.V0Y[Lane] = Packet.V0Z[Lane] = 0.0f;
+				Packet.E1X[Lane] = Packet.E1Y[Lane] = Packet.E1Z[Lane] = 0.0f;
+				Packet.E2X[Lane] = Packet.E2Y[Lane] = Packet.E2Z[Lane] = 0.0f;
+				continue;
+			}
+
+			const uint32 TriangleID = TriIndices[Leaf.Start + TriOffset];
+			const FVector& A = Vertices[Indices[3 * TriangleID + 0]].pos;
+			const FVector& B = Vertices[Indices[3 * TriangleID + 1]].pos;
+			const FVector& C = Vertices[Indices[3 * TriangleID + 2]].pos;
+			const FVector Edge1 = B - A;
+			const FVector Edge2 = C - A;
+
+			Packet.V0X[Lane] = A.X;     Packet.V0Y[Lane] = A.Y;     Packet.V0Z[Lane] = A.Z;
+			Packet.E1X[Lane] = Edge1.X; Packet.E1Y[Lane] = Edge1.Y; Packet.E1Z[Lane] = Edge1.Z;
+			Packet.E2X[Lane] = Edge2.X; Packet.E2Y[Lane] = Edge2.Y; Packet.E2Z[Lane] = Edge2.Z;
+		}
+		Packets.Add(Packet);
+	}
+	return PacketCount;
+}
@@ -1,30 +1,71 @@
 ﻿#pragma once
 #include "AABB.h"
 
+// 빌드 전용 이진 노드 (빌드 후 FMeshBVH4Node로 평탄화되고 해제된다, bKeepBinaryTree면 비교용으로 남김)
 struct FMeshBVHNode
 {
 	FAABB Bounds;     // 이 노드가 감싸는 AABB
 	int Left = -1;     // 왼쪽 자식 인덱스
 	int Right = -1;    // 오른쪽 자식 인덱스
 	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
-	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수
 
 	bool IsLeaf() const { return Count > 0; }
 };
 
-struct FStackItem
+/**
+ * 4-wide BVH 노드 (자식 4개의 AABB를 SoA로 저장 → SSE 한 번에 4개 슬랩 테스트)
+ * - PacketCount[i] == 0 : Child[i]는 내부 노드 인덱스 (-1이면 빈 슬롯)
+ * - PacketCount[i] >  0 : Child[i]는 Packets 배열 시작 위치 (리프)
+ * 빈 슬롯은 Min=+Inf, Max=-Inf 로 채워서 슬랩 테스트에서 항상 실패한다.
+ */
+struct alignas(16) FMeshBVH4Node
 {
-	int32 NodeIndex;
-	float EntryDistance;
+	float MinX[4], MinY[4], MinZ[4];
+	float MaxX[4], MaxY[4], MaxZ[4];
+	int32 Child[4];
+	uint32 PacketCount[4];
 };
+
+/**
+ * 삼각형 4개를 Möller–Trumbore에 바로 쓰는 형태(V0, Edge1, Edge2)로 SoA 패킹
+ * 정점/인덱스 버퍼를 다시 읽지 않고 리프 안에서 SSE로 4개를 한 번에 검사한다.
+ * 남는 레인은 Edge가 0인 퇴화 삼각형이라 determinant 검사에서 걸러진다.
+ */
+struct alignas(16) FMeshBVHTriPacket
+{
+	float V0X[4], V0Y[4], V0Z[4];
+	float E1X[4], E1Y[4], E1Z[4];
+	float E2X[4], E2Y[4], E2Z[4];
+};
+
 class FMeshBVH
 {
 public:
 
-	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	/**
+	 * @param InLeafSize 리프당 최대 삼각형 수 (4개 단위로 패킷에 담기므로 4의 배수가 효율적)
+	 * @param bKeepBinaryTree 평탄화 전 이진 트리를 해제하지 않음 (IntersectRayBinary 비교용, 벤치마크 전용)
+	 */
+	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, uint32 InLeafSize = 4, bool bKeepBinaryTree = false);
+
+	// 가장 가까운 교차 거리 반환 (로컬 공간 레이)
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const;
+
+	/**
+	 * 4-wide 평탄화 이전의 이진 트리 순회 (최소 힙 + 정점/인덱스 버퍼 직접 읽기)
+	 * bKeepBinaryTree로 빌드했을 때만 동작하며, 진입 거리가 가장 가까운 리프의 첫 교차를 반환한다.
+	 */
+	bool IntersectRayBinary(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	/**
+	 * 여러 레이를 한 번에 검사 (배치가 크면 잡 시스템으로 분산)
+	 * @param OutHitDistances 레이별 가장 가까운 교차 거리, 교차가 없으면 FLT_MAX
+	 * @return 교차한 레이 개수
+	 */
+	int32 IntersectRays(const TArray<FRay>& InLocalRays, TArray<float>& OutHitDistances) const;
 
+	bool IsEmpty() const { return Nodes4.Num() == 0; }
 
 private:
 	// Helper 함수들
@@ -36,12 +77,22 @@ private:
 
 	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
+	// 이진 트리를 4-wide 노드로 접고 리프 삼각형을 패킷으로 모은다
+	int32 CollapseRecursive(int32 BinaryNodeIndex, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+
+	uint32 PackLeafTriangles(const FMeshBVHNode& Leaf, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+
 private:
 
+	// 빌드 중에만 쓰는 이진 트리
 	TArray<FMeshBVHNode> Nodes;
-	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
+	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다.
 	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
 	TArray<uint32> TriIndices;
-	const uint32 LeafSize = 4;
-};
 
+	// 쿼리용 평탄화된 트리 (루트는 0번)
+	TArray<FMeshBVH4Node> Nodes4;
+	TArray<FMeshBVHTriPacket> Packets;
+
+	uint32 LeafSize = 4;
+};
@@ -0,0 +1,167 @@
+﻿#include "pch.h"
+#include "Benchmark.h"
+#include "MeshBVH.h"
+#include "Picking.h"
+#include "ResourceManager.h"
+#include "StaticMesh.h"
+#include <random>
+
+// 메시 BVH 레이 쿼리 벤치마크 (콘솔: BENCH MESHBVH)
+// 로드된 모든 스태틱 메시에 대해 빌드 시간, 단일/배치 레이 쿼리 시간, 선형 삼각형 스캔 대비 결과 일치를 확인한다.
+// 기준선은 4-wide 평탄화 이전의 이진 트리 순회(IntersectRayBinary)이며, 같은 레이로 시간을 재서 배율을 함께 출력한다.
+
+namespace
+{
+	constexpr int32 NumRays = 20000;
+	constexpr int32 BruteForceStride = 7;	// 선형 스캔은 느리므로 7개 중 1개만 비교
+
+	// 메시를 감싸는 구 위에서 내부의 임의 점을 향하는 레이 (10%는 중심에서 출발, 2%는 수직 하향)
+	void BuildRays(const FStaticMesh& Mesh, TArray<FRay>& OutRays)
+	{
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const FNormalVertex& Vertex : Mesh.Vertices)
+		{
+			Min = Min.ComponentMin(Vertex.pos);
+			Max = Max.ComponentMax(Vertex.pos);
+		}
+		const FVector Center = (Min + Max) * 0.5f;
+		const FVector Extent = Max - Min;
+		const float Radius = Extent.Size() + 1.0f;
+
+		std::mt19937 Random(1);
+		std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+		OutRays.Empty();
+		OutRays.Reserve(NumRays);
+		for (int32 i = 0; i < NumRays; ++i)
+		{
+			const FVector Offset = FVector(Unit(Random), Unit(Random), Unit(Random)).GetSafeNormal();
+			const FVector Target(
+				Center.X + Unit(Random) * Extent.X * 0.5f,
+				Center.Y + Unit(Random) * Extent.Y * 0.5f,
+				Center.Z + Unit(Random) * Extent.Z * 0.5f);
+
+			FRay Ray;
+			Ray.Origin = (i < NumRays / 10) ? Center : Center + Offset * Radius;
+			Ray.Direction = (i % 50 == 0) ? FVector(0.0f, 0.0f, -1.0f) : (Target - Ray.Origin).GetSafeNormal();
+			OutRays.Add(Ray);
+		}
+	}
+
+	float BruteForceClosestHit(const FStaticMesh& Mesh, const FRay& Ray)
+	{
+		float Best = FLT_MAX;
+		for (int32 i = 0; i + 2 < Mesh.Indices.Num(); i += 3)
+		{
+			float Distance;
+			if (IntersectRayTriangleMT(Ray,
+				Mesh.Vertices[Mesh.Indices[i]].pos,
+				Mesh.Vertices[Mesh.Indices[i + 1]].pos,
+				Mesh.Vertices[Mesh.Indices[i + 2]].pos,
+				Distance) && Distance < Best)
+			{
+				Best = Distance;
+			}
+		}
+		return Best;
+	}
+
+	void RunMeshBVHBenchmark()
+	{
+		UE_LOG("[Benchmark] %d rays per mesh, times in ms (binary = pre-BVH4 IntersectRayBinary loop, single = IntersectRay loop on the game thread, batch = IntersectRays on the job system; Nx = speedup over binary)", NumRays);
+
+		TArray<FRay> Rays;
+		TArray<float> SingleDistances;
+		TArray<float> BatchDistances;
+
+		for (UStaticMesh* StaticMesh : UResourceManager::GetInstance().GetAll<UStaticMesh>())
+		{
+			const FStaticMesh* Mesh = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+			if (!Mesh || Mesh->Indices.Num() < 3)
+			{
+				continue;
+			}
+
+			BuildRays(*Mesh, Rays);
+
+			FMeshBVH BVH;
+			const double BuildMS = Benchmark::MeasureBestMS(1, [&]()
+			{
+				BVH.Build(Mesh->Vertices, Mesh->Indices);
+			});
+
+			FMeshBVH BVHLeaf8;
+			BVHLeaf8.Build(Mesh->Vertices, Mesh->Indices, 8);
+
+			// 교체 전 경로: 같은 분할의 이진 트리를 최소 힙으로 순회
+			FMeshBVH BinaryBVH;
+			BinaryBVH.Build(Mesh->Vertices, Mesh->Indices, 4, true);
+
+			int32 NumBinaryHits = 0;
+			const double BinaryMS = Benchmark::MeasureBestMS(3, [&]()
+			{
+				NumBinaryHits = 0;
+				for (const FRay& Ray : Rays)
+				{
+					float Distance;
+					NumBinaryHits += BinaryBVH.IntersectRayBinary(Ray, Mesh->Vertices, Mesh->Indices, Distance) ? 1 : 0;
+				}
+			});
+
+			int32 NumHits = 0;
+			SingleDistances.SetNum(NumRays);
+			const double SingleMS = Benchmark::MeasureBestMS(3, [&]()
+			{
+				NumHits = 0;
+				for (int32 i = 0; i < NumRays; ++i)
+				{
+					float Distance;
+					SingleDistances[i] = BVH.IntersectRay(Rays[i], Distance) ? Distance : FLT_MAX;
+					NumHits += SingleDistances[i] < FLT_MAX ? 1 : 0;
+				}
+			});
+
+			const double Leaf8MS = Benchmark::MeasureBestMS(3, [&]()
+			{
+				float Distance;
+				for (const FRay& Ray : Rays)
+				{
+					Benchmark::DoNotOptimize(BVHLeaf8.IntersectRay(Ray, Distance));
+				}
+			});
+
+			int32 NumBatchHits = 0;
+			const double BatchMS = Benchmark::MeasureBestMS(3, [&]()
+			{
+				NumBatchHits = BVH.IntersectRays(Rays, BatchDistances);
+			});
+
+			// 선형 스캔과 가장 가까운 교차 거리 비교 (상대 오차 1e-3 허용)
+			int32 NumMismatches = 0;
+			const double BruteForceMS = Benchmark::MeasureBestMS(1, [&]()
+			{
+				NumMismatches = 0;
+				for (int32 i = 0; i < NumRays; i += BruteForceStride)
+				{
+					const float Expected = BruteForceClosestHit(*Mesh, Rays[i]);
+					const float Tolerance = 1e-3f * std::max(1.0f, Expected);
+					const bool bExpectedHit = Expected < FLT_MAX;
+					if (bExpectedHit != (SingleDistances[i] < FLT_MAX)
+						|| (bExpectedHit && std::abs(Expected - SingleDistances[i]) > Tolerance)
+						|| std::abs(BatchDistances[i] - SingleDistances[i]) > Tolerance)
+					{
+						++NumMismatches;
+					}
+				}
+			});
+
+			UE_LOG("[Benchmark] %-40s tris %7d: build %7.2f, binary %7.2f (%d hits), single %7.2f (%d hits, %.1fx), leaf8 %7.2f, batch %7.2f (%d hits, %.1fx), linear scan x1/%d %9.2f, mismatches %d",
+				Mesh->PathFileName.c_str(), Mesh->Indices.Num() / 3, BuildMS, BinaryMS, NumBinaryHits,
+				SingleMS, NumHits, BinaryMS / SingleMS, Leaf8MS, BatchMS, NumBatchHits, BinaryMS / BatchMS,
+				BruteForceStride, BruteForceMS, NumMismatches);
+		}
+	}
+}
+
+REGISTER_BENCHMARK("MESHBVH", "FMeshBVH4 ray queries over every loaded static mesh vs the binary BVH traversal and a linear triangle scan", RunMeshBVHBenchmark)
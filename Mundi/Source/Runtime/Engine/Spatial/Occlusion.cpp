@@ -1,6 +1,8 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
 #include "Frustum.h"
+#include "JobSystem.h"
+#include <immintrin.h>
 
 // NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
 // static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
@@ -28,6 +30,309 @@ static inline void MakeAabbCornersMinMax(const FAABB& B, FVector Corners[8])
 	Corners[7] = { mx.X, mx.Y, mx.Z };
 }
 
+namespace
+{
+	// 오클루더 정점: 클립 공간 X, Y, W + 뷰 공간 깊이 (near 클리핑 시 전부 선형 보간 가능)
+	struct FOccluderClipVertex
+	{
+		float X, Y, W;
+		float ViewZ;
+	};
+
+	inline FOccluderClipVertex LerpClipVertex(const FOccluderClipVertex& A, const FOccluderClipVertex& B, float T)
+	{
+		return {
+			A.X + (B.X - A.X) * T,
+			A.Y + (B.Y - A.Y) * T,
+			A.W + (B.W - A.W) * T,
+			A.ViewZ + (B.ViewZ - A.ViewZ) * T };
+	}
+
+	// 화면 공간 삼각형 하나를 엣지 함수/깊이 평면으로 셋업. 화면 밖이거나 퇴화면 false
+	bool SetupScreenTriangle(const FOccluderClipVertex InVerts[3], float GridW, float GridH,
+		float NearClip, float InvDepthRange, FOcclusionTriangle& OutTri)
+	{
+		float SX[3], SY[3], InvW[3], LinW[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			if (InVerts[i].W <= KINDA_SMALL_NUMBER)
+			{
+				return false;
+			}
+			InvW[i] = 1.0f / InVerts[i].W;
+			SX[i] = (InVerts[i].X * InvW[i] * 0.5f + 0.5f) * GridW;
+			SY[i] = (InVerts[i].Y * InvW[i] * 0.5f + 0.5f) * GridH;
+			LinW[i] = (InVerts[i].ViewZ - NearClip) * InvDepthRange * InvW[i];
+		}
+
+		// 픽셀 중심(px + 0.5)이 들어올 수 있는 범위
+		const float MinX = std::min({ SX[0], SX[1], SX[2] });
+		const float MaxX = std::max({ SX[0], SX[1], SX[2] });
+		const float MinY = std::min({ SY[0], SY[1], SY[2] });
+		const float MaxY = std::max({ SY[0], SY[1], SY[2] });
+		if (MaxX < 0.0f || MaxY < 0.0f || MinX > GridW || MinY > GridH)
+		{
+			return false;
+		}
+		OutTri.MinPX = std::max(0, int(std::ceil(MinX - 0.5f)));
+		OutTri.MinPY = std::max(0, int(std::ceil(MinY - 0.5f)));
+		OutTri.MaxPX = std::min(int(GridW) - 1, int(std::floor(MaxX - 0.5f)));
+		OutTri.MaxPY = std::min(int(GridH) - 1, int(std::floor(MaxY - 0.5f)));
+		if (OutTri.MinPX > OutTri.MaxPX || OutTri.MinPY > OutTri.MaxPY)
+		{
+			return false;
+		}
+
+		float Area2 = (SX[1] - SX[0]) * (SY[2] - SY[0]) - (SX[2] - SX[0]) * (SY[1] - SY[0]);
+		if (std::abs(Area2) < 1e-6f)
+		{
+			return false;
+		}
+		// 양면 래스터: 감김 방향이 반대면 1, 2번 정점을 바꿔 안쪽이 항상 양수가 되게 한다
+		if (Area2 < 0.0f)
+		{
+			std::swap(SX[1], SX[2]); std::swap(SY[1], SY[2]);
+			std::swap(InvW[1], InvW[2]); std::swap(LinW[1], LinW[2]);
+			Area2 = -Area2;
+		}
+
+		for (int i = 0; i < 3; ++i)
+		{
+			const int j = (i + 1) % 3;
+			OutTri.EdgeA[i] = SY[i] - SY[j];
+			OutTri.EdgeB[i] = SX[j] - SX[i];
+			OutTri.EdgeC[i] = SX[i] * SY[j] - SY[i] * SX[j];
+		}
+
+		// f(x, y) = a*x + b*y + c 평면 계수
+		const float InvArea2 = 1.0f / Area2;
+		auto MakePlane = [&](const float F[3], float OutPlane[3])
+		{
+			const float DF1 = F[1] - F[0];
+			const float DF2 = F[2] - F[0];
+			OutPlane[0] = (DF1 * (SY[2] - SY[0]) - DF2 * (SY[1] - SY[0])) * InvArea2;
+			OutPlane[1] = (DF2 * (SX[1] - SX[0]) - DF1 * (SX[2] - SX[0])) * InvArea2;
+			OutPlane[2] = F[0] - OutPlane[0] * SX[0] - OutPlane[1] * SY[0];
+		};
+		MakePlane(InvW, OutTri.InvWPlane);
+		MakePlane(LinW, OutTri.LinWPlane);
+		return true;
+	}
+}
+
+void FOcclusionGrid::RasterizeTrianglesDepthMin(const FOcclusionTriangle* Triangles, int32 NumTriangles, int MinPX, int MinPY, int MaxPX, int MaxPY)
+{
+	const __m128 LaneCenter = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128i LaneIndex = _mm_setr_epi32(0, 1, 2, 3);
+	const __m128 Zero = _mm_setzero_ps();
+
+	for (int32 TriIndex = 0; TriIndex < NumTriangles; ++TriIndex)
+	{
+		const FOcclusionTriangle& Tri = Triangles[TriIndex];
+
+		// 비닝: 이 빈과 겹치는 픽셀 범위만
+		const int X0 = std::max(Tri.MinPX, MinPX);
+		const int X1 = std::min(Tri.MaxPX, MaxPX);
+		const int Y0 = std::max(Tri.MinPY, MinPY);
+		const int Y1 = std::min(Tri.MaxPY, MaxPY);
+		if (X0 > X1 || Y0 > Y1)
+		{
+			continue;
+		}
+
+		const int XStart = X0 & ~3;
+		const __m128 FirstX = _mm_add_ps(_mm_set1_ps(float(XStart)), LaneCenter);
+		const __m128i FirstLane = _mm_set1_epi32(X0 - 1);
+		const __m128i LastLane = _mm_set1_epi32(X1 + 1);
+
+		__m128 A[3], StepA[3];
+		for (int e = 0; e < 3; ++e)
+		{
+			A[e] = _mm_set1_ps(Tri.EdgeA[e]);
+			StepA[e] = _mm_set1_ps(Tri.EdgeA[e] * 4.0f);
+		}
+		const __m128 InvWA = _mm_set1_ps(Tri.InvWPlane[0]);
+		const __m128 LinWA = _mm_set1_ps(Tri.LinWPlane[0]);
+		const __m128 InvWStep = _mm_set1_ps(Tri.InvWPlane[0] * 4.0f);
+		const __m128 LinWStep = _mm_set1_ps(Tri.LinWPlane[0] * 4.0f);
+
+		for (int y = Y0; y <= Y1; ++y)
+		{
+			const float CenterY = float(y) + 0.5f;
+
+			// 행 시작 4픽셀의 엣지/깊이 값, 이후 x 방향으로 4픽셀씩 증분
+			__m128 Edge[3];
+			for (int e = 0; e < 3; ++e)
+			{
+				Edge[e] = _mm_add_ps(_mm_mul_ps(A[e], FirstX), _mm_set1_ps(Tri.EdgeB[e] * CenterY + Tri.EdgeC[e]));
+			}
+			__m128 InvW = _mm_add_ps(_mm_mul_ps(InvWA, FirstX), _mm_set1_ps(Tri.InvWPlane[1] * CenterY + Tri.InvWPlane[2]));
+			__m128 LinW = _mm_add_ps(_mm_mul_ps(LinWA, FirstX), _mm_set1_ps(Tri.LinWPlane[1] * CenterY + Tri.LinWPlane[2]));
+
+			float* Row = &Depth[size_t(y) * Width];
+			for (int x = XStart; x <= X1; x += 4)
+			{
+				const __m128 Inside = _mm_and_ps(
+					_mm_and_ps(_mm_cmpge_ps(Edge[0], Zero), _mm_cmpge_ps(Edge[1], Zero)),
+					_mm_cmpge_ps(Edge[2], Zero));
+				const __m128i Lanes = _mm_add_epi32(_mm_set1_epi32(x), LaneIndex);
+				const __m128 InRange = _mm_castsi128_ps(_mm_and_si128(_mm_cmpgt_epi32(Lanes, FirstLane), _mm_cmplt_epi32(Lanes, LastLane)));
+				const __m128 Mask = _mm_and_ps(Inside, InRange);
+
+				if (_mm_movemask_ps(Mask) != 0)
+				{
+					const __m128 Z = _mm_max_ps(_mm_div_ps(LinW, InvW), Zero);
+					const __m128 Old = _mm_loadu_ps(Row + x);
+					const __m128 New = _mm_min_ps(Old, Z);
+					_mm_storeu_ps(Row + x, _mm_or_ps(_mm_and_ps(Mask, New), _mm_andnot_ps(Mask, Old)));
+				}
+
+				for (int e = 0; e < 3; ++e)
+				{
+					Edge[e] = _mm_add_ps(Edge[e], StepA[e]);
+				}
+				InvW = _mm_add_ps(InvW, InvWStep);
+				LinW = _mm_add_ps(LinW, LinWStep);
+			}
+		}
+	}
+}
+
+bool FOcclusionCullingManagerCPU::CrossesNearPlane(const FCandidateDrawable& D)
+{
+	FVector C[8];
+	MakeAabbCornersMinMax(D.Bound, C);
+
+	for (int i = 0; i < 8; i++)
+	{
+		const float p[4] = { C[i].X, C[i].Y, C[i].Z, 1.0f };
+		float v4[4];
+		MulPointRow(p, D.WorldView, v4);
+		if (v4[2] < D.NearClip)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FOcclusionCullingManagerCPU::SetupOccluderTriangles(const FOccluderMesh& Mesh, TArray<FOcclusionTriangle>& OutTriangles) const
+{
+	OutTriangles.clear();
+	if (!Mesh.Vertices || !Mesh.Indices)
+	{
+		return;
+	}
+
+	const TArray<FNormalVertex>& Vertices = *Mesh.Vertices;
+	const TArray<uint32>& Indices = *Mesh.Indices;
+	const float GW = float(Grid.GetWidth());
+	const float GH = float(Grid.GetHeight());
+	const float InvDepthRange = 1.0f / std::max(Mesh.FarClip - Mesh.NearClip, KINDA_SMALL_NUMBER);
+
+	// 인덱스로 여러 번 참조되는 정점은 한 번만 변환 (워커마다 스크래치 재사용)
+	thread_local TArray<FOccluderClipVertex> ClipVertices;
+	ClipVertices.resize(Vertices.size());
+	for (size_t i = 0; i < Vertices.size(); ++i)
+	{
+		const FVector& P = Vertices[i].pos;
+		const float p[4] = { P.X, P.Y, P.Z, 1.0f };
+		float c[4];
+		MulPointRow(p, Mesh.WorldViewProj, c);
+		const float ViewZ = P.X * Mesh.WorldView.M[0][2] + P.Y * Mesh.WorldView.M[1][2] + P.Z * Mesh.WorldView.M[2][2] + Mesh.WorldView.M[3][2];
+		ClipVertices[i] = { c[0], c[1], c[3], ViewZ };
+	}
+
+	OutTriangles.reserve(Indices.size() / 3);
+	for (size_t t = 0; t + 2 < Indices.size(); t += 3)
+	{
+		const FOccluderClipVertex Tri[3] = { ClipVertices[Indices[t]], ClipVertices[Indices[t + 1]], ClipVertices[Indices[t + 2]] };
+		const bool bInside[3] = { Tri[0].ViewZ >= Mesh.NearClip, Tri[1].ViewZ >= Mesh.NearClip, Tri[2].ViewZ >= Mesh.NearClip };
+		const int NumInside = int(bInside[0]) + int(bInside[1]) + int(bInside[2]);
+		if (NumInside == 0)
+		{
+			continue;
+		}
+
+		// near 평면 클리핑 (Sutherland–Hodgman, 평면 하나라 최대 4각형)
+		FOccluderClipVertex Poly[4];
+		int NumPoly = 0;
+		if (NumInside == 3)
+		{
+			Poly[0] = Tri[0]; Poly[1] = Tri[1]; Poly[2] = Tri[2];
+			NumPoly = 3;
+		}
+		else
+		{
+			for (int i = 0; i < 3; ++i)
+			{
+				const int j = (i + 1) % 3;
+				if (bInside[i])
+				{
+					Poly[NumPoly++] = Tri[i];
+				}
+				if (bInside[i] != bInside[j])
+				{
+					const float T = (Mesh.NearClip - Tri[i].ViewZ) / (Tri[j].ViewZ - Tri[i].ViewZ);
+					Poly[NumPoly++] = LerpClipVertex(Tri[i], Tri[j], T);
+				}
+			}
+		}
+
+		for (int i = 1; i + 1 < NumPoly; ++i)
+		{
+			const FOccluderClipVertex Fan[3] = { Poly[0], Poly[i], Poly[i + 1] };
+			FOcclusionTriangle ScreenTri;
+			if (SetupScreenTriangle(Fan, GW, GH, Mesh.NearClip, InvDepthRange, ScreenTri))
+			{
+				OutTriangles.push_back(ScreenTri);
+			}
+		}
+	}
+}
+
+void FOcclusionCullingManagerCPU::BuildOccluderDepthFromMeshes(const TArray<FOccluderMesh>& Occluders)
+{
+	Grid.Clear();
+
+	const int32 NumOccluders = Occluders.Num();
+	if (NumOccluders == 0)
+	{
+		return;
+	}
+	if (OccluderTriangles.Num() < NumOccluders)
+	{
+		OccluderTriangles.SetNum(NumOccluders);
+	}
+
+	// 1) 오클루더별 변환 + 클리핑 + 삼각형 셋업 (서로 다른 출력 배열에 쓰므로 병렬 안전)
+	ParallelFor(NumOccluders, [&](int32 Index)
+	{
+		SetupOccluderTriangles(Occluders[Index], OccluderTriangles[Index]);
+	});
+
+	// 2) 빈 단위 병렬 래스터. 빈은 서로 겹치지 않는 픽셀 영역이라 락 없이 깊이를 쓴다
+	const int GW = Grid.GetWidth();
+	const int GH = Grid.GetHeight();
+	const int BinsX = (GW + BinSizeX - 1) / BinSizeX;
+	const int BinsY = (GH + BinSizeY - 1) / BinSizeY;
+	ParallelFor(BinsX * BinsY, [&](int32 BinIndex)
+	{
+		const int BinX = BinIndex % BinsX;
+		const int BinY = BinIndex / BinsX;
+		const int MinPX = BinX * BinSizeX;
+		const int MinPY = BinY * BinSizeY;
+		const int MaxPX = std::min(GW, MinPX + BinSizeX) - 1;
+		const int MaxPY = std::min(GH, MinPY + BinSizeY) - 1;
+
+		for (int32 OccluderIndex = 0; OccluderIndex < NumOccluders; ++OccluderIndex)
+		{
+			const TArray<FOcclusionTriangle>& Triangles = OccluderTriangles[OccluderIndex];
+			Grid.RasterizeTrianglesDepthMin(Triangles.GetData(), Triangles.Num(), MinPX, MinPY, MaxPX, MaxPY);
+		}
+	});
+}
+
 bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
 	const FCandidateDrawable& D, int /*ViewW*/, int /*ViewH*/, FOcclusionRect& OutR)
 {
@@ -155,6 +460,16 @@ void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>
 	{
 		uint32_t id = D.ActorIndex;
 
+		// 카메라가 박스 안/걸친 상태면 투영 사각형이 잘못 나오므로 컬링하지 않음
+		if (CrossesNearPlane(D))
+		{
+			OutVisibleFlags[id] = 1;
+			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
+			OccludedStreak[id] = 0;
+			LastState[id] = 1;
+			continue;
+		}
+
 		FOcclusionRect R;
 		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
 		{
@@ -200,7 +515,8 @@ void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>
 				occluded = false;
 		}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
+		// --- 히스테리시스: 가려짐은 2~3프레임 연속일 때만 전환 ---
+		// 보임 쪽으로는 바로 전환한다 (가려짐을 유지하면 드러난 메시가 한 프레임 늦게 튀어나옴)
 		const int thresh = 2; // 2~3 추천
 
 		if (occluded)
@@ -216,10 +532,6 @@ void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>
 		{
 			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
 			OccludedStreak[id] = 0;
-
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
 		}
 
 		LastState[id] = occluded ? 0 : 1;
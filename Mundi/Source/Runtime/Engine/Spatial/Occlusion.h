@@ -15,6 +15,28 @@ struct FCandidateDrawable
     float    FarClip;         // ★ 추가
 };
 
+// 삼각형 오클루더 (간략화된 메시, 로컬 공간 정점)
+struct FOccluderMesh
+{
+    const TArray<FNormalVertex>* Vertices = nullptr;
+    const TArray<uint32>* Indices = nullptr;
+    FMatrix  WorldViewProj;   // 로컬 → 클립
+    FMatrix  WorldView;       // 로컬 → 뷰 (선형 깊이 계산용)
+    float    NearClip;
+    float    FarClip;
+};
+
+// 화면 공간으로 셋업이 끝난 오클루더 삼각형 (빈 래스터라이저 입력)
+// 엣지 함수 E(x,y) = A*x + B*y + C 는 삼각형 안쪽에서 >= 0
+// 깊이는 화면 공간에서 선형인 1/w, Linear/w 평면을 보간한 뒤 나눠서 복원
+struct FOcclusionTriangle
+{
+    float EdgeA[3], EdgeB[3], EdgeC[3];
+    float InvWPlane[3];   // a, b, c  (1/w)
+    float LinWPlane[3];   // a, b, c  (선형 깊이 / w)
+    int32 MinPX, MinPY, MaxPX, MaxPY; // 그리드에 클램프된 픽셀 범위
+};
+
 // 교체 (MaxZ 추가)
 struct FOcclusionRect
 {
@@ -28,9 +50,10 @@ struct FOcclusionRect
 class FOcclusionGrid
 {
 public:
+    // 삼각형 래스터라이저가 4픽셀씩 SSE로 처리하므로 가로는 4의 배수로 올림
     void Initialize(int InWidth, int InHeight)
     {
-        Width = InWidth; Height = InHeight;
+        Width = (std::max(InWidth, 4) + 3) & ~3; Height = std::max(InHeight, 1);
         // 교체: 1.0f (Far)
         Depth.assign(size_t(Width * Height), 1.0f);
         BuildLevels.clear();
@@ -66,6 +89,13 @@ public:
         }
     }
 
+    /**
+     * [MinPX..MaxPX] x [MinPY..MaxPY] 영역(빈 하나)에 걸치는 삼각형을 래스터라이즈 (SSE, 4픽셀 단위)
+     * 픽셀 중심이 삼각형 안이면 보간 깊이로 min 갱신. 서로 다른 빈은 다른 스레드에서 동시에 호출해도 안전
+     * (빈의 가로 경계가 4의 배수여야 함)
+     */
+    void RasterizeTrianglesDepthMin(const FOcclusionTriangle* Triangles, int32 NumTriangles, int MinPX, int MinPY, int MaxPX, int MaxPY);
+
     void BuildHZB()
     {
         BuildLevels.clear();
@@ -228,6 +258,16 @@ public:
     // 1) 오클루더로 저해상도 Depth 채우기
     void BuildOccluderDepth(const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH);
 
+    /**
+     * 1') 오클루더 메시 삼각형으로 Depth 채우기 (사각형 근사보다 정확)
+     * - 오클루더별 변환/near 클리핑/삼각형 셋업을 병렬로 수행
+     * - 그리드를 BinSizeX x BinSizeY 빈으로 나눠 빈마다 병렬로 비닝 + 래스터라이즈
+     */
+    void BuildOccluderDepthFromMeshes(const TArray<FOccluderMesh>& Occluders);
+
+    static constexpr int BinSizeX = 64; // 4의 배수
+    static constexpr int BinSizeY = 32;
+
     // 2) CPU HZB
     void BuildHZB() { Grid.BuildHZB(); }
 
@@ -240,6 +280,12 @@ private:
     // AABB(Min/Max) → 화면 사각형 + MinZ (★이제 MinZ는 '선형 깊이 0..1')
     static bool ComputeRectAndMinZ(const FCandidateDrawable& D, int ViewW, int ViewH, FOcclusionRect& OutRect);
 
+    // AABB가 near 평면에 걸쳐 있으면 화면 사각형을 믿을 수 없으므로 항상 보임 처리
+    static bool CrossesNearPlane(const FCandidateDrawable& D);
+
+    // 오클루더 메시 하나를 클립 공간 변환 + near 클리핑 + 화면 삼각형 셋업
+    void SetupOccluderTriangles(const FOccluderMesh& Mesh, TArray<FOcclusionTriangle>& OutTriangles) const;
+
     // 행벡터: Out = In(1x4) * M(4x4)
     static inline void MulPointRow(const float In[4], const FMatrix& M, float Out[4])
     {
@@ -251,6 +297,7 @@ private:
 
 private:
     FOcclusionGrid Grid;
+    TArray<TArray<FOcclusionTriangle>> OccluderTriangles; // 오클루더별 셋업 결과 (프레임 간 용량 재사용)
     TArray<uint8_t> VisibleStreak;   // 연속 보임 프레임 수
     TArray<uint8_t> OccludedStreak;  // 연속 가림 프레임 수
     TArray<uint8_t> LastState;       // 0=occluded, 1=visible
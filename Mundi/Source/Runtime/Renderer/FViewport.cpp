@@ -9,6 +9,12 @@ FViewport::FViewport()
 FViewport::~FViewport()
 {
 	Cleanup();
+
+	// 렌더러가 이 뷰포트용으로 만든 오클루전 컬러 해제 (렌더러가 먼저 종료됐으면 이미 해제됨)
+	if (URenderer* Renderer = GEngine.GetRenderer())
+	{
+		Renderer->ReleaseOcclusionCuller(this);
+	}
 }
 
 bool FViewport::Initialize(float InStartX, float InStartY, float InSizeX, float InSizeY, ID3D11Device* Device)
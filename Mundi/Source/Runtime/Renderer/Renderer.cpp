@@ -64,6 +64,12 @@ URenderer::~URenderer()
 		}
 	}
 	DeferredReleaseQueue.Empty();
+
+	for (auto& Pair : OcclusionCullers)
+	{
+		delete Pair.second;
+	}
+	OcclusionCullers.clear();
 }
 
 void URenderer::BeginFrame()
@@ -114,11 +120,31 @@ void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* V
 {
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
 	FSceneRenderer SceneRenderer(World, View, this);
+	SceneRenderer.SetOcclusionCuller(GetOcclusionCuller(Viewport));
 
 	// 실제로 렌더를 수행합니다.
 	SceneRenderer.Render();
 }
 
+FOcclusionCullingManagerCPU* URenderer::GetOcclusionCuller(FViewport* InViewport)
+{
+	if (auto* Found = OcclusionCullers.Find(InViewport))
+		return *Found;
+
+	FOcclusionCullingManagerCPU* NewCuller = new FOcclusionCullingManagerCPU();
+	OcclusionCullers.Add(InViewport, NewCuller);
+	return NewCuller;
+}
+
+void URenderer::ReleaseOcclusionCuller(FViewport* InViewport)
+{
+	if (auto* Found = OcclusionCullers.Find(InViewport))
+	{
+		delete *Found;
+		OcclusionCullers.Remove(InViewport);
+	}
+}
+
 UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) const
 {
 	//GPU와 동기화 문제 때문에 Map이 호출될때까지 기다려야해서 피킹 하는 프레임에 엄청난 프레임 드랍이 일어남.
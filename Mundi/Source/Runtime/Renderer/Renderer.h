@@ -12,6 +12,7 @@ class UBillboardComponent;
 class UPrimitiveComponent;
 class UCameraComponent;
 class FSceneView;
+class FOcclusionCullingManagerCPU;
 
 struct FMaterialSlot;
 struct FLinearColor;
@@ -47,6 +48,11 @@ public:
 
 	D3D11RHI* GetRHIDevice() { return RHIDevice; }
 
+	// 뷰포트별 CPU 오클루전 컬러 (히스테리시스 상태가 뷰마다 따로 유지되어야 함)
+	FOcclusionCullingManagerCPU* GetOcclusionCuller(FViewport* InViewport);
+	// 뷰포트 소멸 시 호출: 같은 주소에 새로 만든 뷰포트가 지난 가시성 히스토리를 물려받지 않도록 컬러를 지운다
+	void ReleaseOcclusionCuller(FViewport* InViewport);
+
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
 
@@ -85,6 +91,8 @@ private:
 	uint32 CurrentViewportWidth = 0;
 	uint32 CurrentViewportHeight = 0;
 
+	TMap<FViewport*, FOcclusionCullingManagerCPU*> OcclusionCullers;
+
 	// Batch Line Rendering System using UDynamicMesh for efficiency
 	ULineDynamicMesh* DynamicLineMesh = nullptr;
 	FMeshData* LineBatchData = nullptr;
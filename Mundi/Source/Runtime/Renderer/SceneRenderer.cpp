@@ -362,8 +362,8 @@ void FSceneRenderer::RenderShadowMaps()
 	if (!LightManager) return;
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
-	TArray<FMeshBatchElement> ShadowMeshBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	TFrameArray<FMeshBatchElement> ShadowMeshBatches;
+	for (UMeshComponent* MeshComponent : Proxies.ShadowCasters)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
 		{
@@ -401,8 +401,8 @@ void FSceneRenderer::RenderShadowMaps()
 	);
 
 	// 1.2. 2D 섀도우 요청 수집
-	TArray<FShadowRenderRequest> Requests2D;
-	TArray<FShadowRenderRequest> RequestsCube;
+	TFrameArray<FShadowRenderRequest> Requests2D;
+	TFrameArray<FShadowRenderRequest> RequestsCube;
 	for (UDirectionalLightComponent* Light : LightManager->GetDirectionalLightList())
 	{
 		Light->GetShadowRenderRequests(View, Requests2D);
@@ -582,7 +582,7 @@ void FSceneRenderer::RenderShadowMaps()
 	}
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<FMeshBatchElement>& InShadowBatches)
 {
 	// 1. 뎁스 전용 셰이더 로드
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
@@ -956,6 +956,14 @@ void FSceneRenderer::GatherVisibleProxies()
 		CollectComponentsFromActor(Actor, false);
 	}
 
+	// 그림자는 화면 밖/가려진 메시도 드리우므로 컬링 전 목록을 따로 보관
+	Proxies.ShadowCasters = Proxies.Meshes;
+
+	if (World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Culling))
+	{
+		PerformOcclusionCulling();
+	}
+
 	// 라이트 통계 업데이트
 	FLightStats LightStats;
 	LightStats.TotalPointLights = SceneLocals.PointLights.Num();
@@ -1083,6 +1091,136 @@ void FSceneRenderer::PerformFrustumCulling()
 	//}
 }
 
+namespace
+{
+	// 오클루전 그리드 가로 해상도 (세로는 뷰 비율을 따름)
+	constexpr int OcclusionGridWidth = 256;
+	// 이 삼각형 수 이하인 스태틱 메시만 오클루더로 사용 (간략화된 메시 역할)
+	constexpr int32 MaxOccluderTriangles = 2048;
+	// 프레임당 오클루더 수 상한 (화면에서 큰 순서)
+	constexpr int32 MaxOccluders = 64;
+	// 바운드 반지름 / 카메라 거리가 이 값보다 작으면 오클루더로 쓰지 않음
+	constexpr float MinOccluderScreenSize = 0.05f;
+}
+
+void FSceneRenderer::PerformOcclusionCulling()
+{
+	if (!OcclusionCPU || Proxies.Meshes.IsEmpty())
+	{
+		return;
+	}
+
+	const uint32 ViewW = View->ViewRect.Width();
+	const uint32 ViewH = View->ViewRect.Height();
+	if (ViewW == 0 || ViewH == 0)
+	{
+		return;
+	}
+
+	const int GridH = std::max(1, int(OcclusionGridWidth * float(ViewH) / float(ViewW)));
+	const FOcclusionGrid& Grid = OcclusionCPU->GetGrid();
+	if (Grid.GetWidth() != OcclusionGridWidth || Grid.GetHeight() != GridH)
+	{
+		OcclusionCPU->Initialize(OcclusionGridWidth, GridH);
+	}
+
+	const FMatrix ViewProj = View->ViewMatrix * View->ProjectionMatrix;
+
+	struct FOccluderCandidate
+	{
+		UStaticMeshComponent* Component;
+		FStaticMesh* MeshAsset;
+		float ScreenSize;
+	};
+	TFrameArray<FOccluderCandidate> OccluderCandidates;
+	TArray<FCandidateDrawable> Occludees;
+	Occludees.Reserve(Proxies.Meshes.Num());
+
+	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	{
+		const FAABB Bound = MeshComponent->GetWorldAABB();
+		const FVector HalfExtent = Bound.GetHalfExtent();
+		// 바운드가 없는 컴포넌트(기본 FAABB)나 팩토리 밖에서 만든 컴포넌트는 판정하지 않고 항상 그린다
+		if ((HalfExtent.X <= 0.0f && HalfExtent.Y <= 0.0f && HalfExtent.Z <= 0.0f) || MeshComponent->InternalIndex == UINT32_MAX)
+		{
+			continue;
+		}
+
+		FCandidateDrawable Occludee;
+		Occludee.ActorIndex = MeshComponent->InternalIndex;
+		Occludee.Bound = Bound;
+		Occludee.WorldViewProj = ViewProj;
+		Occludee.WorldView = View->ViewMatrix;
+		Occludee.NearClip = View->NearClip;
+		Occludee.FarClip = View->FarClip;
+		Occludees.Add(Occludee);
+
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent);
+		UStaticMesh* StaticMesh = StaticMeshComponent ? StaticMeshComponent->GetStaticMesh() : nullptr;
+		FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!MeshAsset || MeshAsset->Indices.Num() / 3 > MaxOccluderTriangles)
+		{
+			continue;
+		}
+
+		// 반지름 / 거리 ≈ 화면에서 차지하는 크기
+		const float Distance = std::max((Bound.GetCenter() - View->ViewLocation).Size(), KINDA_SMALL_NUMBER);
+		const float ScreenSize = HalfExtent.Size() / Distance;
+		if (ScreenSize >= MinOccluderScreenSize)
+		{
+			OccluderCandidates.Add({ StaticMeshComponent, MeshAsset, ScreenSize });
+		}
+	}
+
+	if (Occludees.IsEmpty())
+	{
+		return;
+	}
+
+	std::sort(OccluderCandidates.begin(), OccluderCandidates.end(),
+		[](const FOccluderCandidate& A, const FOccluderCandidate& B) { return A.ScreenSize > B.ScreenSize; });
+
+	TArray<FOccluderMesh> Occluders;
+	Occluders.Reserve(std::min(OccluderCandidates.Num(), MaxOccluders));
+	for (const FOccluderCandidate& Candidate : OccluderCandidates)
+	{
+		if (Occluders.Num() >= MaxOccluders)
+		{
+			break;
+		}
+
+		const FMatrix WorldMatrix = Candidate.Component->GetWorldMatrix();
+		FOccluderMesh Occluder;
+		Occluder.Vertices = &Candidate.MeshAsset->Vertices;
+		Occluder.Indices = &Candidate.MeshAsset->Indices;
+		Occluder.WorldViewProj = WorldMatrix * ViewProj;
+		Occluder.WorldView = WorldMatrix * View->ViewMatrix;
+		Occluder.NearClip = View->NearClip;
+		Occluder.FarClip = View->FarClip;
+		Occluders.Add(Occluder);
+	}
+
+	OcclusionCPU->BuildOccluderDepthFromMeshes(Occluders);
+	OcclusionCPU->BuildHZB();
+
+	TArray<uint8_t> VisibleFlags;
+	OcclusionCPU->TestOcclusion(Occludees, int(ViewW), int(ViewH), VisibleFlags);
+
+	// 가려진 메시만 제거 (판정하지 않은 컴포넌트는 플래그 범위 밖이거나 기본값 1)
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < Proxies.Meshes.Num(); ++ReadIndex)
+	{
+		UMeshComponent* MeshComponent = Proxies.Meshes[ReadIndex];
+		const uint32 Id = MeshComponent->InternalIndex;
+		if (Id < VisibleFlags.size() && VisibleFlags[Id] == 0)
+		{
+			continue;
+		}
+		Proxies.Meshes[WriteIndex++] = MeshComponent;
+	}
+	Proxies.Meshes.resize(WriteIndex);
+}
+
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 {
 	// --- 1. 수집 (Collect) ---
@@ -1339,9 +1477,12 @@ void FSceneRenderer::RenderParticleSystemPass()
 						Stats.SpriteParticleCount += EmitterInst->ActiveParticles;
 					}
 
-					// 메모리 계산: ParticleData + ParticleIndices + InstanceData
+					// 메모리 계산: ParticleData + ParticleIndices + InstanceData (SoA 레이아웃은 인덱스 배열 없음)
 					Stats.MemoryBytes += EmitterInst->MaxActiveParticles * EmitterInst->ParticleStride;
-					Stats.MemoryBytes += EmitterInst->MaxActiveParticles * sizeof(uint16);
+					if (!EmitterInst->bUseSoALayout)
+					{
+						Stats.MemoryBytes += EmitterInst->MaxActiveParticles * sizeof(uint16);
+					}
 					Stats.MemoryBytes += EmitterInst->InstancePayloadSize;
 				}
 			}
@@ -1364,7 +1505,7 @@ void FSceneRenderer::RenderParticleSystemPass()
 	const bool bWireframe = View->RenderSettings->GetViewMode() == EViewMode::VMI_Wireframe;
 
 	// 파티클 배치 수집
-	TArray<FMeshBatchElement> AllParticleBatches;
+	TFrameArray<FMeshBatchElement> AllParticleBatches;
 
 	for (UParticleSystemComponent* ParticleSystem : Proxies.ParticleSystems)
 	{
@@ -1378,8 +1519,8 @@ void FSceneRenderer::RenderParticleSystemPass()
 		return;
 
 	// RenderMode별로 파티션
-	TArray<FMeshBatchElement> OpaqueBatches;
-	TArray<FMeshBatchElement> TranslucentBatches;
+	TFrameArray<FMeshBatchElement> OpaqueBatches;
+	TFrameArray<FMeshBatchElement> TranslucentBatches;
 
 	for (const FMeshBatchElement& Batch : AllParticleBatches)
 	{
@@ -1413,8 +1554,9 @@ void FSceneRenderer::RenderParticleSystemPass()
 		RHIDevice->OMSetBlendState(true);
 
 		// 반투명은 Back-to-Front 정렬 필요
+		// 안정 정렬: 같은 위치의 배치(한 컴포넌트의 스프라이트 배치들)는 컴포넌트가 정한 깊이 순서를 유지
 		FVector CameraPosition = View->ViewLocation;
-		TranslucentBatches.Sort([&CameraPosition](const FMeshBatchElement& A, const FMeshBatchElement& B)
+		TranslucentBatches.StableSort([&CameraPosition](const FMeshBatchElement& A, const FMeshBatchElement& B)
 		{
 			FVector PosA = { A.WorldMatrix.M[3][0], A.WorldMatrix.M[3][1], A.WorldMatrix.M[3][2] };
 			FVector PosB = { B.WorldMatrix.M[3][0], B.WorldMatrix.M[3][1], B.WorldMatrix.M[3][2] };
@@ -1907,7 +2049,7 @@ void FSceneRenderer::RenderFinalOverlayLines()
 }
 
 // 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+void FSceneRenderer::DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
 {
 	if (InMeshBatches.IsEmpty()) return;
 
@@ -2122,7 +2264,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 }
 
 // 자동 배칭: 같은 메시+머티리얼 조합을 인스턴싱으로 합침
-void FSceneRenderer::BatchStaticMeshes(TArray<FMeshBatchElement>& InOutMeshBatches)
+void FSceneRenderer::BatchStaticMeshes(TFrameArray<FMeshBatchElement>& InOutMeshBatches)
 {
 	if (InOutMeshBatches.Num() < 2)
 	{
@@ -2340,8 +2482,8 @@ void FSceneRenderer::BatchStaticMeshes(TArray<FMeshBatchElement>& InOutMeshBatch
 	}
 
 	FInstanceData* DestPtr = static_cast<FInstanceData*>(MappedData.pData);
-	TArray<int32> BatchesToRemove;
-	TArray<FMeshBatchElement> NewBatches;
+	TFrameArray<int32> BatchesToRemove;
+	TFrameArray<FMeshBatchElement> NewBatches;
 	uint32 CurrentInstanceOffset = 0;
 
 	for (auto& Pair : ValidBatchGroups)
@@ -2393,7 +2535,7 @@ void FSceneRenderer::BatchStaticMeshes(TArray<FMeshBatchElement>& InOutMeshBatch
 	InOutMeshBatches.Append(NewBatches);
 }
 
-void FSceneRenderer::BatchShadowMeshes(TArray<FMeshBatchElement>& InOutShadowBatches)
+void FSceneRenderer::BatchShadowMeshes(TFrameArray<FMeshBatchElement>& InOutShadowBatches)
 {
 	if (InOutShadowBatches.Num() < 2)
 	{
@@ -2522,8 +2664,8 @@ void FSceneRenderer::BatchShadowMeshes(TArray<FMeshBatchElement>& InOutShadowBat
 	}
 
 	FInstanceData* DestPtr = static_cast<FInstanceData*>(MappedData.pData);
-	TArray<int32> BatchesToRemove;
-	TArray<FMeshBatchElement> NewBatches;
+	TFrameArray<int32> BatchesToRemove;
+	TFrameArray<FMeshBatchElement> NewBatches;
 	uint32 CurrentInstanceOffset = 0;
 
 	for (auto& Pair : ValidGroups)
@@ -32,41 +32,44 @@ class FSceneView;
 class FTileLightCuller;
 class ULineComponent;
 class UParticleSystemComponent;
+class FOcclusionCullingManagerCPU;
 
 struct FCandidateDrawable;
 
 // 렌더링할 대상들의 집합을 담는 구조체
+// NOTE: 아래 목록들은 FSceneRenderer(프레임 임시 객체)와 함께 매 프레임 다시 만들어지므로 프레임 아레나 사용
 struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
-	TArray<UMeshComponent*> Meshes;
-	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
-	TArray<UDecalComponent*> Decals;
-	TArray<UTextRenderComponent*> Texts;
-	TArray<UParticleSystemComponent*> ParticleSystems;
-	TArray<class UClothComponent*> ClothComponents; // Cloth 시뮬레이션 컴포넌트
+	TFrameArray<UMeshComponent*> Meshes;
+	TFrameArray<UMeshComponent*> ShadowCasters; // 컬링 전 메시 목록 (화면 밖/가려진 메시도 그림자는 드리움)
+	TFrameArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
+	TFrameArray<UDecalComponent*> Decals;
+	TFrameArray<UTextRenderComponent*> Texts;
+	TFrameArray<UParticleSystemComponent*> ParticleSystems;
+	TFrameArray<class UClothComponent*> ClothComponents; // Cloth 시뮬레이션 컴포넌트
 
 	// --- Type 2: In-Scene Editor (PP X, Depth-Test O) ---
-	TArray<ULineComponent*> EditorLines;	// 그리드
-	TArray<UPrimitiveComponent*> EditorPrimitives; // 빛 기즈모, *에디터 아이콘 빌보드*
+	TFrameArray<ULineComponent*> EditorLines;	// 그리드
+	TFrameArray<UPrimitiveComponent*> EditorPrimitives; // 빛 기즈모, *에디터 아이콘 빌보드*
 
 	// --- Type 3: Overlay (PP X, Depth-Test X) ---
-	TArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
+	TFrameArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
 };
 
 struct FSceneLocals
 {
-	TArray<UPointLightComponent*> PointLights;
-	TArray<USpotLightComponent*> SpotLights;
+	TFrameArray<UPointLightComponent*> PointLights;
+	TFrameArray<USpotLightComponent*> SpotLights;
 };
 
 // NOTE: 추후 UWorld로 이동해서 등록/해지 방식으로 변경?
 // 전역 효과 및 설정을 담는 구조체
 struct FSceneGlobals
 {
-	TArray<UDirectionalLightComponent*> DirectionalLights;
-	TArray<UAmbientLightComponent*> AmbientLights;
-	TArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
+	TFrameArray<UDirectionalLightComponent*> DirectionalLights;
+	TFrameArray<UAmbientLightComponent*> AmbientLights;
+	TFrameArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
 };
 
 /**
@@ -85,6 +88,9 @@ public:
 	/** @brief 엔진 종료 시 static 리소스 해제 */
 	static void Shutdown();
 
+	/** @brief 뷰포트별 CPU 오클루전 컬러 주입 (SF_Culling이 켜져 있을 때만 사용) */
+	void SetOcclusionCuller(FOcclusionCullingManagerCPU* InOcclusionCuller) { OcclusionCPU = InOcclusionCuller; }
+
 private:
 	// Render Path
 	void RenderLitPath();
@@ -92,7 +98,7 @@ private:
 	void RenderSceneDepthPath();
 
 	void RenderShadowMaps();
-	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TFrameArray<FMeshBatchElement>& InShadowBatches);
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -106,19 +112,22 @@ private:
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
 
+	/** @brief 오클루더 메시를 CPU 깊이 버퍼에 래스터라이즈하고 가려진 메시를 Proxies.Meshes에서 제거합니다. */
+	void PerformOcclusionCulling();
+
 	/** @brief 타일 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
 	void PerformTileLightCulling();
 
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	void DrawMeshBatches(TFrameArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
 
 	/** @brief 같은 메시+머티리얼 조합을 가진 배치들을 인스턴싱으로 합칩니다. */
-	void BatchStaticMeshes(TArray<FMeshBatchElement>& InOutMeshBatches);
+	void BatchStaticMeshes(TFrameArray<FMeshBatchElement>& InOutMeshBatches);
 
 	/** @brief 그림자 렌더링용 배치를 인스턴싱으로 합칩니다. */
-	void BatchShadowMeshes(TArray<FMeshBatchElement>& InOutShadowBatches);
+	void BatchShadowMeshes(TFrameArray<FMeshBatchElement>& InOutShadowBatches);
 
 	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
 	void RenderDecalPass();
@@ -173,10 +182,13 @@ private:
 	FSceneGlobals SceneGlobals;
 
 	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
-	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+	TFrameArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
-	TArray<FMeshBatchElement> MeshBatchElements;
+	TFrameArray<FMeshBatchElement> MeshBatchElements;
+
+	// CPU 오클루전 컬러 (URenderer가 뷰포트별로 소유, 프레임 간 유지)
+	FOcclusionCullingManagerCPU* OcclusionCPU = nullptr;
 
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
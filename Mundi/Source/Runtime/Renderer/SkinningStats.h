@@ -63,6 +63,26 @@ struct FSkinningStats
 	}
 };
 
+/**
+ * 애니메이션 업데이트 빈도 최적화(URO) / 본 LOD 결정 통계
+ * 월드 틱의 FAnimationUpdate::Execute가 매 프레임 통째로 덮어씁니다 (렌더링 시작 시 리셋하지 않음).
+ */
+struct FAnimUpdateRateStats
+{
+	uint32_t AnimatedMeshCount = 0;         // 애니메이션 단계를 거친 메시 수
+	uint32_t EvaluatedCount = 0;            // 포즈를 새로 평가한 메시 수
+	uint32_t InterpolatedCount = 0;         // 평가 없이 마지막 두 포즈 사이를 보간한 메시 수
+	uint32_t OffscreenCount = 0;            // 지난 프레임에 그려지지 않은 메시 수
+	uint32_t BudgetThrottledCount = 0;      // 예산 초과로 간격이 최대로 늘어난 메시 수
+	uint32_t BoneLODMeshCount = 0;          // 본 LOD가 적용된 메시 수
+	uint32_t SkippedBoneCount = 0;          // 이번 프레임 평가에서 본 LOD로 뺀 본 수
+	uint32_t UpdateRateHistogram[9] = {};   // 평가 간격별 메시 수 ([8]은 8 프레임 이상)
+
+	double EstimatedCostMS = 0.0;           // 결정된 간격 기준 추정 평가 비용 (프레임당)
+	double EvaluateTimeMS = 0.0;            // 이번 프레임 실제 포즈 평가 시간 합 (모든 워커)
+	double BudgetMS = 0.0;                  // 설정된 예산
+};
+
 
 /**
  * 스키닝 통계 전역 매니저 (싱글톤)
@@ -132,6 +152,18 @@ public:
 		CurrentStats.DrawTimeMS += TimeMS;
 	}
 
+	// === 애니메이션 업데이트 빈도 통계 ===
+
+	void SetAnimUpdateRateStats(const FAnimUpdateRateStats& InStats)
+	{
+		AnimUpdateRateStats = InStats;
+	}
+
+	const FAnimUpdateRateStats& GetAnimUpdateRateStats() const
+	{
+		return AnimUpdateRateStats;
+	}
+
 	// === GPU 타이머 관리 ===
 
 	/**
@@ -162,6 +194,7 @@ private:
 	FSkinningStatManager& operator=(const FSkinningStatManager&) = delete;
 
 	FSkinningStats CurrentStats;
+	FAnimUpdateRateStats AnimUpdateRateStats;
 
 	// GPU 타이머 (전역에서 지속)
 	FGPUTimer* GPUDrawTimer = nullptr;
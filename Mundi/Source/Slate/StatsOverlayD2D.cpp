@@ -245,18 +245,20 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes.load()) / (1024.0 * 1024.0);
+		double PoolMb = static_cast<double>(FMemoryManager::GetSmallBlockReservedBytes()) / (1024.0 * 1024.0);
 
 		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %llu\nSmall Pool: %.1f MB", Mb, FMemoryManager::TotalAllocationCount.load(), PoolMb);
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelHeight = 72.0f;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(
 			D2dCtx, CachedBrush, TextFormat, Buf, Rc,
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			D2D1::ColorF(D2D1::ColorF::LightGreen));
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -484,6 +486,43 @@ void UStatsOverlayD2D::Draw()
 			D2D1::ColorF(0, 0, 0, 0.6f),
 			textColor);
 		NextY += skinningPanelHeight + Space;
+
+		// 애니메이션 업데이트 빈도 최적화(URO) / 본 LOD 결정
+		const FAnimUpdateRateStats& RateStats = FSkinningStatManager::GetInstance().GetAnimUpdateRateStats();
+		wchar_t RateBuf[512];
+		swprintf_s(RateBuf,
+			L"[Animation Update Rate]\n"
+			L"Meshes: %u (Offscreen %u)\n"
+			L"Evaluated: %u | Interpolated: %u\n"
+			L"Rate 1/2/3/4/5+: %u / %u / %u / %u / %u\n"
+			L"Bone LOD Meshes: %u | Skipped Bones: %u\n"
+			L"Evaluate Time:           %.3f ms\n"
+			L"Estimated Cost:  %.3f / %.3f ms\n"
+			L"Budget Throttled: %u",
+			RateStats.AnimatedMeshCount,
+			RateStats.OffscreenCount,
+			RateStats.EvaluatedCount,
+			RateStats.InterpolatedCount,
+			RateStats.UpdateRateHistogram[1],
+			RateStats.UpdateRateHistogram[2],
+			RateStats.UpdateRateHistogram[3],
+			RateStats.UpdateRateHistogram[4],
+			RateStats.UpdateRateHistogram[5] + RateStats.UpdateRateHistogram[6] + RateStats.UpdateRateHistogram[7] + RateStats.UpdateRateHistogram[8],
+			RateStats.BoneLODMeshCount,
+			RateStats.SkippedBoneCount,
+			RateStats.EvaluateTimeMS,
+			RateStats.EstimatedCostMS,
+			RateStats.BudgetMS,
+			RateStats.BudgetThrottledCount);
+
+		const float ratePanelHeight = 170.0f;
+		D2D1_RECT_F rateRc = D2D1::RectF(Margin, NextY, Margin + SkinningPanelWidth, NextY + ratePanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, CachedBrush, TextFormat, RateBuf, rateRc,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			textColor);
+		NextY += ratePanelHeight + Space;
 	}
 
 	if (bShowParticles)
@@ -589,6 +628,39 @@ void UStatsOverlayD2D::Draw()
 			D2D1::ColorF(D2D1::ColorF::Coral));
 
 		NextY += ragdollPanelHeight + Space;
+
+		// 물리 스텝 진행 방식 / 동기화 지점 대기 시간
+		const FPhysicsSimulationStats& SimStats = FRagdollStatManager::GetInstance().GetSimulationStats();
+		wchar_t SimulationBuf[512];
+		swprintf_s(SimulationBuf,
+			L"[Physics Simulation]\n"
+			L"Mode: %s\n"
+			L"Steps: %d (Async %d)\n"
+			L"Blocking Steps:    %.3f ms\n"
+			L"Overlapped Work:   %.3f ms\n"
+			L"Fence Wait:        %.3f ms\n"
+			L"Interpolated: %d (Alpha %.2f)\n"
+			L"Scene Queries: %d (%.3f ms)",
+			SimStats.ModeName,
+			SimStats.SubStepCount,
+			SimStats.AsyncStepCount,
+			SimStats.BlockingStepTimeMS,
+			SimStats.OverlapTimeMS,
+			SimStats.FenceWaitTimeMS,
+			SimStats.InterpolatedBodyCount,
+			SimStats.InterpolationAlpha,
+			SimStats.SceneQueryCount,
+			SimStats.SceneQueryTimeMS);
+
+		const float simulationPanelHeight = 170.0f;
+		D2D1_RECT_F simulationRc = D2D1::RectF(Margin, NextY, Margin + SkinningPanelWidth, NextY + simulationPanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, CachedBrush, TextFormat, SimulationBuf, simulationRc,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Coral));
+
+		NextY += simulationPanelHeight + Space;
 	}
 
 	D2dCtx->EndDraw();
@@ -6,6 +6,7 @@
 #include "SlateManager.h"
 #include "SkinnedMeshComponent.h"
 #include "PlatformCrashHandler.h"
+#include "Benchmark.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -65,6 +66,8 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("CRASHIN <seconds>");
 	HelpCommandList.Add("CANCELCRASH");
 	HelpCommandList.Add("THROWEXCEPTION");
+	HelpCommandList.Add("BENCH");
+	HelpCommandList.Add("BENCH <name|ALL>");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -508,6 +511,21 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		// C++ 예외 던지기 (std::runtime_error)
 		throw std::runtime_error("Intentional C++ exception thrown from console command!");
 	}
+	else if (Stricmp(command_line, "BENCH") == 0)
+	{
+		AddLog("BENCH commands:");
+		for (const FBenchmark& Benchmark : FBenchmarkRegistry::GetBenchmarks())
+			AddLog("- BENCH %s : %s", Benchmark.Name, Benchmark.Description);
+		AddLog("- BENCH ALL");
+	}
+	else if (Strnicmp(command_line, "BENCH ", 6) == 0)
+	{
+		// 게임 스레드에서 동기로 실행 (결과는 UE_LOG로 콘솔에 출력)
+		if (!FBenchmarkRegistry::Run(command_line + 6))
+		{
+			AddLog("Unknown benchmark: '%s' (BENCH로 목록 확인)", command_line + 6);
+		}
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
@@ -1695,6 +1695,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 
 				// CurveAuto/CurveAutoClamped 모드면 탄젠트 재계산
 				CurvePtr->AutoCalculateTangents();
+				CurvePtr->Bake();
 
 				if (EditorState) EditorState->bIsDirty = true;
 			}
@@ -1776,6 +1777,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 
 				// CurveAuto/CurveAutoClamped 모드면 탄젠트 재계산
 				CurvePtr->AutoCalculateTangents();
+				CurvePtr->Bake();
 
 				if (EditorState) EditorState->bIsDirty = true;
 			}
@@ -1837,6 +1839,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 				{
 					Point.LeaveTangent += TangentDelta;
 				}
+				CurvePtr->Bake();
 
 				if (EditorState) EditorState->bIsDirty = true;
 			}
@@ -1888,6 +1891,7 @@ void SCurveEditorWidget::HandleCurveInteraction(ImVec2 CanvasPos, ImVec2 CanvasS
 					else if (AxisIndex == 1) Point.LeaveTangent.Y += TangentDelta;
 					else Point.LeaveTangent.Z += TangentDelta;
 				}
+				CurvePtr->Bake();
 
 				if (EditorState) EditorState->bIsDirty = true;
 			}
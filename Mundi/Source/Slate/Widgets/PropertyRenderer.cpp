@@ -3518,6 +3518,12 @@ bool UPropertyRenderer::RenderDistributionFloatProperty(const FProperty& Prop, v
 		ImGui::TreePop();
 	}
 
+	// 커브 키가 바뀌었을 수 있으므로 룩업 테이블을 다시 굽는다
+	if (bChanged)
+	{
+		Dist->Bake();
+	}
+
 	return bChanged;
 }
 
@@ -3572,6 +3578,12 @@ bool UPropertyRenderer::RenderDistributionVectorProperty(const FProperty& Prop,
 		ImGui::TreePop();
 	}
 
+	// 커브 키가 바뀌었을 수 있으므로 룩업 테이블을 다시 굽는다
+	if (bChanged)
+	{
+		Dist->Bake();
+	}
+
 	return bChanged;
 }
 
@@ -3689,6 +3701,12 @@ bool UPropertyRenderer::RenderDistributionColorProperty(const FProperty& Prop, v
 		ImGui::TreePop();
 	}
 
+	// 커브 키가 바뀌었을 수 있으므로 룩업 테이블을 다시 굽는다
+	if (bChanged)
+	{
+		Dist->Bake();
+	}
+
 	return bChanged;
 }
 
@@ -590,10 +590,8 @@ static bool ExpandParticleBounds(UParticleSystemComponent* PSC, FVector& InOutMi
 
 		for (int32 i = 0; i < Emitter->ActiveParticles; ++i)
 		{
-			FBaseParticle* Particle = GetParticleAtIndex(Emitter, i);
-			if (!Particle) continue;
-
-			const FVector& Pos = Particle->Location;
+			// SoA 레이아웃 이미터도 읽을 수 있도록 위치만 조회
+			const FVector Pos = Emitter->GetParticleLocation(i);
 
 			// Min 확장 (더 작은 값으로)
 			if (Pos.X < InOutMin.X) { InOutMin.X = Pos.X; bExpanded = true; }
@@ -2062,6 +2062,17 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("피사계 심도 상세 설정");
 		}
 
+		// CPU Occlusion Culling
+		bool bOcclusionCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Culling);
+		if (ImGui::Checkbox(" 오클루전 컬링", &bOcclusionCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_Culling);
+		}
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("오클루더 메시를 CPU 깊이 버퍼에 래스터라이즈해서 가려진 메시를 그리지 않습니다.");
+		}
+
 		// Tile-Based Light Culling
 		bool bTileCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_TileCulling);
 		if (ImGui::Checkbox("##TileCulling", &bTileCulling))
@@ -4,6 +4,8 @@
 // Uncomment to enable DDS texture caching (faster loading, uses Data/TextureCache/)
 #define USE_DDS_CACHE
 #define USE_OBJ_CACHE
+// Comment out to keep raw animation keys (FBX 애니메이션을 양자화/키 제거한 압축 트랙으로 저장, .anim.bin 캐시 포함)
+#define USE_COMPRESSED_ANIMATION
 
 #define IMGUI_DEFINE_MATH_OPERATORS	// Imgui에서 곡선 표시를 위한 전용 벡터 연산자 활성화
 
@@ -58,6 +60,8 @@
 #include "ResourceData.h"
 #include "VertexData.h"
 #include "UEContainer.h"
+#include "FrameAllocator.h"
+#include "FlatHashContainer.h"
 #include "Name.h"
 #include "PathUtils.h"
 #include "Object.h"